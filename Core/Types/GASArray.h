@@ -84,6 +84,18 @@ public:
         return Data[Index];
     }
 
+    T& Last()
+    {
+        assert(Num() > 0);
+        return Data.back();
+    }
+
+    const T& Last() const
+    {
+        assert(Num() > 0);
+        return Data.back();
+    }
+
     bool IsValidIndex(int32_t Index) const
     {
         return Index >= 0 && Index < Num();
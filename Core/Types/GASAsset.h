@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include "GASArray.h"
 #include "GASCoreTypes.h"
+#include <cmath>
 
 //submesh
 struct FGASSubMesh
@@ -8,6 +9,119 @@ struct FGASSubMesh
     uint32_t IndexStart = 0;   
     uint32_t IndexCount = 0;  
     int32_t MaterialIndex = 0; 
+
+    // 该 SubMesh 引用的顶点区间 (合并后的全局顶点序号)
+    uint32_t VertexStart = 0;
+    uint32_t VertexCount = 0;
+};
+
+// 网格 LOD (LOD1 起)，各级的 SubMesh 位于 GASMesh::LODSections
+struct FGASMeshLOD
+{
+    float ScreenSize = 0.0f;    // 屏幕尺寸 (包围球直径 / 视口高度) 小于该值时使用此 LOD
+    float MaxError = 0.0f;      // 被移除顶点到简化后表面的最大距离 (模型空间)
+    uint32_t FirstSection = 0;
+    uint32_t NumSections = 0;
+    uint32_t NumVertices = 0;   // 该级引用的顶点数 (每个 Section 的顶点区间前缀)
+    uint32_t NumTriangles = 0;
+};
+
+// Meshlet (簇)：一小组三角形及其局部顶点，用于簇剔除和限制每簇的骨骼调色板
+// 包围球与法线锥基于绑定姿势，蒙皮后使用需按骨骼运动范围放大
+struct FGASMeshlet
+{
+    uint32_t VertexOffset = 0;      // MeshletVertices 中的起始位置
+    uint32_t TriangleOffset = 0;    // MeshletTriangles 中的起始字节
+    uint32_t BoneOffset = 0;        // MeshletBones 中的起始位置
+    uint8_t VertexCount = 0;
+    uint8_t TriangleCount = 0;
+    uint8_t BoneCount = 0;
+    uint8_t LODIndex = 0;
+    uint16_t SectionIndex = 0;      // 所在 LOD 的 Section 序号
+    uint16_t Padding = 0;
+
+    // 包围球
+    FGASVector3 Center;
+    float Radius = 0.0f;
+
+    // 法线锥：dot(normalize(ConeApex - Camera), ConeAxis) > ConeCutoff 时整簇背向相机
+    FGASVector3 ConeApex;
+    FGASVector3 ConeAxis;
+    float ConeCutoff = 1.0f;
+};
+
+// 动画包围盒块：相对所在轨道 ClipBounds 量化为 uint16 (Min 向下取整、Max 向上取整，保证保守)
+struct FGASAnimBoundsBlock
+{
+    uint16_t Min[3] = { 0, 0, 0 };
+    uint16_t Max[3] = { 0, 0, 0 };
+};
+
+// 某个 Mesh 在一段动画下的模型空间包围盒
+// 第 b 块覆盖帧 [b * FramesPerBlock, (b + 1) * FramesPerBlock] (含两端，末块截断到最后一帧)，相邻帧之间的插值姿势也落在所在块内
+struct FGASAnimBoundsTrack
+{
+    uint64_t MeshGUID = 0;
+    uint32_t FramesPerBlock = 1;
+    uint32_t FirstBlock = 0;    // GASAnimation::BoundsBlocks 中的起始位置
+    uint32_t NumBlocks = 0;
+    uint32_t Padding = 0;
+    FGASAABB ClipBounds;        // 整段动画的包围盒，也是块的量化基准
+};
+
+// 根运动关键帧：把第 0 帧根骨骼水平位置与朝向变换到第 f 帧的模型空间变换 (Key * M0 = Mf)，Yaw 已展开，可跨越 ±PI 连续插值
+// 第 0 帧根骨骼位于原点时，位移即根骨骼的水平位移；Translation.Y 恒为 0 (竖直运动保留在根骨骼轨道中)
+// 同一结构也用作查询结果：两个时刻之间的位移 (在起始时刻朝向下表示) 与转角
+struct FGASRootMotionKey
+{
+    FGASVector3 Translation;
+    float Yaw = 0.0f;
+};
+
+// 动画事件 (脚步/音效/特效标记)：片段内时刻 + 名称，NameHash 为名称的 XXHash64，运行时按哈希比较
+struct FGASAnimEvent
+{
+    float Time = 0.0f;          // 秒，[0, 循环周期]
+    float Payload = 0.0f;       // 附加数值 (如音量、脚序号)
+    uint64_t NameHash = 0;
+    char Name[GAS_MAX_EVENT_NAME_LEN] = {};
+};
+
+// 事件查询结果：GASAnimation::Events 中 [First, First + Count)
+struct FGASAnimEventRange
+{
+    int32_t First = 0;
+    int32_t Count = 0;
+};
+
+// VAT 纹素 8 字节 (按 RGBA16_UINT 上传)：位置 unorm16 x3 (相对 PositionBounds) + 法线八面体编码 snorm8 x2
+struct FGASVATTexel
+{
+    uint16_t Position[3] = { 0, 0, 0 };
+    int8_t Normal[2] = { 0, 0 };
+};
+
+// VAT 中的一段动画
+struct FGASVATClip
+{
+    uint64_t AnimationGUID = 0;
+    uint32_t FirstFrame = 0;        // 在纹理中的起始帧
+    uint32_t NumFrames = 0;
+    float FrameRate = 30.0f;        // 烘焙后的帧率 ((NumFrames - 1) / 源循环周期)
+    float Duration = 0.0f;
+    FGASAABB Bounds;                // 该片段所有帧的包围盒
+};
+
+// 重定向表中的一根目标骨骼
+// 旋转：Target = PreRotation * Source * PostRotation (由双方绑定姿态的全局朝向求得，骨骼轴向不同也能对齐)
+struct FGASRetargetBone
+{
+    int32_t SourceIndex = -1;       // 对应的源骨骼，-1 表示未映射 (输出绑定姿态)
+    EGASRetargetTranslation TranslationMode = EGASRetargetTranslation::Skeleton;
+    FGASQuaternion PreRotation;     // 源父骨骼空间 -> 目标父骨骼空间
+    FGASQuaternion PostRotation;    // 源骨骼绑定朝向 -> 目标骨骼绑定朝向
+    float TranslationScale = 1.0f;  // AnimationScaled 时的平移比例 (目标骨骼长度 / 源骨骼长度)
+    FGASTransform BindPose;         // 目标骨骼的局部绑定姿态
 };
 
 class GASAsset
@@ -41,20 +155,47 @@ public:
 
 
      //构建加速查找表 从二进制加载完 Bones 数组后，必须手动调用一次这个函数
+    // 开放寻址 (线性探测) 的扁平哈希表：NameHash -> 骨骼索引，容量为骨骼数两倍以上的 2 的幂
     void RebuildBoneMap()
     {
-        BoneNameToIndexMap.clear();
+        uint32_t Capacity = 16;
+        while (Capacity < (uint32_t)Bones.Num() * 2) Capacity <<= 1;
+        BoneHashSlots.assign(Capacity, FGASBoneHashSlot());
+
         for (int32_t i = 0; i < Bones.Num(); ++i)
         {
-            BoneNameToIndexMap[Bones[i].Name] = i;
+            FGASBoneDefinition& Bone = Bones[i];
+            if (Bone.NameHash == 0) Bone.NameHash = GASHashBoneName(Bone.Name);
+
+            uint32_t Slot = (uint32_t)Bone.NameHash & (Capacity - 1);
+            while (BoneHashSlots[Slot].Index >= 0 && BoneHashSlots[Slot].Hash != Bone.NameHash)
+            {
+                Slot = (Slot + 1) & (Capacity - 1);
+            }
+            // 重名时后者覆盖前者
+            BoneHashSlots[Slot].Hash = Bone.NameHash;
+            BoneHashSlots[Slot].Index = i;
         }
     }
 
-    //名称查找骨骼索引 
-    int32_t FindBoneIndex(const std::string& Name) const
+    //名称查找骨骼索引 (名称按 NormalizeBoneName 规则比较，调用方无需预先规范化)
+    int32_t FindBoneIndex(std::string_view Name) const
+    {
+        return FindBoneIndexByHash(GASHashBoneName(Name));
+    }
+
+    // 用预先算好的名称哈希查找 (逐帧查询的 IK 目标、挂点等应缓存 GASHashBoneName 的结果)
+    int32_t FindBoneIndexByHash(uint64_t NameHash) const
     {
-        auto It = BoneNameToIndexMap.find(Name);
-        return (It != BoneNameToIndexMap.end()) ? It->second : -1;
+        if (BoneHashSlots.empty()) return -1;
+
+        const uint32_t Mask = (uint32_t)BoneHashSlots.size() - 1;
+        for (uint32_t Slot = (uint32_t)NameHash & Mask;; Slot = (Slot + 1) & Mask)
+        {
+            const FGASBoneHashSlot& Entry = BoneHashSlots[Slot];
+            if (Entry.Index < 0) return -1;
+            if (Entry.Hash == NameHash) return Entry.Index;
+        }
     }
 
     //获取父骨骼索引
@@ -70,8 +211,22 @@ public:
     //获取骨骼数量 
     int32_t GetNumBones() const { return Bones.Num(); }
 
+    // 是否已按深度分层 (父骨骼总在前一层，同层骨骼可批量计算)
+    bool HasDepthLevels() const { return SkeletonHeader.NumLevels > 0; }
+
+    // 层数 (未分层时为 0)
+    int32_t GetNumLevels() const { return (int32_t)SkeletonHeader.NumLevels; }
+
+    // 第 Level 层的骨骼区间 [OutBegin, OutEnd)
+    void GetLevelRange(int32_t Level, int32_t& OutBegin, int32_t& OutEnd) const
+    {
+        assert(Level >= 0 && Level < GetNumLevels());
+        OutBegin = (int32_t)SkeletonHeader.LevelOffsets[Level];
+        OutEnd = (int32_t)SkeletonHeader.LevelOffsets[Level + 1];
+    }
+
     //获取特定骨骼的逆绑定矩阵 (用于蒙皮)
-    const FGASMatrix4x4& GetInverseBindMatrix(int32_t BoneIndex) const
+    const FGASMatrix3x4& GetInverseBindMatrix(int32_t BoneIndex) const
     {
         assert(Bones.IsValidIndex(BoneIndex));
         return Bones[BoneIndex].InverseBindMatrix;
@@ -85,8 +240,14 @@ public:
     GASArray<FGASBoneDefinition> Bones;
 
 private:
-    // 运行时加速结构：骨骼名称 -> 索引的映射 不序列化到磁盘，Load 后重建
-    std::unordered_map<std::string, int32_t> BoneNameToIndexMap;
+    struct FGASBoneHashSlot
+    {
+        uint64_t Hash = 0;
+        int32_t Index = -1;     // -1 表示空槽
+    };
+
+    // 运行时加速结构：名称哈希 -> 索引的扁平表 不序列化到磁盘，Load 后重建
+    std::vector<FGASBoneHashSlot> BoneHashSlots;
 };
 
 
@@ -120,12 +281,244 @@ public:
     //获取每秒帧率 
     float GetFrameRate() const { return AnimHeader.FrameRate; }
 
+    // 是否为叠加动画 (帧数据是相对参考姿态的差值，需叠加到基础姿态上使用)
+    bool IsAdditive() const { return AnimHeader.AdditiveType != EGASAdditiveType::None; }
+
+    // 是否带有提取出的根运动曲线
+    bool HasRootMotion() const { return RootMotion.Num() > 0; }
+
+    // 查询 [StartTime, EndTime] 的根运动累计位移，结果在 StartTime 时刻的朝向下表示
+    // bLooping 时跨越循环点按整圈位移累加，EndTime < StartTime 时得到反向位移；没有根运动时返回 false
+    bool GetRootMotion(float StartTime, float EndTime, bool bLooping, FGASRootMotionKey& OutDelta) const
+    {
+        const int32_t NumKeys = RootMotion.Num();
+        if (NumKeys == 0) return false;
+
+        const float FrameRate = AnimHeader.FrameRate;
+        const float LoopLength = (NumKeys > 1 && FrameRate > 0.0f) ? (float)(NumKeys - 1) / FrameRate : 0.0f;
+        if (!bLooping || LoopLength <= 0.0f)
+        {
+            OutDelta = ComposeRootMotion(InverseRootMotion(EvaluateRootMotion(StartTime)), EvaluateRootMotion(EndTime));
+            return true;
+        }
+
+        const float StartLoop = std::floor(StartTime / LoopLength);
+        const float EndLoop = std::floor(EndTime / LoopLength);
+        FGASRootMotionKey Delta = InverseRootMotion(EvaluateRootMotion(StartTime - StartLoop * LoopLength));
+
+        // 中间经过的整圈：第 0 帧为单位变换，整圈位移即最后一帧
+        const int32_t NumLoops = (int32_t)(EndLoop - StartLoop);
+        const FGASRootMotionKey FullLoop = NumLoops >= 0 ? RootMotion[NumKeys - 1] : InverseRootMotion(RootMotion[NumKeys - 1]);
+        for (int32_t i = 0; i < std::abs(NumLoops); ++i) Delta = ComposeRootMotion(Delta, FullLoop);
+
+        OutDelta = ComposeRootMotion(Delta, EvaluateRootMotion(EndTime - EndLoop * LoopLength));
+        return true;
+    }
+
+    // 查询时间区间 [StartTime, EndTime) 内经过的事件，返回区间数 (0~2，跨越循环点时为两段)，不分配内存
+    // bLooping 时按循环周期 (FrameCount - 1) / FrameRate 取模，区间跨度不小于一个周期时每个事件只返回一次
+    int32_t QueryEvents(float StartTime, float EndTime, bool bLooping, FGASAnimEventRange OutRanges[2]) const
+    {
+        const int32_t NumEvents = Events.Num();
+        if (NumEvents == 0 || EndTime <= StartTime) return 0;
+
+        const float LoopLength = AnimHeader.FrameRate > 0.0f && AnimHeader.FrameCount > 1 ? (float)(AnimHeader.FrameCount - 1) / AnimHeader.FrameRate : 0.0f;
+        if (!bLooping || LoopLength <= 0.0f)
+        {
+            return MakeEventRange(LowerBoundEvent(StartTime), LowerBoundEvent(EndTime), OutRanges);
+        }
+
+        if (EndTime - StartTime >= LoopLength)
+        {
+            OutRanges[0].First = 0;
+            OutRanges[0].Count = NumEvents;
+            return 1;
+        }
+
+        // 起点取 (0, 周期]：恰在循环点开始时，位于周期末尾的事件等同于本圈 0 时刻，由下方跨越分支一并返回
+        float Start = StartTime - std::floor(StartTime / LoopLength) * LoopLength;
+        if (Start <= 0.0f) Start += LoopLength;
+        const float End = Start + (EndTime - StartTime);
+        if (End <= LoopLength)
+        {
+            return MakeEventRange(LowerBoundEvent(Start), LowerBoundEvent(End), OutRanges);
+        }
+
+        // 跨越循环点：[Start, 结尾) + [开头, End - 周期)
+        int32_t NumRanges = MakeEventRange(LowerBoundEvent(Start), NumEvents, OutRanges);
+        NumRanges += MakeEventRange(0, LowerBoundEvent(End - LoopLength), OutRanges + NumRanges);
+        return NumRanges;
+    }
+
+    // A 之后再走 B (B 在 A 的终点朝向下表示)
+    static FGASRootMotionKey ComposeRootMotion(const FGASRootMotionKey& A, const FGASRootMotionKey& B)
+    {
+        const float C = std::cos(A.Yaw), S = std::sin(A.Yaw);
+        FGASRootMotionKey Out;
+        Out.Translation = FGASVector3(A.Translation.X + C * B.Translation.X + S * B.Translation.Z, 0.0f,
+            A.Translation.Z - S * B.Translation.X + C * B.Translation.Z);
+        Out.Yaw = A.Yaw + B.Yaw;
+        return Out;
+    }
+
+    static FGASRootMotionKey InverseRootMotion(const FGASRootMotionKey& A)
+    {
+        const float C = std::cos(A.Yaw), S = std::sin(A.Yaw);
+        FGASRootMotionKey Out;
+        Out.Translation = FGASVector3(-(C * A.Translation.X - S * A.Translation.Z), 0.0f, -(S * A.Translation.X + C * A.Translation.Z));
+        Out.Yaw = -A.Yaw;
+        return Out;
+    }
+
+    // 查找某个 Mesh 的动画包围盒轨道
+    const FGASAnimBoundsTrack* FindBoundsTrack(uint64_t MeshGUID) const
+    {
+        for (const FGASAnimBoundsTrack& Track : BoundsTracks)
+        {
+            if (Track.MeshGUID == MeshGUID) return &Track;
+        }
+        return nullptr;
+    }
+
+    // 查询 Mesh 在时间区间 [StartTime, EndTime] 内的模型空间包围盒
+    // bLooping 时时间按循环周期 (FrameCount - 1) / FrameRate 取模，取模后 Start > End 视为跨越循环点；没有对应轨道时返回 false (调用方回退到绑定姿势包围盒)
+    bool GetAnimatedBounds(uint64_t MeshGUID, float StartTime, float EndTime, bool bLooping, FGASAABB& OutBounds) const
+    {
+        const FGASAnimBoundsTrack* Track = FindBoundsTrack(MeshGUID);
+        if (!Track || Track->NumBlocks == 0) return false;
+
+        const float LoopLength = AnimHeader.FrameRate > 0.0f && AnimHeader.FrameCount > 1 ? (float)(AnimHeader.FrameCount - 1) / AnimHeader.FrameRate : 0.0f;
+        if (EndTime < StartTime) std::swap(StartTime, EndTime);
+
+        uint16_t Min[3] = { 0xFFFF, 0xFFFF, 0xFFFF };
+        uint16_t Max[3] = { 0, 0, 0 };
+
+        if (bLooping && LoopLength > 0.0f)
+        {
+            if (EndTime - StartTime >= LoopLength)
+            {
+                OutBounds = Track->ClipBounds;
+                return true;
+            }
+            StartTime = std::fmod(StartTime, LoopLength); if (StartTime < 0.0f) StartTime += LoopLength;
+            EndTime = std::fmod(EndTime, LoopLength); if (EndTime < 0.0f) EndTime += LoopLength;
+
+            if (StartTime > EndTime)
+            {
+                // 跨越循环点：[Start, 结尾] + [开头, End]
+                UnionBoundsBlocks(*Track, TimeToBoundsBlock(*Track, StartTime), Track->NumBlocks - 1, Min, Max);
+                UnionBoundsBlocks(*Track, 0, TimeToBoundsBlock(*Track, EndTime), Min, Max);
+            }
+            else
+            {
+                UnionBoundsBlocks(*Track, TimeToBoundsBlock(*Track, StartTime), TimeToBoundsBlock(*Track, EndTime), Min, Max);
+            }
+        }
+        else
+        {
+            UnionBoundsBlocks(*Track, TimeToBoundsBlock(*Track, StartTime), TimeToBoundsBlock(*Track, EndTime), Min, Max);
+        }
+
+        DecodeBounds(*Track, Min, Max, OutBounds);
+        return true;
+    }
+
+    // 查询单个时刻的包围盒
+    bool GetAnimatedBounds(uint64_t MeshGUID, float Time, bool bLooping, FGASAABB& OutBounds) const
+    {
+        return GetAnimatedBounds(MeshGUID, Time, Time, bLooping, OutBounds);
+    }
+
+private:
+    // 时间 -> 所在块 (钳制到轨道范围)
+    uint32_t TimeToBoundsBlock(const FGASAnimBoundsTrack& Track, float Time) const
+    {
+        float Frame = Time * AnimHeader.FrameRate;
+        uint32_t Segment = Frame > 0.0f ? (uint32_t)Frame : 0;
+        uint32_t Block = Segment / Track.FramesPerBlock;
+        return Block < Track.NumBlocks ? Block : Track.NumBlocks - 1;
+    }
+
+    // 在量化域内合并块 [First, Last]
+    void UnionBoundsBlocks(const FGASAnimBoundsTrack& Track, uint32_t First, uint32_t Last, uint16_t Min[3], uint16_t Max[3]) const
+    {
+        const FGASAnimBoundsBlock* Blocks = BoundsBlocks.GetData() + Track.FirstBlock;
+        for (uint32_t b = First; b <= Last; ++b)
+        {
+            for (int a = 0; a < 3; ++a)
+            {
+                if (Blocks[b].Min[a] < Min[a]) Min[a] = Blocks[b].Min[a];
+                if (Blocks[b].Max[a] > Max[a]) Max[a] = Blocks[b].Max[a];
+            }
+        }
+    }
+
+    // 第一个 Time >= 给定时刻的事件 (二分查找)
+    int32_t LowerBoundEvent(float Time) const
+    {
+        int32_t Low = 0, High = Events.Num();
+        while (Low < High)
+        {
+            const int32_t Mid = (Low + High) / 2;
+            if (Events[Mid].Time < Time) Low = Mid + 1;
+            else High = Mid;
+        }
+        return Low;
+    }
+
+    static int32_t MakeEventRange(int32_t First, int32_t Last, FGASAnimEventRange* OutRange)
+    {
+        if (Last <= First) return 0;
+        OutRange->First = First;
+        OutRange->Count = Last - First;
+        return 1;
+    }
+
+    // 片段内某时刻的根运动 (钳制到首尾帧，相邻帧线性插值)
+    FGASRootMotionKey EvaluateRootMotion(float Time) const
+    {
+        const int32_t LastKey = RootMotion.Num() - 1;
+        float Frame = Time * AnimHeader.FrameRate;
+        Frame = Frame < 0.0f ? 0.0f : (Frame > (float)LastKey ? (float)LastKey : Frame);
+
+        const int32_t Key0 = (int32_t)Frame;
+        const int32_t Key1 = Key0 < LastKey ? Key0 + 1 : LastKey;
+        const float Alpha = Frame - (float)Key0;
+        const FGASRootMotionKey& A = RootMotion[Key0];
+        const FGASRootMotionKey& B = RootMotion[Key1];
+
+        FGASRootMotionKey Out;
+        Out.Translation = FGASVector3(A.Translation.X + (B.Translation.X - A.Translation.X) * Alpha, 0.0f,
+            A.Translation.Z + (B.Translation.Z - A.Translation.Z) * Alpha);
+        Out.Yaw = A.Yaw + (B.Yaw - A.Yaw) * Alpha;
+        return Out;
+    }
+
+    void DecodeBounds(const FGASAnimBoundsTrack& Track, const uint16_t Min[3], const uint16_t Max[3], FGASAABB& OutBounds) const
+    {
+        const FGASVector3& Lo = Track.ClipBounds.Min;
+        const FGASVector3& Hi = Track.ClipBounds.Max;
+        const float Step[3] = { (Hi.X - Lo.X) / 65535.0f, (Hi.Y - Lo.Y) / 65535.0f, (Hi.Z - Lo.Z) / 65535.0f };
+        OutBounds.Min = FGASVector3(Lo.X + Min[0] * Step[0], Lo.Y + Min[1] * Step[1], Lo.Z + Min[2] * Step[2]);
+        OutBounds.Max = FGASVector3(Lo.X + Max[0] * Step[0], Lo.Y + Max[1] * Step[1], Lo.Z + Max[2] * Step[2]);
+    }
+
 public:
     // 具体的动画头部信息
     FGASAnimationHeader AnimHeader;
 
     // 巨大的扁平化动画数据数组 大小 = FrameCount * TrackCount
     GASArray<FGASAnimTrackData> Tracks;
+
+    // 动画包围盒：每个 (Mesh, 本动画) 一条轨道，块数据连续存放
+    GASArray<FGASAnimBoundsTrack> BoundsTracks;
+    GASArray<FGASAnimBoundsBlock> BoundsBlocks;
+
+    // 根运动曲线：为空或每帧一个关键帧 (由 GASRootMotionExtractor 在导入时提取)
+    GASArray<FGASRootMotionKey> RootMotion;
+
+    // 事件轨道：按时间升序 (由 GASAnimEventBuilder 写入)
+    GASArray<FGASAnimEvent> Events;
 };
 
 //4.网格资产
@@ -138,17 +531,70 @@ public:
         BaseHeader.AssetType = EGASAssetType::Mesh;
     }
 
-    // 获取顶点数量 
-    int32_t GetNumVertices() const { return Vertices.Num(); }
+    // 获取顶点数量 (完整顶点被剥离时使用紧凑流的数量)
+    int32_t GetNumVertices() const { return Vertices.Num() > 0 ? Vertices.Num() : (int32_t)CompactHeader.NumVertices; }
 
     //获取索引数量
-    int32_t GetNumIndices() const { return Indices.Num(); }
+    int32_t GetNumIndices() const { return Is16BitIndices() ? Indices16.Num() : Indices.Num(); }
+
+    // 索引是否为 16 位
+    bool Is16BitIndices() const { return (MeshHeader.MeshFlags & static_cast<uint32_t>(EGASMeshFlags::Index16)) != 0; }
+
+    // 读取索引 (与位宽无关)
+    uint32_t GetIndex(int32_t i) const { return Is16BitIndices() ? (uint32_t)Indices16[i] : Indices[i]; }
+
+    // 索引缓冲原始数据与单个索引字节数，用于直接上传 GPU
+    const void* GetIndexData() const { return Is16BitIndices() ? (const void*)Indices16.GetData() : (const void*)Indices.GetData(); }
+    uint32_t GetIndexStride() const { return Is16BitIndices() ? sizeof(uint16_t) : sizeof(uint32_t); }
 
     // 获取包围盒 
     const FGASAABB& GetAABB() const { return MeshHeader.AABB; }
 
     inline void SetHasSkin(bool Has) { MeshHasSkin = Has; }
     inline bool HasSkin() { return MeshHasSkin; }
+
+    // LOD 数量 (含 LOD0)
+    int32_t GetNumLODs() const { return 1 + LODs.Num(); }
+
+    // 获取某级 LOD 的 Section 列表
+    const FGASSubMesh* GetLODSections(int32_t LODIndex, int32_t& OutNumSections) const
+    {
+        if (LODIndex <= 0 || LODIndex > LODs.Num())
+        {
+            OutNumSections = SubMeshes.Num();
+            return SubMeshes.GetData();
+        }
+        const FGASMeshLOD& LOD = LODs[LODIndex - 1];
+        OutNumSections = (int32_t)LOD.NumSections;
+        return LODSections.GetData() + LOD.FirstSection;
+    }
+
+    // 根据屏幕尺寸选择 LOD
+    int32_t SelectLOD(float ScreenSize) const
+    {
+        int32_t LODIndex = 0;
+        while (LODIndex < LODs.Num() && ScreenSize < LODs[LODIndex].ScreenSize) ++LODIndex;
+        return LODIndex;
+    }
+
+    // 在某级 LOD 下是否需要计算该骨骼 (没有骨骼 LOD 表时总是需要)
+    bool IsBoneRequired(int32_t BoneIndex, int32_t LODIndex) const
+    {
+        if (!BoneLODTable.IsValidIndex(BoneIndex)) return BoneLODTable.Num() == 0;
+        return LODIndex < (int32_t)BoneLODTable[BoneIndex];
+    }
+
+    // 每顶点实际使用的骨骼影响数 (1/2/4/8)
+    int32_t GetInfluenceCount() const { return IsValidInfluenceCount(MeshHeader.InfluenceCount) ? (int32_t)MeshHeader.InfluenceCount : MAX_BONE_INFLUENCES; }
+
+    // 是否附带 Meshlet
+    bool HasMeshlets() const { return (MeshHeader.MeshFlags & static_cast<uint32_t>(EGASMeshFlags::Meshlets)) != 0; }
+
+    // 是否附带紧凑顶点流
+    bool HasCompactVertices() const { return (MeshHeader.MeshFlags & static_cast<uint32_t>(EGASMeshFlags::CompactVertices)) != 0; }
+
+    // 获取某顶点在蒙皮流中的起始地址
+    const uint8_t* GetCompactSkinData(int32_t VertexIndex) const { return CompactSkin.GetData() + (size_t)VertexIndex * CompactHeader.SkinStride; }
 public:
 
     FGASMeshHeader MeshHeader;
@@ -163,7 +609,97 @@ public:
     std::string DiffuseTexturePath;
 
     //  索引数据 认为每三个点组成三角形，直接三个三个读取
+    //  按 EGASMeshFlags::Index16 只填充其中一个
     GASArray<uint32_t> Indices;
+    GASArray<uint16_t> Indices16;
+
+    // 按材质划分的索引区间 (LOD0)
+    GASArray<FGASSubMesh> SubMeshes;
+
+    // LOD1..N：索引追加在 LOD0 索引之后，顶点与 LOD0 共享
+    GASArray<FGASMeshLOD> LODs;
+    GASArray<FGASSubMesh> LODSections;
+
+    // Meshlet，按 LOD -> Section 顺序排列
+    GASArray<FGASMeshlet> Meshlets;
+    GASArray<uint32_t> MeshletVertices;     // 局部顶点 -> 网格顶点序号
+    GASArray<uint8_t> MeshletTriangles;     // 每三角形 3 个局部顶点索引，每个 Meshlet 4 字节对齐
+    GASArray<uint16_t> MeshletBones;        // 每个 Meshlet 用到的骨骼 (升序)
+
+    // 骨骼 LOD 表：BoneLODTable[Bone] = 需要该骨骼的 LOD 数量，LOD >= 该值时可跳过 (0 表示本网格不需要)
+    GASArray<uint8_t> BoneLODTable;
+
+    // 紧凑顶点流 (GPU 运行时布局)：位置 / 着色 / 蒙皮分离存储
+    FGASCompactVertexHeader CompactHeader;
+    GASArray<FGASVector3> CompactPositions;
+    GASArray<FGASCompactShading> CompactShading;
+    GASArray<uint8_t> CompactSkin;
 
     bool MeshHasSkin = false;
-};
\ No newline at end of file
+};
+
+// 5. 顶点动画纹理 (VAT)：离线蒙皮得到的逐帧顶点位置/法线，远景群体直接采样，运行时无需骨骼计算
+class GASVertexAnimation : public GASAsset
+{
+public:
+    GASVertexAnimation()
+    {
+        BaseHeader.AssetType = EGASAssetType::VertexAnimation;
+    }
+
+    int32_t GetNumVertices() const { return (int32_t)VATHeader.NumVertices; }
+    int32_t GetNumFrames() const { return (int32_t)VATHeader.NumFrames; }
+    int32_t GetNumClips() const { return Clips.Num(); }
+
+    // 按动画 GUID 查找片段序号，找不到返回 -1
+    int32_t FindClip(uint64_t AnimationGUID) const
+    {
+        for (int32_t i = 0; i < Clips.Num(); ++i)
+        {
+            if (Clips[i].AnimationGUID == AnimationGUID) return i;
+        }
+        return -1;
+    }
+
+    // 纹理中第 Frame 帧第 Vertex 个顶点的纹素
+    const FGASVATTexel& GetTexel(uint32_t Frame, uint32_t Vertex) const
+    {
+        return Texels[(int32_t)((size_t)Frame * VATHeader.NumVertices + Vertex)];
+    }
+
+public:
+    FGASVATHeader VATHeader;
+
+    GASArray<FGASVATClip> Clips;
+
+    // VAT 顶点 -> 源 Mesh 顶点 (UV 等静态属性仍从 Mesh 读取)
+    GASArray<uint32_t> SourceVertices;
+
+    // 按材质划分的区间与重映射到 VAT 顶点的索引
+    GASArray<FGASSubMesh> Sections;
+    GASArray<uint32_t> Indices;
+
+    // TextureWidth * TextureHeight 个纹素，最后一行不足部分补零
+    GASArray<FGASVATTexel> Texels;
+};
+
+// 6. 重定向表：离线由两副骨骼求得，运行时一次线性遍历即可把源骨骼上采样的姿态转换到目标骨骼，动画无需按骨骼重复导入
+class GASRetargetMap : public GASAsset
+{
+public:
+    GASRetargetMap()
+    {
+        BaseHeader.AssetType = EGASAssetType::Retarget;
+    }
+
+    uint64_t GetSourceSkeletonGUID() const { return RetargetHeader.SourceSkeletonGUID; }
+    uint64_t GetTargetSkeletonGUID() const { return RetargetHeader.TargetSkeletonGUID; }
+    int32_t GetNumBones() const { return Bones.Num(); }
+    int32_t GetNumSourceBones() const { return (int32_t)RetargetHeader.NumSourceBones; }
+
+public:
+    FGASRetargetHeader RetargetHeader;
+
+    // 按目标骨骼顺序排列
+    GASArray<FGASRetargetBone> Bones;
+};
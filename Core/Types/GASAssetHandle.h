@@ -0,0 +1,62 @@
+﻿#pragma once
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include "GASAsset.h"
+
+// 资产槽：缓存中每个 GUID 对应一个槽，热重载时只替换槽里的资产指针，所有句柄自动看到新数据
+struct FGASAssetSlot
+{
+    uint64_t GUID = 0;
+
+    // 版本号：每次热重载 +1，句柄据此判断数据是否已变化
+    std::atomic<uint32_t> Version{ 0 };
+
+    // 读取当前资产 (可跨线程)
+    std::shared_ptr<GASAsset> Load() const { return std::atomic_load(&Asset); }
+
+    // 替换资产并递增版本号，只应在帧边界由 GASAssetManager 调用
+    void Swap(const std::shared_ptr<GASAsset>& NewAsset)
+    {
+        std::atomic_store(&Asset, NewAsset);
+        Version.fetch_add(1, std::memory_order_release);
+    }
+
+private:
+    std::shared_ptr<GASAsset> Asset;
+};
+
+// 版本化资产句柄：持有槽而不是资产本身，热重载后无需重新获取
+template <typename T>
+class TGASAssetHandle
+{
+public:
+    TGASAssetHandle() = default;
+
+    explicit TGASAssetHandle(std::shared_ptr<FGASAssetSlot> InSlot)
+        : Slot(std::move(InSlot))
+    {
+        if (Slot) SeenVersion = Slot->Version.load(std::memory_order_acquire);
+    }
+
+    bool IsValid() const { return Slot && Slot->Load() != nullptr; }
+
+    uint64_t GetGUID() const { return Slot ? Slot->GUID : 0; }
+
+    // 获取当前最新资产 (返回 shared_ptr，调用方在本帧内持有即可保证数据不被释放)
+    std::shared_ptr<T> Get() const
+    {
+        return Slot ? std::static_pointer_cast<T>(Slot->Load()) : nullptr;
+    }
+
+    uint32_t GetVersion() const { return Slot ? Slot->Version.load(std::memory_order_acquire) : 0; }
+
+    // 自上次 Acknowledge 以来资产是否被重载过 (用于重建 GPU 缓冲等派生数据)
+    bool HasChanged() const { return GetVersion() != SeenVersion; }
+
+    void Acknowledge() { SeenVersion = GetVersion(); }
+
+private:
+    std::shared_ptr<FGASAssetSlot> Slot;
+    uint32_t SeenVersion = 0;
+};
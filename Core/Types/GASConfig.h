@@ -11,6 +11,9 @@ namespace GAS_CONFIG
     // 数据库文件路径：SQLite 数据库文件存放的位置。
     constexpr const char* DATABASE_PATH = "Assets\\GAS_Cache\\Metadata.db";
 
+    // 运行时元数据索引：由数据库导出的只读 GUID 查找表，运行时无需打开数据库
+    constexpr const char* METADATA_INDEX_PATH = "Assets\\GAS_Cache\\Metadata.gasidx";
+
     // 导入源文件临时目录 (可选，用于存储导入的原始文件备份)
     constexpr const char* SOURCE_ARCHIVE_PATH = "Assets\\GAS_Cache\\Sources\\";
 
@@ -24,4 +27,10 @@ namespace GAS_CONFIG
 constexpr float DEFAULT_ANIMATION_FPS = 30.0f;
 
 // GPU蒙皮最大骨骼数量
-constexpr uint32_t MAX_GPU_BONES = 128; // 常见限制，可根据目标硬件调整
\ No newline at end of file
+constexpr uint32_t MAX_GPU_BONES = 128; // 常见限制，可根据目标硬件调整
+
+// 元数据库被其他连接锁定时的等待上限 (毫秒)，超时后 BeginBatch/写入返回失败
+constexpr int32_t METADATA_DB_BUSY_TIMEOUT_MS = 5000;
+
+// 热重载：监视 BINARY_CACHE_PATH 的轮询间隔 (毫秒)
+constexpr uint32_t HOT_RELOAD_POLL_INTERVAL_MS = 500;
@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include <cstdint>
 #include <cstring>
+#include <string_view>
+#include <type_traits>
 #include "GASEnums.h" 
 
 
@@ -8,13 +10,42 @@
 const uint32_t GAS_ASSET_MAGIC = 0x20534147;
 
 // 文件版本号
-static const uint32_t GAS_FILE_VERSION = 1;
+// 1: 初始格式
+// 2: Header 保留字段清零并启用标志位，Mesh 可附带紧凑顶点流
+// 3: 骨骼定义附带 64 位名称哈希
+// 4: 逆绑定矩阵改为列向量布局的 3x4 (FGASMatrix3x4)
+static const uint32_t GAS_FILE_VERSION = 4;
 
 // 最大骨骼名称长度 
 static const int32_t GAS_MAX_BONE_NAME_LEN = 64;
 
 //最大影响骨骼数
 static const int32_t MAX_BONE_INFLUENCES = 8;
+
+// 骨骼按深度分层时可记录的最大层数 (层偏移存放在 FGASSkeletonHeader 中)
+static const int32_t GAS_MAX_SKELETON_LEVELS = 20;
+
+// 动画事件名最大长度 (含结尾 0)
+static const int32_t GAS_MAX_EVENT_NAME_LEN = 32;
+
+// 每个 Mesh 实际使用的影响数只能是 1/2/4/8，蒙皮内核按此做编译期特化
+inline bool IsValidInfluenceCount(uint32_t Count)
+{
+    return Count == 1 || Count == 2 || Count == 4 || Count == (uint32_t)MAX_BONE_INFLUENCES;
+}
+
+// 把运行时影响数分发为编译期常量：Func(std::integral_constant<int32_t, N>)
+template<typename FuncType>
+inline void DispatchInfluenceCount(uint32_t Count, FuncType&& Func)
+{
+    switch (Count)
+    {
+    case 1: Func(std::integral_constant<int32_t, 1>()); break;
+    case 2: Func(std::integral_constant<int32_t, 2>()); break;
+    case 4: Func(std::integral_constant<int32_t, 4>()); break;
+    default: Func(std::integral_constant<int32_t, MAX_BONE_INFLUENCES>()); break;
+    }
+}
  
 struct FGASVector3
 {
@@ -97,6 +128,24 @@ struct FGASMatrix4x4
     }
 };
 
+// 仿射矩阵 (列向量布局，与 GASMath 一致)：省略恒为 (0, 0, 0, 1) 的最后一行，按行存放，M[r][3] 为平移
+// 骨骼与蒙皮矩阵用此格式，比 4x4 少 25% 的内存与上传带宽；48 字节，不额外对齐，放进文件结构时不产生填充
+struct FGASMatrix3x4
+{
+    float M[3][4];
+
+    FGASMatrix3x4()
+    {
+        SetIdentity();
+    }
+
+    void SetIdentity()
+    {
+        std::memset(M, 0, sizeof(M));
+        M[0][0] = M[1][1] = M[2][2] = 1.0f;
+    }
+};
+
 // 内存大小: 12 + 16 + 12 = 40 Bytes
 struct FGASTransform
 {
@@ -144,29 +193,29 @@ struct FGASSkinVertex
 //通用资产头文件 所有 .gas 文件的前 48字节都是这个结构
 struct FGASAssetHeader
 {
-    uint32_t Magic;         // [0-3]   校验码 "GAS/"
-    uint32_t Version;       // [4-7]   文件版本号
+    uint32_t Magic = 0;         // [0-3]   校验码 "GAS/"
+    uint32_t Version = GAS_FILE_VERSION; // [4-7]   文件版本号
 
     // 资产本身的 GUID
-    uint64_t AssetGUID;     // [8-15]  8字节对齐
+    uint64_t AssetGUID = 0;     // [8-15]  8字节对齐
 
     // 资产类型
-    EGASAssetType AssetType; // [16-19]
+    EGASAssetType AssetType = EGASAssetType::Unknown; // [16-19]
 
     // 通用标志位 (Bitmask)
-    uint32_t Flags;         // [20-23]
+    uint32_t Flags = 0;         // [20-23]
 
     // 头部总大小 读取器应根据此值跳转到数据区，而不是 
-    uint32_t HeaderSize;    // [24-27]
+    uint32_t HeaderSize = 0;    // [24-27]
 
     // 数据区大小 (字节) Header 之后紧跟的数据体长度，用于快速内存分配
-    uint32_t DataSize;      // [28-31]
+    uint32_t DataSize = 0;      // [28-31]
 
     // 预留空间，保证 Header 总大小对齐到 64 字节 (Cache Line Friendly)
     // 当前已用 32 字节，剩余 32 字节
-    uint64_t XXHash64;      // [32-39]
+    uint64_t XXHash64 = 0;      // [32-39]
 
-    uint32_t Reserved[2];   // [40-47]
+    uint32_t Reserved[2] = { 0, 0 };   // [40-47]
 };
 
 //骨骼资产：48+48字节
@@ -174,24 +223,31 @@ struct FGASSkeletonHeader
 {
     // 骨骼数量
     uint32_t BoneCount;
-    uint32_t BonesReserved[11];
+
+    // 按深度分层 (Version >= 2)：第 L 层骨骼为 [LevelOffsets[L], LevelOffsets[L + 1])，每根骨骼的父骨骼都在上一层
+    // NumLevels 为 0 表示未分层 (旧文件、层数超过 GAS_MAX_SKELETON_LEVELS 或骨骼数超过 uint16)
+    uint16_t NumLevels;
+    uint16_t LevelOffsets[GAS_MAX_SKELETON_LEVELS + 1];
 };
 // 骨骼文件的二进制布局逻辑：[FGASSkeletonHeader (96bytes)] +[FGASBoneDefinition * BoneCount]
 
-//128字节
+//168字节
 struct FGASBoneDefinition
 {
     char Name[GAS_MAX_BONE_NAME_LEN];
     int32_t ParentIndex;
 
     // 蒙皮用逆绑定矩阵 (Inverse Bind Pose Matrix)
-    // 作用：将顶点从模型空间变换到骨骼局部空间
-    FGASMatrix4x4 InverseBindMatrix;
+    // 作用：将顶点从模型空间变换到骨骼局部空间 (列向量布局，蒙皮矩阵 = Global * InverseBindMatrix)
+    FGASMatrix3x4 InverseBindMatrix;
 
     // 局部绑定姿态 (Local Bind Pose)
     // 作用：默认姿态，相对于父骨骼的相对变换
     FGASTransform LocalBindPose;
     float reverse = 0.0;
+
+    // 规范化名称的 64 位哈希 (GASHashBoneName)，导入时计算并随文件保存，用于无分配的名称查找
+    uint64_t NameHash = 0;
 };
 
 // 动画资产header 48+24+24=96字节
@@ -205,7 +261,11 @@ struct FGASAnimationHeader
     uint32_t TrackCount;    // 轨道数 (通常等于骨骼数)
     float FrameRate;        // 帧率
     float Duration;         // 时长
-    uint32_t AniReserved[6];
+    uint32_t NumBoundsTracks;   // 动画包围盒轨道数 (Version >= 2)，数据紧跟帧数据
+    EGASAdditiveType AdditiveType;  // 非 None 时帧数据为相对参考姿态的差值 (Version >= 2)
+    uint32_t NumRootMotionKeys; // 根运动关键帧数 0 或 FrameCount (Version >= 2)，数据紧跟包围盒数据
+    uint32_t NumEvents;         // 事件数 (Version >= 2)，按时间升序，数据紧跟根运动曲线
+    uint32_t AniReserved[2];
 };
 
 //单帧数据 //40字节
@@ -214,6 +274,8 @@ struct FGASAnimTrackData
     FGASTransform LocalTransform;
 };
 // 动画文件的二进制布局逻辑：[FGASAnimationHeader] [FGASAnimTrackData * (FrameCount * TrackCount)] 
+// [FGASAnimBoundsTrack * NumBoundsTracks] [uint32 NumBlocks] [FGASAnimBoundsBlock * NumBlocks] (NumBoundsTracks > 0 时)
+// [FGASRootMotionKey * NumRootMotionKeys] [FGASAnimEvent * NumEvents]
 // 数据排列顺序：[Frame0_Bone0, Frame0_Bone1...], [Frame1_Bone0...]
 
 // Mesh 专属头部信息48+48字节
@@ -222,9 +284,83 @@ struct FGASMeshHeader
     uint32_t NumVertices = 0;
     uint32_t NumIndices = 0;
     FGASAABB AABB;
-    uint32_t AniReserved[4];
+    uint32_t MeshFlags = 0;        // EGASMeshFlags (Version >= 2)
+    uint32_t InfluenceCount = 0;   // 每顶点骨骼影响数 1/2/4/8，0 表示未分析 (按 MAX_BONE_INFLUENCES 处理)
+    uint32_t NumSubMeshes = 0;     // FGASSubMesh 数量，紧跟索引数据
+    uint32_t NumLODs = 0;          // 额外 LOD 数 (不含 LOD0)，数据紧跟 SubMesh
+};
+
+// 顶点动画纹理 (VAT) 头部
+// 纹理按行优先展开：第 Frame 帧第 Vertex 个顶点的纹素序号 = Frame * NumVertices + Vertex，坐标 = (序号 % TextureWidth, 序号 / TextureWidth)
+struct FGASVATHeader
+{
+    uint64_t SourceMeshGUID = 0;
+    uint32_t NumVertices = 0;      // 每帧顶点数 (烘焙所用 LOD 引用的顶点)
+    uint32_t NumFrames = 0;        // 所有片段的总帧数
+    uint32_t NumClips = 0;
+    uint32_t NumSections = 0;
+    uint32_t NumIndices = 0;       // 重映射到 VAT 顶点的索引数
+    uint32_t LODIndex = 0;         // 烘焙所用的 Mesh LOD
+    uint32_t TextureWidth = 0;
+    uint32_t TextureHeight = 0;
+    FGASAABB PositionBounds;       // 位置量化范围 (所有片段的并集)
+};
+// VAT 文件的二进制布局逻辑：[FGASVATHeader] [FGASVATClip * NumClips] [uint32 * NumVertices 源顶点]
+// [FGASSubMesh * NumSections] [uint32 * NumIndices] [FGASVATTexel * TextureWidth * TextureHeight]
+
+// 重定向表头部：把 Source 骨骼上采样的局部姿态转换为 Target 骨骼的局部姿态
+struct FGASRetargetHeader
+{
+    uint64_t SourceSkeletonGUID = 0;
+    uint64_t TargetSkeletonGUID = 0;
+    uint32_t NumBones = 0;          // 目标骨骼数
+    uint32_t NumSourceBones = 0;    // 源骨骼数 (运行时校验输入姿态长度)
+    uint32_t NumMappedBones = 0;    // 找到对应源骨骼的目标骨骼数
+    uint32_t Reserved = 0;
+};
+// 重定向文件的二进制布局逻辑：[FGASRetargetHeader] [FGASRetargetBone * NumBones]
+
+// 紧凑顶点：着色流 16 字节 (法线/切线八面体编码 snorm16，UV half)
+struct FGASCompactShading
+{
+    int16_t Normal[2];
+    int16_t Tangent[2];
+    uint16_t UV[2];
+    int16_t TangentSign;   // 副切线方向 +1/-1：B = cross(N, T) * Sign
+    uint16_t Padding;
 };
 
+// 紧凑顶点流头部 16 字节
+// 蒙皮流每顶点布局：[BoneIndex * InfluenceCount (8/16 位)][Weight unorm8 * InfluenceCount]，按 4 字节对齐
+struct FGASCompactVertexHeader
+{
+    uint32_t NumVertices = 0;
+    uint8_t InfluenceCount = 0;
+    uint8_t BoneIndexBytes = 0;  // 1 或 2
+    uint16_t SkinStride = 0;     // 蒙皮流每顶点字节数
+    uint32_t Reserved[2] = { 0, 0 };
+};
+// 紧凑 Mesh 布局：[FGASCompactVertexHeader][Position float3 * N][FGASCompactShading * N][SkinStride * N]
+
+// 骨骼名称哈希 (FNV-1a 64)：边遍历边按 NormalizeBoneName 的规则规范化 (去掉命名空间前缀、去空白、ASCII 转小写)，
+// 前缀取到最后一个 ':' 为止，保证对规范化前后的名称结果相同；只取前 GAS_MAX_BONE_NAME_LEN - 1 个有效字符，全程不分配内存
+inline uint64_t GASHashBoneName(std::string_view Name)
+{
+    const size_t ColonPos = Name.rfind(':');
+    if (ColonPos != std::string_view::npos) Name.remove_prefix(ColonPos + 1);
+
+    uint64_t Hash = 14695981039346656037ULL;
+    int32_t Length = 0;
+    for (char c : Name)
+    {
+        if (c == ' ' || (c >= '\t' && c <= '\r')) continue;
+        if (c >= 'A' && c <= 'Z') c = (char)(c - 'A' + 'a');
+        if (++Length >= GAS_MAX_BONE_NAME_LEN) break;
+        Hash = (Hash ^ (uint8_t)c) * 1099511628211ULL;
+    }
+    return Hash;
+}
+
 //设置骨骼名称
 inline void SetGASBoneName(FGASBoneDefinition& BoneDef, const char* InName)
 {
@@ -240,6 +376,7 @@ inline void SetGASBoneName(FGASBoneDefinition& BoneDef, const char* InName)
         // 如果传入空指针，将名字置为空字符串
         BoneDef.Name[0] = '\0';
     }
+    BoneDef.NameHash = GASHashBoneName(BoneDef.Name);
 }
 
 //设置父骨骼索引
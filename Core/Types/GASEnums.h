@@ -8,10 +8,37 @@ enum class EGASAssetType : uint32_t
     Skeleton = 1,   // 骨骼
     Animation = 2,  // 动画
     Mesh = 3,       // 静态网格
+    VertexAnimation = 4,    // 顶点动画纹理 (VAT)
+    Retarget = 5,           // 骨骼间重定向表
 
 };
 
 
+// Mesh 标志位 (FGASMeshHeader::MeshFlags)
+enum class EGASMeshFlags : uint32_t
+{
+    None = 0,
+    CompactVertices = 1 << 0,   // 附带紧凑顶点流
+    Index16 = 1 << 1,           // 索引为 uint16_t (Indices16)
+    Meshlets = 1 << 2,          // 附带 Meshlet 数据
+};
+
+// 叠加动画的参考姿态 (FGASAnimationHeader::AdditiveType)
+// 叠加帧 = 参考姿态到该帧的差值：平移相减、旋转 Inverse(Ref) * Pose、缩放相除
+enum class EGASAdditiveType : uint32_t
+{
+    None = 0,           // 普通 (绝对局部姿态)
+    BindPose = 1,       // 相对骨骼绑定姿态
+    FirstFrame = 2,     // 相对片段第一帧
+};
+
+// 重定向时目标骨骼平移的来源
+enum class EGASRetargetTranslation : uint32_t
+{
+    Skeleton = 0,           // 使用目标骨骼的绑定平移 (只重定向旋转)
+    AnimationScaled = 1,    // 使用源动画平移，转换到目标父骨骼空间并按骨骼长度比例缩放 (根骨骼/骨盆)
+};
+
 //导入结果/错误码
 enum class EGASImportResult : uint8_t
 {
@@ -40,4 +67,12 @@ enum class EGASLoopMode : uint8_t
 enum class EGASTextureFormat : uint8_t
 {
     RGBA_Float32, RGBA_Half16, RGB_8_Unorm
+};
+
+// 元数据库写入同步级别 (对应 SQLite PRAGMA synchronous)
+enum class EGASDBSyncMode : uint8_t
+{
+    Off = 0,    // 不等待落盘，最快，断电可能丢失最近事务
+    Normal = 1, // WAL 模式下推荐：只在检查点时同步
+    Full = 2    // 每次提交都同步
 };
\ No newline at end of file
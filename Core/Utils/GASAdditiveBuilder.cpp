@@ -0,0 +1,87 @@
+﻿#include "GASAdditiveBuilder.h"
+#include <algorithm>
+#include <cmath>
+#include "GASMath.h"
+#include "GASLogging.h"
+#include "GASSkeletonTopology.h"
+
+static float SafeDivide(float A, float B)
+{
+    return std::fabs(B) > GASMath::SMALL_NUMBER ? A / B : 1.0f;
+}
+
+FGASTransform GASAdditiveBuilder::ComputeDelta(const FGASTransform& Reference, const FGASTransform& Pose)
+{
+    FGASTransform Delta;
+    Delta.Translation = GASMath::Subtract(Pose.Translation, Reference.Translation);
+    Delta.Rotation = GASMath::Normalize(GASMath::Multiply(GASMath::Conjugate(Reference.Rotation), Pose.Rotation));
+    Delta.Scale = FGASVector3(SafeDivide(Pose.Scale.X, Reference.Scale.X), SafeDivide(Pose.Scale.Y, Reference.Scale.Y), SafeDivide(Pose.Scale.Z, Reference.Scale.Z));
+
+    // 差值旋转取 W >= 0 的一半，运行时与单位四元数插值时走最短路径
+    if (Delta.Rotation.W < 0.0f)
+    {
+        Delta.Rotation = FGASQuaternion(-Delta.Rotation.X, -Delta.Rotation.Y, -Delta.Rotation.Z, -Delta.Rotation.W);
+    }
+    return Delta;
+}
+
+bool GASAdditiveBuilder::GetReferencePose(const GASAnimation* Animation, const GASSkeleton* Skeleton, EGASAdditiveType Type, std::vector<FGASTransform>& OutPose)
+{
+    if (!Animation || Animation->GetNumFrames() == 0) return false;
+
+    const int32_t NumTracks = (int32_t)Animation->AnimHeader.TrackCount;
+    switch (Type)
+    {
+    case EGASAdditiveType::BindPose:
+        if (!Skeleton || Skeleton->GetNumBones() != NumTracks)
+        {
+            GAS_LOG_ERROR("AdditiveBuilder: %s needs a skeleton with %d bones for a bind pose reference", Animation->AssetName.c_str(), NumTracks);
+            return false;
+        }
+        return GASSkeletonTopology::ComputeBindPose(Skeleton, OutPose);
+
+    case EGASAdditiveType::FirstFrame:
+    {
+        const FGASTransform* Frame0 = Animation->GetTransform(0, 0);
+        OutPose.assign(Frame0, Frame0 + NumTracks);
+        return true;
+    }
+
+    default:
+        return false;
+    }
+}
+
+bool GASAdditiveBuilder::MakeAdditive(GASAnimation* Animation, const GASSkeleton* Skeleton, EGASAdditiveType Type)
+{
+    if (!Animation || Type == EGASAdditiveType::None) return false;
+    if (Animation->IsAdditive())
+    {
+        GAS_LOG_WARN("AdditiveBuilder: %s is already additive", Animation->AssetName.c_str());
+        return false;
+    }
+    if (Animation->BoundsTracks.Num() > 0)
+    {
+        GAS_LOG_ERROR("AdditiveBuilder: %s has animated bounds, remove them before converting", Animation->AssetName.c_str());
+        return false;
+    }
+
+    std::vector<FGASTransform> Reference;
+    if (!GetReferencePose(Animation, Skeleton, Type, Reference)) return false;
+
+    const int32_t NumTracks = (int32_t)Animation->AnimHeader.TrackCount;
+    const int32_t NumFrames = Animation->GetNumFrames();
+    for (int32_t f = 0; f < NumFrames; ++f)
+    {
+        FGASAnimTrackData* Frame = Animation->Tracks.GetData() + (size_t)f * NumTracks;
+        for (int32_t b = 0; b < NumTracks; ++b)
+        {
+            Frame[b].LocalTransform = ComputeDelta(Reference[b], Frame[b].LocalTransform);
+        }
+    }
+
+    Animation->AnimHeader.AdditiveType = Type;
+    GAS_LOG("AdditiveBuilder: %s converted to additive (%s reference)", Animation->AssetName.c_str(),
+        Type == EGASAdditiveType::BindPose ? "bind pose" : "first frame");
+    return true;
+}
@@ -0,0 +1,19 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+#include "../Types/GASAsset.h"
+
+// 把普通动画转换为叠加动画：每帧减去参考姿态，运行时由 GASPoseBlending::ApplyAdditive 叠加到任意基础姿态
+class GASAdditiveBuilder
+{
+public:
+    // 取参考姿态 (BindPose 由逆绑定矩阵求得，FirstFrame 为动画第一帧)，OutPose 长度为轨道数
+    static bool GetReferencePose(const GASAnimation* Animation, const GASSkeleton* Skeleton, EGASAdditiveType Type, std::vector<FGASTransform>& OutPose);
+
+    // 原地转换并写入 AnimHeader.AdditiveType；已是叠加动画或带有包围盒轨道时失败 (叠加姿态不能直接蒙皮)
+    // 调用方负责之后重新计算 XXHash
+    static bool MakeAdditive(GASAnimation* Animation, const GASSkeleton* Skeleton, EGASAdditiveType Type);
+
+    // 单个变换的差值：平移相减、旋转 Inverse(Ref) * Pose、缩放相除
+    static FGASTransform ComputeDelta(const FGASTransform& Reference, const FGASTransform& Pose);
+};
@@ -0,0 +1,259 @@
+﻿#include "GASAnimBoundsBaker.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+#include "GASMath.h"
+#include "GASLogging.h"
+#include "GASVertexCompression.h"
+
+// 参与蒙皮的顶点：位置 + 非零影响 (按 InfluenceCount 定长存放，权重为 0 的槽位跳过)
+struct FGASBoundsSourceVertices
+{
+    int32_t InfluenceCount = MAX_BONE_INFLUENCES;
+    std::vector<FGASVector3> Positions;
+    std::vector<uint32_t> Bones;
+    std::vector<float> Weights;
+};
+
+static void ResetBox(FGASAABB& Box)
+{
+    Box.Min = FGASVector3(FLT_MAX, FLT_MAX, FLT_MAX);
+    Box.Max = FGASVector3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+}
+
+static void ExpandBox(FGASAABB& Box, const FGASVector3& P)
+{
+    Box.Min = FGASVector3(std::min(Box.Min.X, P.X), std::min(Box.Min.Y, P.Y), std::min(Box.Min.Z, P.Z));
+    Box.Max = FGASVector3(std::max(Box.Max.X, P.X), std::max(Box.Max.Y, P.Y), std::max(Box.Max.Z, P.Z));
+}
+
+static void ExpandBox(FGASAABB& Box, const FGASAABB& Other)
+{
+    ExpandBox(Box, Other.Min);
+    ExpandBox(Box, Other.Max);
+}
+
+// 收集顶点 (完整顶点或紧凑流)
+static bool GatherVertices(const GASMesh* Mesh, int32_t NumBones, FGASBoundsSourceVertices& Out)
+{
+    const int32_t NumVertices = Mesh->GetNumVertices();
+    const bool bFullVertices = Mesh->Vertices.Num() > 0;
+    if (NumVertices <= 0 || (!bFullVertices && !Mesh->HasCompactVertices())) return false;
+
+    const int32_t N = Mesh->GetInfluenceCount();
+    Out.InfluenceCount = N;
+    Out.Positions.resize(NumVertices);
+    Out.Bones.resize((size_t)NumVertices * N);
+    Out.Weights.resize((size_t)NumVertices * N);
+
+    FGASSkinVertex Decoded;
+    for (int32_t v = 0; v < NumVertices; ++v)
+    {
+        const FGASSkinVertex* Vertex = &Decoded;
+        if (bFullVertices) Vertex = &Mesh->Vertices[v];
+        else GASVertexCompression::DecodeVertex(Mesh, v, Decoded);
+
+        Out.Positions[v] = Vertex->Position;
+        for (int32_t j = 0; j < N; ++j)
+        {
+            uint32_t Bone = Vertex->BoneIndices.Indices[j];
+            float Weight = Vertex->BoneWeights.Weights[j];
+            if (Weight > 0.0f && Bone >= (uint32_t)NumBones)
+            {
+                GAS_LOG_ERROR("BakeBounds: Vertex %d references bone %u (skeleton has %d)", v, Bone, NumBones);
+                return false;
+            }
+            Out.Bones[(size_t)v * N + j] = Bone;
+            Out.Weights[(size_t)v * N + j] = Weight;
+        }
+    }
+    return true;
+}
+
+// 计算第 Frame 帧与下一帧按 Alpha 插值的蒙皮矩阵 (列向量布局：Skin = Global * InverseBind)
+static void EvaluateSkinMatrices(const GASSkeleton* Skeleton, const GASAnimation* Animation, int32_t Frame, float Alpha,
+    std::vector<FGASMatrix3x4>& Global, std::vector<FGASMatrix3x4>& OutSkin)
+{
+    const int32_t NumBones = Skeleton->GetNumBones();
+    const int32_t NextFrame = std::min(Frame + 1, Animation->GetNumFrames() - 1);
+
+    for (int32_t b = 0; b < NumBones; ++b)
+    {
+        FGASTransform Local = *Animation->GetTransform(Frame, b);
+        if (Alpha > 0.0f)
+        {
+            const FGASTransform& Next = *Animation->GetTransform(NextFrame, b);
+            Local.Translation = GASMath::Add(GASMath::Scale(Local.Translation, 1.0f - Alpha), GASMath::Scale(Next.Translation, Alpha));
+            Local.Scale = GASMath::Add(GASMath::Scale(Local.Scale, 1.0f - Alpha), GASMath::Scale(Next.Scale, Alpha));
+            Local.Rotation = GASMath::Slerp(Local.Rotation, Next.Rotation, Alpha);
+        }
+
+        const FGASMatrix3x4 LocalMatrix = GASMath::ToMatrix3x4(Local);
+        const int32_t Parent = Skeleton->GetParentIndex(b);
+        Global[b] = (Parent >= 0) ? GASMath::Multiply(Global[Parent], LocalMatrix) : LocalMatrix;
+        OutSkin[b] = GASMath::Multiply(Global[b], Skeleton->GetInverseBindMatrix(b));
+    }
+}
+
+// 蒙皮所有顶点并扩展包围盒
+static void SkinBounds(const FGASBoundsSourceVertices& Source, const std::vector<FGASMatrix3x4>& Skin, FGASAABB& Box)
+{
+    const int32_t N = Source.InfluenceCount;
+    const int32_t NumVertices = (int32_t)Source.Positions.size();
+    for (int32_t v = 0; v < NumVertices; ++v)
+    {
+        const FGASVector3& P = Source.Positions[v];
+        const uint32_t* Bones = &Source.Bones[(size_t)v * N];
+        const float* Weights = &Source.Weights[(size_t)v * N];
+
+        FGASVector3 Skinned;
+        float TotalWeight = 0.0f;
+        for (int32_t j = 0; j < N; ++j)
+        {
+            if (Weights[j] <= 0.0f) continue;
+            Skinned = GASMath::Add(Skinned, GASMath::Scale(GASMath::TransformPosition(Skin[Bones[j]], P), Weights[j]));
+            TotalWeight += Weights[j];
+        }
+        // 无权重的顶点保持绑定位置
+        ExpandBox(Box, TotalWeight > 0.0f ? Skinned : P);
+    }
+}
+
+// 量化到 [0, 65535]，Min 向下、Max 向上各多留一档，抵消解码时的浮点误差
+static uint16_t QuantizeBound(float Value, float Lo, float Extent, bool bUpper)
+{
+    if (Extent <= 0.0f) return bUpper ? 0xFFFF : 0;
+    float Q = (Value - Lo) / Extent * 65535.0f;
+    float Rounded = bUpper ? std::ceil(Q) + 1.0f : std::floor(Q) - 1.0f;
+    return (uint16_t)std::min(std::max(Rounded, 0.0f), 65535.0f);
+}
+
+bool GASAnimBoundsBaker::BakeBounds(const GASMesh* Mesh, const GASSkeleton* Skeleton, GASAnimation* Animation, uint64_t MeshGUID, const FGASAnimBoundsSettings& Settings)
+{
+    if (!Mesh || !Skeleton || !Animation) return false;
+    if (!Mesh->MeshHasSkin) return false;
+    if (Animation->IsAdditive())
+    {
+        GAS_LOG_WARN("BakeBounds: Animation %s is additive, bounds need a base pose", Animation->AssetName.c_str());
+        return false;
+    }
+
+    const int32_t NumBones = Skeleton->GetNumBones();
+    const int32_t NumFrames = Animation->GetNumFrames();
+    if (NumBones <= 0 || NumFrames <= 0 || (int32_t)Animation->AnimHeader.TrackCount != NumBones)
+    {
+        GAS_LOG_WARN("BakeBounds: Animation %s does not match skeleton (%u tracks, %d bones)",
+            Animation->AssetName.c_str(), Animation->AnimHeader.TrackCount, NumBones);
+        return false;
+    }
+    for (int32_t b = 0; b < NumBones; ++b)
+    {
+        if (Skeleton->GetParentIndex(b) >= b)
+        {
+            GAS_LOG_ERROR("BakeBounds: Skeleton is not parent-first (bone %d)", b);
+            return false;
+        }
+    }
+
+    FGASBoundsSourceVertices Source;
+    if (!GatherVertices(Mesh, NumBones, Source)) return false;
+
+    // 逐帧包围盒 + 逐帧间隔 (插值姿势) 包围盒
+    std::vector<FGASMatrix3x4> Global(NumBones), Skin(NumBones);
+    std::vector<FGASAABB> FrameBoxes(NumFrames), SegmentBoxes(std::max(NumFrames - 1, 0));
+    const int32_t SubSamples = std::max(Settings.SubSamples, 0);
+
+    for (int32_t f = 0; f < NumFrames; ++f)
+    {
+        ResetBox(FrameBoxes[f]);
+        EvaluateSkinMatrices(Skeleton, Animation, f, 0.0f, Global, Skin);
+        SkinBounds(Source, Skin, FrameBoxes[f]);
+
+        if (f + 1 < NumFrames)
+        {
+            ResetBox(SegmentBoxes[f]);
+            for (int32_t s = 1; s <= SubSamples; ++s)
+            {
+                EvaluateSkinMatrices(Skeleton, Animation, f, (float)s / (float)(SubSamples + 1), Global, Skin);
+                SkinBounds(Source, Skin, SegmentBoxes[f]);
+            }
+        }
+    }
+
+    // 分块：块 b 覆盖帧 [b*K, (b+1)*K] 与其间的所有间隔
+    const int32_t K = std::max(Settings.FramesPerBlock, 1);
+    const int32_t NumBlocks = (NumFrames <= 1) ? 1 : (NumFrames - 1 + K - 1) / K;
+
+    std::vector<FGASAABB> BlockBoxes(NumBlocks);
+    FGASAABB ClipBounds;
+    ResetBox(ClipBounds);
+    for (int32_t b = 0; b < NumBlocks; ++b)
+    {
+        const int32_t FirstFrame = b * K;
+        const int32_t LastFrame = std::min(FirstFrame + K, NumFrames - 1);
+
+        ResetBox(BlockBoxes[b]);
+        for (int32_t f = FirstFrame; f <= LastFrame; ++f) ExpandBox(BlockBoxes[b], FrameBoxes[f]);
+        if (SubSamples > 0)
+        {
+            for (int32_t f = FirstFrame; f < LastFrame; ++f) ExpandBox(BlockBoxes[b], SegmentBoxes[f]);
+        }
+        ExpandBox(ClipBounds, BlockBoxes[b]);
+    }
+
+    RemoveBounds(Animation, MeshGUID);
+
+    FGASAnimBoundsTrack Track;
+    Track.MeshGUID = MeshGUID;
+    Track.FramesPerBlock = (uint32_t)K;
+    Track.FirstBlock = (uint32_t)Animation->BoundsBlocks.Num();
+    Track.NumBlocks = (uint32_t)NumBlocks;
+    Track.ClipBounds = ClipBounds;
+
+    const float Lo[3] = { ClipBounds.Min.X, ClipBounds.Min.Y, ClipBounds.Min.Z };
+    const float Extent[3] = { ClipBounds.Max.X - Lo[0], ClipBounds.Max.Y - Lo[1], ClipBounds.Max.Z - Lo[2] };
+
+    Animation->BoundsBlocks.Reserve(Animation->BoundsBlocks.Num() + NumBlocks);
+    for (const FGASAABB& Box : BlockBoxes)
+    {
+        const float BoxMin[3] = { Box.Min.X, Box.Min.Y, Box.Min.Z };
+        const float BoxMax[3] = { Box.Max.X, Box.Max.Y, Box.Max.Z };
+
+        FGASAnimBoundsBlock Block;
+        for (int a = 0; a < 3; ++a)
+        {
+            Block.Min[a] = QuantizeBound(BoxMin[a], Lo[a], Extent[a], false);
+            Block.Max[a] = QuantizeBound(BoxMax[a], Lo[a], Extent[a], true);
+        }
+        Animation->BoundsBlocks.Add(Block);
+    }
+    Animation->BoundsTracks.Add(Track);
+    Animation->AnimHeader.NumBoundsTracks = (uint32_t)Animation->BoundsTracks.Num();
+
+    return true;
+}
+
+void GASAnimBoundsBaker::RemoveBounds(GASAnimation* Animation, uint64_t MeshGUID)
+{
+    if (!Animation) return;
+
+    for (int32_t i = 0; i < Animation->BoundsTracks.Num(); ++i)
+    {
+        const FGASAnimBoundsTrack Removed = Animation->BoundsTracks[i];
+        if (Removed.MeshGUID != MeshGUID) continue;
+
+        // 删除块区间，后续轨道前移
+        for (uint32_t b = 0; b < Removed.NumBlocks; ++b)
+        {
+            Animation->BoundsBlocks.RemoveAt((int32_t)Removed.FirstBlock);
+        }
+        Animation->BoundsTracks.RemoveAt(i);
+        for (FGASAnimBoundsTrack& Track : Animation->BoundsTracks)
+        {
+            if (Track.FirstBlock > Removed.FirstBlock) Track.FirstBlock -= Removed.NumBlocks;
+        }
+        break;
+    }
+    Animation->AnimHeader.NumBoundsTracks = (uint32_t)Animation->BoundsTracks.Num();
+}
@@ -0,0 +1,22 @@
+﻿#pragma once
+#include <cstdint>
+#include "../Types/GASAsset.h"
+
+// 动画包围盒烘焙参数
+struct FGASAnimBoundsSettings
+{
+    int32_t FramesPerBlock = 4;     // 每块覆盖的帧数，1 为逐帧
+    int32_t SubSamples = 1;         // 相邻帧之间额外采样的插值姿势数 (旋转插值会让顶点走弧线，超出两端帧的包围盒)
+};
+
+// 逐帧蒙皮 Mesh 顶点，烘焙模型空间的动画包围盒到 GASAnimation::BoundsTracks
+class GASAnimBoundsBaker
+{
+public:
+    // 烘焙 (Mesh, Animation) 的包围盒轨道，已存在相同 MeshGUID 的轨道时替换
+    // 顶点优先取完整顶点，已剥离时从紧凑流解码
+    static bool BakeBounds(const GASMesh* Mesh, const GASSkeleton* Skeleton, GASAnimation* Animation, uint64_t MeshGUID, const FGASAnimBoundsSettings& Settings);
+
+    // 移除某个 Mesh 的包围盒轨道
+    static void RemoveBounds(GASAnimation* Animation, uint64_t MeshGUID);
+};
@@ -0,0 +1,84 @@
+﻿#include "GASAnimEventBuilder.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include "GASHashManager.h"
+#include "GASLogging.h"
+
+bool GASAnimEventBuilder::AddEvent(GASAnimation* Animation, float Time, const std::string& Name, float Payload)
+{
+    if (!Animation || Name.empty()) return false;
+    if (Name.size() >= (size_t)GAS_MAX_EVENT_NAME_LEN)
+    {
+        GAS_LOG_WARN("AnimEvent: Name %s is longer than %d characters and will be truncated", Name.c_str(), GAS_MAX_EVENT_NAME_LEN - 1);
+    }
+
+    const float LoopLength = Animation->GetNumFrames() > 1 && Animation->AnimHeader.FrameRate > 0.0f
+        ? (float)(Animation->GetNumFrames() - 1) / Animation->AnimHeader.FrameRate : 0.0f;
+    if (Time < 0.0f || Time > LoopLength)
+    {
+        GAS_LOG_WARN("AnimEvent: %s at %.3fs is outside the clip (%.3fs), clamped", Name.c_str(), Time, LoopLength);
+        Time = std::min(std::max(Time, 0.0f), LoopLength);
+    }
+
+    FGASAnimEvent Event;
+    Event.Time = Time;
+    Event.Payload = Payload;
+    const size_t Length = std::min(Name.size(), (size_t)GAS_MAX_EVENT_NAME_LEN - 1);
+    memcpy(Event.Name, Name.data(), Length);
+    Event.Name[Length] = '\0';
+    Event.NameHash = CalculateXXHash64(Event.Name, Length);
+    Animation->Events.Add(Event);
+    return true;
+}
+
+void GASAnimEventBuilder::SortEvents(GASAnimation* Animation)
+{
+    if (!Animation) return;
+    std::stable_sort(Animation->Events.begin(), Animation->Events.end(), [](const FGASAnimEvent& A, const FGASAnimEvent& B) { return A.Time < B.Time; });
+    Animation->AnimHeader.NumEvents = (uint32_t)Animation->Events.Num();
+}
+
+int32_t GASAnimEventBuilder::LoadSidecar(const std::string& FilePath, const std::vector<std::string>& ClipNames, const std::vector<std::shared_ptr<GASAnimation>>& Animations)
+{
+    std::ifstream File(FilePath);
+    if (!File.is_open())
+    {
+        GAS_LOG_ERROR("AnimEvent: Failed to open %s", FilePath.c_str());
+        return -1;
+    }
+
+    int32_t NumAdded = 0;
+    std::string Line;
+    for (int32_t LineNumber = 1; std::getline(File, Line); ++LineNumber)
+    {
+        std::istringstream Stream(Line);
+        std::string Clip, Name;
+        float Time = 0.0f, Payload = 0.0f;
+        if (!(Stream >> Clip) || Clip[0] == '#') continue;
+        if (!(Stream >> Time >> Name))
+        {
+            GAS_LOG_WARN("AnimEvent: %s:%d is malformed, skipped", FilePath.c_str(), LineNumber);
+            continue;
+        }
+        Stream >> Payload;
+
+        bool bMatched = false;
+        for (size_t i = 0; i < Animations.size(); ++i)
+        {
+            const bool bMatch = Clip == "*" || (i < ClipNames.size() && Clip == ClipNames[i]) || Clip == std::to_string(i);
+            if (!bMatch || !Animations[i]) continue;
+            if (AddEvent(Animations[i].get(), Time, Name, Payload)) ++NumAdded;
+            bMatched = true;
+        }
+        if (!bMatched)
+        {
+            GAS_LOG_WARN("AnimEvent: %s:%d refers to unknown clip %s", FilePath.c_str(), LineNumber, Clip.c_str());
+        }
+    }
+
+    for (const auto& Animation : Animations) SortEvents(Animation.get());
+    GAS_LOG("AnimEvent: %d events loaded from %s", NumAdded, FilePath.c_str());
+    return NumAdded;
+}
@@ -0,0 +1,22 @@
+﻿#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../Types/GASAsset.h"
+
+// 构建动画事件轨道
+// 旁路文件 (与源文件同名、扩展名 .events) 每行一个事件：<片段> <时间(秒)> <事件名> [附加数值]
+// 片段可为 Assimp 动画名、动画序号或 * (所有片段)；# 开头为注释；事件名不含空白
+class GASAnimEventBuilder
+{
+public:
+    // 添加一个事件 (时间钳制到 [0, 循环周期])，之后须调用 SortEvents
+    static bool AddEvent(GASAnimation* Animation, float Time, const std::string& Name, float Payload = 0.0f);
+
+    // 按时间排序 (同一时刻保持添加顺序) 并写入 AnimHeader.NumEvents
+    static void SortEvents(GASAnimation* Animation);
+
+    // 读取旁路文件，ClipNames 与 Animations 一一对应，返回添加的事件数，文件无法读取时返回 -1
+    static int32_t LoadSidecar(const std::string& FilePath, const std::vector<std::string>& ClipNames, const std::vector<std::shared_ptr<GASAnimation>>& Animations);
+};
@@ -11,6 +11,7 @@ GASAssetManager::GASAssetManager() {}
 
 GASAssetManager::~GASAssetManager()
 {
+    DisableHotReload();
     MemoryCache.clear();
 }
 
@@ -35,6 +36,41 @@ bool GASAssetManager::Initialize()
     return true;
 }
 
+bool GASAssetManager::InitializeFromIndex(const std::string& IndexPath)
+{
+    if (!MetadataIndex.Load(IndexPath))
+    {
+        GAS_LOG_ERROR("Failed to load metadata index at %s", IndexPath.c_str());
+        return false;
+    }
+
+    bMetadataIndexStale = false;
+    GAS_LOG("GAS Asset Manager Initialized from index (%u assets).", MetadataIndex.GetNumEntries());
+    return true;
+}
+
+bool GASAssetManager::BuildMetadataIndex(const std::string& IndexPath)
+{
+    // Windows 下无法替换仍在映射中的文件，先解除映射；写完后重新映射新索引
+    std::error_code Ec;
+    const bool bRemap = MetadataIndex.IsLoaded()
+        && (MetadataIndex.GetFilePath() == IndexPath || fs::equivalent(MetadataIndex.GetFilePath(), IndexPath, Ec));
+    if (bRemap) MetadataIndex.Unload();
+
+    const bool bBuilt = GASMetadataIndex::BuildFromStorage(MetadataStorage, IndexPath);
+
+    if (bRemap)
+    {
+        if (!MetadataIndex.Load(IndexPath))
+        {
+            GAS_LOG_WARN("BuildMetadataIndex: failed to remap %s, metadata queries fall back to the database", IndexPath.c_str());
+            return false;
+        }
+        if (bBuilt) bMetadataIndexStale = false;
+    }
+    return bBuilt;
+}
+
 // 资产导入与持久化
 
 uint64_t GASAssetManager::ImportAsset(const std::string& SourceFilePath)
@@ -89,6 +125,13 @@ uint64_t GASAssetManager::ImportAsset(const std::string& SourceFilePath)
     // 生成 GUID 
     uint64_t SkeletonGUID = GenerateGUID64(FolderName);
 
+    // 本次导入产生的所有元数据合并为一个事务提交
+    if (!MetadataStorage.BeginBatch())
+    {
+        GAS_LOG_ERROR("Import aborted: cannot open a metadata transaction for %s", SourceFilePath.c_str());
+        return 0;
+    }
+
     // --- 处理 Skeleton ---
     if (SkeletonAsset)
     {
@@ -112,12 +155,19 @@ uint64_t GASAssetManager::ImportAsset(const std::string& SourceFilePath)
 
             MetadataStorage.RegisterAsset(Metadata);
 
-            std::unique_lock<std::shared_mutex> lock(CacheMutex);
-            MemoryCache[SkeletonGUID] = SkeletonAsset;
+            StoreInCache(SkeletonGUID, SkeletonAsset, FullPath.string());
         }
     }
 
+    // 预先生成 Mesh GUID：动画包围盒以 Mesh GUID 为键，须在保存动画之前烘焙
+    std::vector<uint64_t> MeshGUIDs(MeshAssets.size(), 0);
+    for (size_t i = 0; i < MeshAssets.size(); ++i)
+    {
+        if (MeshAssets[i]) MeshGUIDs[i] = GenerateGUID64(FolderName + "_Mesh_" + MeshAssets[i]->AssetName);
+    }
+
     // --- 处理 Animations ---
+    const FGASImportOptions& ImportOptions = Importer.GetImportOptions();
     for (size_t i = 0; i < AnimationAssets.size(); ++i)
     {
         auto& AnimAsset = AnimationAssets[i];
@@ -129,6 +179,21 @@ uint64_t GASAssetManager::ImportAsset(const std::string& SourceFilePath)
         uint64_t AnimGUID = GenerateGUID64(AnimKey);
         AnimAsset->BaseHeader.AssetGUID = AnimGUID;
         if (AnimAsset->AssetName.empty()) AnimAsset->AssetName = FolderName + "_Anim_" + std::to_string(i);
+        // 导入器解析时骨骼尚未分配 GUID，此处补记目标骨骼，供烘焙时校验
+        if (SkeletonAsset) AnimAsset->AnimHeader.TargetSkeletonGUID = SkeletonGUID;
+
+        // 烘焙各蒙皮 Mesh 在该动画下的包围盒 (叠加动画的姿态不能直接蒙皮，跳过)
+        if (ImportOptions.bBakeAnimatedBounds && SkeletonAsset && !AnimAsset->IsAdditive())
+        {
+            for (size_t m = 0; m < MeshAssets.size(); ++m)
+            {
+                if (!MeshAssets[m] || !MeshAssets[m]->HasSkin()) continue;
+                if (!GASAnimBoundsBaker::BakeBounds(MeshAssets[m].get(), SkeletonAsset.get(), AnimAsset.get(), MeshGUIDs[m], ImportOptions.AnimBoundsSettings))
+                {
+                    GAS_LOG_WARN("Import: Failed to bake bounds of %s for %s", MeshAssets[m]->AssetName.c_str(), AnimAsset->AssetName.c_str());
+                }
+            }
+        }
 
         std::string AnimFileName = std::to_string(AnimGUID) + ".anim.gas";
         fs::path FullPath = TargetFolder / AnimFileName;
@@ -146,14 +211,14 @@ uint64_t GASAssetManager::ImportAsset(const std::string& SourceFilePath)
             Metadata.FileHash = CurrentFileHash;
             MetadataStorage.RegisterAsset(Metadata);
 
-            std::unique_lock<std::shared_mutex> lock(CacheMutex);
-            MemoryCache[AnimGUID] = AnimAsset;
+            StoreInCache(AnimGUID, AnimAsset, FullPath.string());
         }
     }
 
     // --- 处理 Meshes ---
-    for (const auto& MeshAsset : MeshAssets)
+    for (size_t i = 0; i < MeshAssets.size(); ++i)
     {
+        const auto& MeshAsset = MeshAssets[i];
         if (!MeshAsset) continue;
 
         std::string& TexPath = MeshAsset->DiffuseTexturePath;
@@ -193,10 +258,8 @@ uint64_t GASAssetManager::ImportAsset(const std::string& SourceFilePath)
 
             TexPath = "Textures/" + FolderName + "/" + TexFileName;
         }
-        // 生成唯一 Mesh GUID
-        std::string MeshKey = FolderName + "_Mesh_" + MeshAsset->AssetName;
-
-        uint64_t MeshGUID = GenerateGUID64(MeshKey);
+        // 唯一 Mesh GUID (已在处理动画前生成)
+        uint64_t MeshGUID = MeshGUIDs[i];
         MeshAsset->BaseHeader.AssetGUID = MeshGUID;
 
         // 设置骨骼关联
@@ -220,14 +283,21 @@ uint64_t GASAssetManager::ImportAsset(const std::string& SourceFilePath)
             Metadata.Type = static_cast<EGASAssetType>(MeshAsset->BaseHeader.AssetType);
             Metadata.BinaryFilePath = RelativePath;
             Metadata.VerticeCount = MeshAsset->GetNumVertices();
+            Metadata.MeshCount = MeshAsset->SubMeshes.Num();
             Metadata.FileHash = CurrentFileHash;
             MetadataStorage.RegisterAsset(Metadata);
 
-            std::unique_lock<std::shared_mutex> lock(CacheMutex);
-            MemoryCache[MeshGUID] = MeshAsset;
+            StoreInCache(MeshGUID, MeshAsset, FullPath.string());
         }
     }
 
+    if (!MetadataStorage.CommitBatch())
+    {
+        GAS_LOG_ERROR("Failed to commit metadata for %s", SourceFilePath.c_str());
+        return 0;
+    }
+    bMetadataIndexStale = true;
+
     GAS_LOG("Import SUCCESS. Main GUID: %llu,FileNme: %s", ExpectedGUID,GASFileHelper::GetFileName(SourceFilePath).c_str());
 
 
@@ -236,6 +306,12 @@ uint64_t GASAssetManager::ImportAsset(const std::string& SourceFilePath)
 
 // 运行时资产加载与缓存
 std::shared_ptr<GASAsset> GASAssetManager::GetCachedAsset(uint64_t GUID) const
+{
+    std::shared_ptr<FGASAssetSlot> Slot = FindSlot(GUID);
+    return Slot ? Slot->Load() : nullptr;
+}
+
+std::shared_ptr<FGASAssetSlot> GASAssetManager::FindSlot(uint64_t GUID) const
 {
     std::shared_lock<std::shared_mutex> lock(CacheMutex);
     auto It = MemoryCache.find(GUID);
@@ -246,11 +322,175 @@ std::shared_ptr<GASAsset> GASAssetManager::GetCachedAsset(uint64_t GUID) const
     return nullptr;
 }
 
+void GASAssetManager::StoreInCache(uint64_t GUID, const std::shared_ptr<GASAsset>& Asset, const std::string& FilePath)
+{
+    std::error_code Ec;
+    const std::filesystem::file_time_type FileTime = FilePath.empty() ? std::filesystem::file_time_type() : std::filesystem::last_write_time(FilePath, Ec);
+
+    std::unique_lock<std::shared_mutex> lock(CacheMutex);
+    if (!FilePath.empty() && !Ec) CachedFileTimes[GUID] = FileTime;
+    else CachedFileTimes.erase(GUID);
+
+    auto It = MemoryCache.find(GUID);
+    if (It != MemoryCache.end() && It->second->Load())
+    {
+        // 已有实例在使用旧数据，推迟到帧边界统一替换
+        PendingSwaps[GUID] = Asset;
+        return;
+    }
+
+    auto Slot = std::make_shared<FGASAssetSlot>();
+    Slot->GUID = GUID;
+    Slot->Swap(Asset);
+    MemoryCache[GUID] = Slot;
+}
+
 bool GASAssetManager::QueryMetadata(uint64_t GUID, FGASAssetMetadata& OutMetadata) const
 {
+    // 本进程写过数据库后索引可能给出旧路径/哈希，只信任数据库
+    if (MetadataIndex.IsLoaded() && !bMetadataIndexStale && MetadataIndex.QueryAssetByGUID(GUID, OutMetadata))
+    {
+        return true;
+    }
     return MetadataStorage.QueryAssetByGUID(GUID, OutMetadata);
 }
 
+uint64_t GASAssetManager::BakeVertexAnimation(uint64_t MeshGUID, const std::vector<uint64_t>& AnimationGUIDs, const FGASVATSettings& Settings)
+{
+    auto Mesh = std::dynamic_pointer_cast<GASMesh>(LoadAsset(MeshGUID));
+    if (!Mesh || !Mesh->HasSkin())
+    {
+        GAS_LOG_ERROR("BakeVertexAnimation: Mesh %llu is missing or not skinned", MeshGUID);
+        return 0;
+    }
+
+    auto Skeleton = std::dynamic_pointer_cast<GASSkeleton>(LoadAsset(Mesh->SkeletonGUID));
+    if (!Skeleton)
+    {
+        GAS_LOG_ERROR("BakeVertexAnimation: Skeleton %llu not found", Mesh->SkeletonGUID);
+        return 0;
+    }
+
+    // 片段顺序即传入顺序，GUID 由 Mesh 与动画列表决定
+    std::vector<std::shared_ptr<GASAnimation>> Animations;
+    std::vector<const GASAnimation*> AnimationPtrs;
+    std::string VATKey = std::to_string(MeshGUID) + "_VAT";
+    for (uint64_t AnimGUID : AnimationGUIDs)
+    {
+        auto Anim = std::dynamic_pointer_cast<GASAnimation>(LoadAsset(AnimGUID));
+        if (!Anim)
+        {
+            GAS_LOG_ERROR("BakeVertexAnimation: Animation %llu not found", AnimGUID);
+            return 0;
+        }
+        Animations.push_back(Anim);
+        AnimationPtrs.push_back(Anim.get());
+        VATKey += "_" + std::to_string(AnimGUID);
+    }
+
+    auto VAT = std::make_shared<GASVertexAnimation>();
+    if (!GASVATBaker::Bake(Mesh.get(), Skeleton.get(), AnimationPtrs, Settings, VAT.get()))
+    {
+        GAS_LOG_ERROR("BakeVertexAnimation: Failed to bake mesh %llu", MeshGUID);
+        return 0;
+    }
+
+    const uint64_t VATGUID = GenerateGUID64(VATKey);
+    VAT->BaseHeader.AssetGUID = VATGUID;
+    VAT->AssetName = Mesh->AssetName + "_VAT";
+
+    // 与 Mesh 放在同一目录
+    FGASAssetMetadata MeshMeta;
+    if (!QueryMetadata(MeshGUID, MeshMeta))
+    {
+        GAS_LOG_ERROR("BakeVertexAnimation: Metadata for mesh %llu missing", MeshGUID);
+        return 0;
+    }
+    std::string VATFileName = std::to_string(VATGUID) + ".vat.gas";
+    std::string RelativePath = (fs::path(MeshMeta.BinaryFilePath).parent_path() / VATFileName).string();
+    fs::path FullPath = fs::path(GAS_CONFIG::BINARY_CACHE_PATH) / RelativePath;
+
+    if (!GASBinarySerializer::SaveAssetToDisk(VAT.get(), FullPath.string()))
+    {
+        return 0;
+    }
+
+    FGASAssetMetadata Metadata;
+    Metadata.GUID = VATGUID;
+    Metadata.Name = VAT->AssetName;
+    Metadata.Type = EGASAssetType::VertexAnimation;
+    Metadata.BinaryFilePath = RelativePath;
+    Metadata.FileHash = VAT->BaseHeader.XXHash64;
+    Metadata.VerticeCount = VAT->GetNumVertices();
+    Metadata.FrameCount = VAT->GetNumFrames();
+    Metadata.MeshCount = VAT->GetNumClips();
+    for (const FGASVATClip& Clip : VAT->Clips) Metadata.Duration += Clip.Duration;
+    if (!MetadataStorage.RegisterAsset(Metadata))
+    {
+        GAS_LOG_ERROR("BakeVertexAnimation: Failed to register %s", RelativePath.c_str());
+        return 0;
+    }
+    bMetadataIndexStale = true;
+
+    StoreInCache(VATGUID, VAT, FullPath.string());
+    return VATGUID;
+}
+
+uint64_t GASAssetManager::BuildRetargetMap(uint64_t SourceSkeletonGUID, uint64_t TargetSkeletonGUID, const FGASRetargetSettings& Settings)
+{
+    auto Source = std::dynamic_pointer_cast<GASSkeleton>(LoadAsset(SourceSkeletonGUID));
+    auto Target = std::dynamic_pointer_cast<GASSkeleton>(LoadAsset(TargetSkeletonGUID));
+    if (!Source || !Target)
+    {
+        GAS_LOG_ERROR("BuildRetargetMap: Skeleton %llu or %llu not found", SourceSkeletonGUID, TargetSkeletonGUID);
+        return 0;
+    }
+
+    auto Map = std::make_shared<GASRetargetMap>();
+    if (!GASRetargetBaker::Bake(Source.get(), Target.get(), Settings, Map.get()))
+    {
+        GAS_LOG_ERROR("BuildRetargetMap: Failed to map %s -> %s", Source->AssetName.c_str(), Target->AssetName.c_str());
+        return 0;
+    }
+
+    const uint64_t MapGUID = GenerateGUID64(std::to_string(SourceSkeletonGUID) + "_Retarget_" + std::to_string(TargetSkeletonGUID));
+    Map->BaseHeader.AssetGUID = MapGUID;
+    Map->AssetName = Source->AssetName + "_To_" + Target->AssetName;
+
+    // 与目标骨骼放在同一目录
+    FGASAssetMetadata TargetMeta;
+    if (!QueryMetadata(TargetSkeletonGUID, TargetMeta))
+    {
+        GAS_LOG_ERROR("BuildRetargetMap: Metadata for skeleton %llu missing", TargetSkeletonGUID);
+        return 0;
+    }
+    std::string MapFileName = std::to_string(MapGUID) + ".rtg.gas";
+    std::string RelativePath = (fs::path(TargetMeta.BinaryFilePath).parent_path() / MapFileName).string();
+    fs::path FullPath = fs::path(GAS_CONFIG::BINARY_CACHE_PATH) / RelativePath;
+
+    if (!GASBinarySerializer::SaveAssetToDisk(Map.get(), FullPath.string()))
+    {
+        return 0;
+    }
+
+    FGASAssetMetadata Metadata;
+    Metadata.GUID = MapGUID;
+    Metadata.Name = Map->AssetName;
+    Metadata.Type = EGASAssetType::Retarget;
+    Metadata.BinaryFilePath = RelativePath;
+    Metadata.FileHash = Map->BaseHeader.XXHash64;
+    Metadata.BoneCount = Map->GetNumBones();
+    if (!MetadataStorage.RegisterAsset(Metadata))
+    {
+        GAS_LOG_ERROR("BuildRetargetMap: Failed to register %s", RelativePath.c_str());
+        return 0;
+    }
+    bMetadataIndexStale = true;
+
+    StoreInCache(MapGUID, Map, FullPath.string());
+    return MapGUID;
+}
+
 std::shared_ptr<GASAsset> GASAssetManager::LoadAsset(uint64_t GUID)
 {
     //  尝试从缓存获取
@@ -259,11 +499,28 @@ std::shared_ptr<GASAsset> GASAssetManager::LoadAsset(uint64_t GUID)
     {
         return CachedAsset;
     }
-    //  缓存未命中，查询元数据获取路径
+    // 缓存未命中，优先从已挂载的包中读取 (无需逐个打开文件)
+    {
+        std::shared_lock<std::shared_mutex> lock(PakMutex);
+        for (auto It = MountedPaks.rbegin(); It != MountedPaks.rend(); ++It)
+        {
+            if (!(*It)->Contains(GUID)) continue;
+
+            std::shared_ptr<GASAsset> PakAsset = (*It)->LoadAsset(GUID);
+            if (PakAsset)
+            {
+                StoreInCache(GUID, PakAsset);
+                return PakAsset;
+            }
+            GAS_LOG_ERROR("Failed to load asset %llu from pak %s", GUID, (*It)->GetPath().c_str());
+        }
+    }
+
+    //  查询元数据获取路径
     FGASAssetMetadata Metadata;
     if (!QueryMetadata(GUID, Metadata))
     {
-        GAS_LOG_ERROR("Asset GUID %llu not found in Metadata database.", GUID);
+        GAS_LOG_ERROR("Asset GUID %llu not found in metadata index or database.", GUID);
         return nullptr;
     }
 
@@ -271,14 +528,176 @@ std::shared_ptr<GASAsset> GASAssetManager::LoadAsset(uint64_t GUID)
     std::shared_ptr<GASAsset> LoadedAsset = GASBinarySerializer::LoadAssetFromDisk(FullPath.string());
     if (LoadedAsset)
     {
-        std::unique_lock<std::shared_mutex> lock(CacheMutex);
         LoadedAsset->AssetName = Metadata.Name;
         LoadedAsset->BaseHeader.AssetGUID = GUID;
 
-        MemoryCache[GUID] = LoadedAsset;
+        StoreInCache(GUID, LoadedAsset, FullPath.string());
         return LoadedAsset;
     }
 
     GAS_LOG_ERROR("Failed to load binary file: %s", FullPath.string().c_str());
     return nullptr;
-}
\ No newline at end of file
+}
+
+// 资产包
+bool GASAssetManager::MountPak(const std::string& PakFilePath)
+{
+    auto Pak = std::make_unique<GASPakFile>();
+    if (!Pak->Open(PakFilePath))
+    {
+        return false;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(PakMutex);
+    MountedPaks.push_back(std::move(Pak));
+    return true;
+}
+
+void GASAssetManager::UnmountAllPaks()
+{
+    std::unique_lock<std::shared_mutex> lock(PakMutex);
+    MountedPaks.clear();
+}
+
+bool GASAssetManager::BuildPak(const std::vector<uint64_t>& GUIDs, const std::string& OutPakPath, uint32_t Alignment) const
+{
+    std::vector<FGASPakSource> Sources;
+    Sources.reserve(GUIDs.size());
+
+    for (uint64_t GUID : GUIDs)
+    {
+        FGASAssetMetadata Metadata;
+        if (!QueryMetadata(GUID, Metadata))
+        {
+            GAS_LOG_ERROR("Pak: asset GUID %llu not found, aborting.", GUID);
+            return false;
+        }
+
+        FGASPakSource Source;
+        Source.GUID = GUID;
+        Source.Name = Metadata.Name;
+        Source.FilePath = (fs::path(GAS_CONFIG::BINARY_CACHE_PATH) / Metadata.BinaryFilePath).string();
+        Sources.push_back(std::move(Source));
+    }
+
+    return GASPakFile::WritePak(Sources, OutPakPath, Alignment);
+}
+
+// 热重载
+bool GASAssetManager::EnableHotReload(uint32_t PollIntervalMs)
+{
+    fs::create_directories(GAS_CONFIG::BINARY_CACHE_PATH);
+    return Watcher.Start(GAS_CONFIG::BINARY_CACHE_PATH, PollIntervalMs);
+}
+
+void GASAssetManager::DisableHotReload()
+{
+    Watcher.Stop();
+}
+
+uint32_t GASAssetManager::SubscribeReload(uint64_t GUID, FGASReloadCallback Callback)
+{
+    std::lock_guard<std::mutex> lock(SubscriberMutex);
+    FGASReloadSubscription Sub;
+    Sub.ID = NextSubscriptionID++;
+    Sub.GUID = GUID;
+    Sub.Callback = std::move(Callback);
+    ReloadSubscribers.push_back(std::move(Sub));
+    return ReloadSubscribers.back().ID;
+}
+
+void GASAssetManager::UnsubscribeReload(uint32_t SubscriptionID)
+{
+    std::lock_guard<std::mutex> lock(SubscriberMutex);
+    ReloadSubscribers.erase(
+        std::remove_if(ReloadSubscribers.begin(), ReloadSubscribers.end(),
+            [SubscriptionID](const FGASReloadSubscription& Sub) { return Sub.ID == SubscriptionID; }),
+        ReloadSubscribers.end());
+}
+
+int32_t GASAssetManager::ProcessPendingReloads()
+{
+    // 取出重新导入产生的替换
+    std::unordered_map<uint64_t, std::shared_ptr<GASAsset>> Swaps;
+    {
+        std::unique_lock<std::shared_mutex> lock(CacheMutex);
+        Swaps.swap(PendingSwaps);
+    }
+
+    // 文件监视器发现的变化：只重载当前已在缓存中的资产
+    if (Watcher.IsRunning())
+    {
+        for (const FGASFileChange& Change : Watcher.ConsumeChanges())
+        {
+            if (Swaps.count(Change.GUID)) continue;
+
+            std::shared_ptr<FGASAssetSlot> Slot = FindSlot(Change.GUID);
+            if (!Slot) continue;
+
+            // 文件修改时间与缓存数据的来源一致 (例如导入时写出并已排队替换)，跳过
+            // 不比较 BaseHeader.XXHash64：它只覆盖顶点/索引/轨道，LOD、Meshlet、紧凑流等重新烘焙后哈希不变
+            std::error_code Ec;
+            const std::filesystem::file_time_type FileTime = std::filesystem::last_write_time(Change.FilePath, Ec);
+            {
+                std::shared_lock<std::shared_mutex> lock(CacheMutex);
+                auto Known = CachedFileTimes.find(Change.GUID);
+                if (!Ec && Known != CachedFileTimes.end() && Known->second == FileTime) continue;
+            }
+
+            std::shared_ptr<GASAsset> Current = Slot->Load();
+            std::shared_ptr<GASAsset> Reloaded = GASBinarySerializer::LoadAssetFromDisk(Change.FilePath);
+            if (!Reloaded)
+            {
+                GAS_LOG_WARN("HotReload: failed to reload %s, keeping previous data.", Change.FilePath.c_str());
+                continue;
+            }
+
+            if (!Ec)
+            {
+                std::unique_lock<std::shared_mutex> lock(CacheMutex);
+                CachedFileTimes[Change.GUID] = FileTime;
+            }
+
+            Reloaded->BaseHeader.AssetGUID = Change.GUID;
+            if (Current) Reloaded->AssetName = Current->AssetName;
+            Swaps[Change.GUID] = Reloaded;
+        }
+    }
+
+    int32_t ReloadCount = 0;
+    for (auto& Pair : Swaps)
+    {
+        std::shared_ptr<FGASAssetSlot> Slot = FindSlot(Pair.first);
+        if (!Slot) continue;
+
+        SwapAndNotify(Slot, Pair.second);
+        ++ReloadCount;
+    }
+
+    if (ReloadCount > 0)
+    {
+        GAS_LOG("HotReload: swapped %d asset(s).", ReloadCount);
+    }
+    return ReloadCount;
+}
+
+void GASAssetManager::SwapAndNotify(const std::shared_ptr<FGASAssetSlot>& Slot, const std::shared_ptr<GASAsset>& NewAsset)
+{
+    Slot->Swap(NewAsset);
+    uint32_t NewVersion = Slot->Version.load(std::memory_order_acquire);
+
+    // 拷贝一份订阅列表，允许回调内部再订阅/退订
+    std::vector<FGASReloadSubscription> Subscribers;
+    {
+        std::lock_guard<std::mutex> lock(SubscriberMutex);
+        Subscribers = ReloadSubscribers;
+    }
+
+    for (const FGASReloadSubscription& Sub : Subscribers)
+    {
+        if (Sub.GUID == 0 || Sub.GUID == Slot->GUID)
+        {
+            Sub.Callback(Slot->GUID, NewAsset, NewVersion);
+        }
+    }
+}
@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include "../Types/GASAsset.h"
 #include "GASMetadataStorage.h"
+#include "GASMetadataIndex.h"
+#include "GASPakFile.h"
 #include "GASImporter.h"
 #include "GASLogging.h"
 #include "GASBinarySerializer.h"
@@ -9,6 +11,11 @@
 #include "GASWindows.h"
 #include "GASHashManager.h"
 #include "GASFileHelper.h"
+#include "GASAssetWatcher.h"
+#include "../Types/GASAssetHandle.h"
+#include "../../Pipeline/Baker/GASVATBaker.h"
+#include "../../Pipeline/Baker/GASRetargetBaker.h"
+#include <functional>
 
 // 负责资产的导入、持久化、运行时加载和内存缓存管理。
 
@@ -24,26 +31,114 @@ public:
     //初始化管理器：建立数据库连接、设置路径 
     bool Initialize();
 
+    // 运行时初始化：只映射元数据索引，不打开数据库
+    bool InitializeFromIndex(const std::string& IndexPath = GAS_CONFIG::METADATA_INDEX_PATH);
+
+    // 由数据库导出运行时元数据索引；若当前正映射同一文件，先解除映射，写完后重新映射
+    bool BuildMetadataIndex(const std::string& IndexPath = GAS_CONFIG::METADATA_INDEX_PATH);
+
     // 资产导入与持久化 (Offline / Editor-Time)    //执行导入、标准化、烘焙、序列化和注册的全流程
     uint64_t ImportAsset(const std::string& SourceFilePath);
 
+    // 把蒙皮 Mesh 与若干动画离线烘焙为顶点动画纹理 (VAT)，保存在 Mesh 所在目录并注册，返回 VAT 的 GUID (失败返回 0)
+    uint64_t BakeVertexAnimation(uint64_t MeshGUID, const std::vector<uint64_t>& AnimationGUIDs, const FGASVATSettings& Settings = FGASVATSettings());
+
+    // 由两副骨骼构建重定向表，保存在目标骨骼所在目录并注册，返回重定向表的 GUID (失败返回 0)
+    // GUID 只由两副骨骼决定，同一对骨骼重复构建会覆盖旧表
+    uint64_t BuildRetargetMap(uint64_t SourceSkeletonGUID, uint64_t TargetSkeletonGUID, const FGASRetargetSettings& Settings = FGASRetargetSettings());
+
     // 运行时请求资产，优先从内存缓存中获取。 如果不在缓存中，则通过 MetadataStorage 查找路径，并从磁盘加载。
     std::shared_ptr<GASAsset> LoadAsset(uint64_t GUID);
 
+    // 资产包 
+
+    // 挂载资产包，LoadAsset 会优先从已挂载的包中读取 (后挂载的优先)
+    bool MountPak(const std::string& PakFilePath);
+    void UnmountAllPaks();
+
+    // 把指定资产打包为一个文件 (路径由元数据查询)
+    bool BuildPak(const std::vector<uint64_t>& GUIDs, const std::string& OutPakPath, uint32_t Alignment = GAS_PAK_DEFAULT_ALIGNMENT) const;
+
     //从内存缓存中获取资产 (不触发磁盘加载)
     std::shared_ptr<GASAsset> GetCachedAsset(uint64_t GUID) const;
 
-    //从数据库中查询元数据
+    //查询元数据：优先使用已加载的运行时索引，未命中再查数据库
     bool QueryMetadata(uint64_t GUID, FGASAssetMetadata& OutMetadata) const;
 
+    // 获取版本化句柄 (必要时触发加载)，热重载后句柄自动指向新数据
+    template <typename T>
+    TGASAssetHandle<T> LoadAssetHandle(uint64_t GUID)
+    {
+        if (!LoadAsset(GUID)) return TGASAssetHandle<T>();
+        return TGASAssetHandle<T>(FindSlot(GUID));
+    }
+
+    // 热重载 
+
+    // 重载回调：GUID、新资产、新版本号
+    using FGASReloadCallback = std::function<void(uint64_t, const std::shared_ptr<GASAsset>&, uint32_t)>;
+
+    // 开启/关闭对 BINARY_CACHE_PATH 的监视
+    bool EnableHotReload(uint32_t PollIntervalMs = HOT_RELOAD_POLL_INTERVAL_MS);
+    void DisableHotReload();
+
+    // 订阅重载事件，GUID 为 0 表示订阅所有资产；返回订阅 ID
+    uint32_t SubscribeReload(uint64_t GUID, FGASReloadCallback Callback);
+    void UnsubscribeReload(uint32_t SubscriptionID);
+
+    // 在帧边界调用：加载发生变化且已在缓存中的资产，原子替换槽内数据并通知订阅者。返回重载数量
+    int32_t ProcessPendingReloads();
+
     GASMetadataStorage& GetGASMetadataStorage(){return MetadataStorage;}
 private:
-    //内存缓存：存储已加载到内存的资产 
-    std::unordered_map<uint64_t, std::shared_ptr<GASAsset>> MemoryCache;
+    // 查找缓存槽 (不存在返回 nullptr)
+    std::shared_ptr<FGASAssetSlot> FindSlot(uint64_t GUID) const;
+
+    // 写入缓存：已有槽则排队等待帧边界替换，否则直接新建槽
+    // FilePath 为资产所在的 .gas 文件 (包内资产为空)，记录其修改时间供热重载判断文件是否已被载入
+    void StoreInCache(uint64_t GUID, const std::shared_ptr<GASAsset>& Asset, const std::string& FilePath = std::string());
+
+    // 在帧边界替换槽内资产并通知订阅者
+    void SwapAndNotify(const std::shared_ptr<FGASAssetSlot>& Slot, const std::shared_ptr<GASAsset>& NewAsset);
+
+    struct FGASReloadSubscription
+    {
+        uint32_t ID = 0;
+        uint64_t GUID = 0;
+        FGASReloadCallback Callback;
+    };
+
+private:
+    //内存缓存：存储已加载到内存的资产 (经由槽间接引用，支持热重载原子替换)
+    std::unordered_map<uint64_t, std::shared_ptr<FGASAssetSlot>> MemoryCache;
+
+    // 等待帧边界替换的资产 (重新导入时产生)
+    std::unordered_map<uint64_t, std::shared_ptr<GASAsset>> PendingSwaps;
+
+    // 缓存中 (或待替换) 数据对应的 .gas 文件修改时间，文件时间未变的监视变更不再重载
+    std::unordered_map<uint64_t, std::filesystem::file_time_type> CachedFileTimes;
+
+    // 已挂载的资产包
+    std::vector<std::unique_ptr<GASPakFile>> MountedPaks;
+    mutable std::shared_mutex PakMutex;
+
+    // 文件监视器
+    GASAssetWatcher Watcher;
+
+    // 重载订阅者
+    std::vector<FGASReloadSubscription> ReloadSubscribers;
+    uint32_t NextSubscriptionID = 1;
+    std::mutex SubscriberMutex;
 
     // 数据库管理器：负责元数据索引
     GASMetadataStorage MetadataStorage;
 
+    // 运行时只读索引 (可选)
+    GASMetadataIndex MetadataIndex;
+
+    // 导入/烘焙写入数据库后索引已过期，查询改走数据库，直到重新生成索引
+    bool bMetadataIndexStale = false;
+
     //Assimp 导入器 (只在导入时使用) 
     GASImporter Importer;
 
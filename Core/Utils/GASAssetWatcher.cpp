@@ -0,0 +1,130 @@
+﻿#include "GASAssetWatcher.h"
+#include <chrono>
+#include "GASLogging.h"
+
+namespace fs = std::filesystem;
+
+GASAssetWatcher::~GASAssetWatcher()
+{
+    Stop();
+}
+
+bool GASAssetWatcher::Start(const std::string& RootPath, uint32_t PollIntervalMs)
+{
+    if (bRunning.load()) return true;
+
+    std::error_code Ec;
+    if (!fs::exists(RootPath, Ec))
+    {
+        GAS_LOG_ERROR("HotReload: watch path does not exist: %s", RootPath.c_str());
+        return false;
+    }
+
+    WatchRoot = RootPath;
+    PollInterval = PollIntervalMs > 0 ? PollIntervalMs : 1;
+
+    // 建立基线，避免启动时把所有文件都当成变化
+    KnownFiles.clear();
+    Scan(false);
+
+    bRunning = true;
+    WorkerThread = std::thread(&GASAssetWatcher::ThreadMain, this);
+
+    GAS_LOG("HotReload: watching %s (%u files)", WatchRoot.c_str(), (uint32_t)KnownFiles.size());
+    return true;
+}
+
+void GASAssetWatcher::Stop()
+{
+    if (!bRunning.exchange(false)) return;
+
+    {
+        std::lock_guard<std::mutex> Lock(WakeMutex);
+    }
+    WakeCondition.notify_all();
+
+    if (WorkerThread.joinable())
+    {
+        WorkerThread.join();
+    }
+}
+
+std::vector<FGASFileChange> GASAssetWatcher::ConsumeChanges()
+{
+    std::vector<FGASFileChange> Result;
+
+    std::lock_guard<std::mutex> Lock(ChangeMutex);
+    Result.reserve(PendingChanges.size());
+    for (auto& Pair : PendingChanges)
+    {
+        Result.push_back(std::move(Pair.second));
+    }
+    PendingChanges.clear();
+    return Result;
+}
+
+uint64_t GASAssetWatcher::ParseGUIDFromFileName(const fs::path& FilePath)
+{
+    std::string FileName = FilePath.filename().string();
+
+    // 文件名格式：<GUID>.<type>.gas
+    size_t DotPos = FileName.find('.');
+    if (DotPos == std::string::npos || DotPos == 0) return 0;
+
+    uint64_t GUID = 0;
+    for (size_t i = 0; i < DotPos; ++i)
+    {
+        char C = FileName[i];
+        if (C < '0' || C > '9') return 0;
+        GUID = GUID * 10 + (uint64_t)(C - '0');
+    }
+    return GUID;
+}
+
+void GASAssetWatcher::ThreadMain()
+{
+    while (bRunning.load())
+    {
+        {
+            std::unique_lock<std::mutex> Lock(WakeMutex);
+            WakeCondition.wait_for(Lock, std::chrono::milliseconds(PollInterval), [this]() { return !bRunning.load(); });
+        }
+        if (!bRunning.load()) break;
+
+        Scan(true);
+    }
+}
+
+void GASAssetWatcher::Scan(bool bReportChanges)
+{
+    std::error_code Ec;
+    fs::recursive_directory_iterator It(WatchRoot, fs::directory_options::skip_permission_denied, Ec);
+    if (Ec) return;
+
+    for (; It != fs::recursive_directory_iterator(); It.increment(Ec))
+    {
+        if (Ec) break;
+
+        const fs::directory_entry& Entry = *It;
+        if (!Entry.is_regular_file(Ec)) continue;
+        if (Entry.path().extension() != ".gas") continue;
+
+        fs::file_time_type WriteTime = Entry.last_write_time(Ec);
+        if (Ec) continue;
+
+        std::string Key = Entry.path().string();
+        auto Found = KnownFiles.find(Key);
+        bool bChanged = (Found == KnownFiles.end()) || (Found->second != WriteTime);
+        if (!bChanged) continue;
+
+        KnownFiles[Key] = WriteTime;
+
+        if (!bReportChanges) continue;
+
+        uint64_t GUID = ParseGUIDFromFileName(Entry.path());
+        if (GUID == 0) continue;
+
+        std::lock_guard<std::mutex> Lock(ChangeMutex);
+        PendingChanges[GUID] = FGASFileChange{ GUID, Key };
+    }
+}
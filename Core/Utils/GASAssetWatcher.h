@@ -0,0 +1,62 @@
+﻿#pragma once
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <cstdint>
+
+// 变更记录：检测到被修改的 .gas 文件
+struct FGASFileChange
+{
+    uint64_t GUID = 0;
+    std::string FilePath;
+};
+
+// 监视二进制缓存目录，后台线程轮询 .gas 文件的修改时间，把变化的资产 GUID 放入待处理队列。
+// 只负责发现变化，不做加载；加载与替换由 GASAssetManager 在帧边界完成。
+class GASAssetWatcher
+{
+public:
+    GASAssetWatcher() = default;
+    ~GASAssetWatcher();
+
+    // 开始监视目录 (首次扫描只记录时间戳，不产生变更)
+    bool Start(const std::string& RootPath, uint32_t PollIntervalMs);
+
+    // 停止后台线程
+    void Stop();
+
+    bool IsRunning() const { return bRunning.load(); }
+
+    // 取出自上次调用以来的所有变更 (同一 GUID 只保留一条)
+    std::vector<FGASFileChange> ConsumeChanges();
+
+    // 从文件名 "<GUID>.<type>.gas" 中解析 GUID，失败返回 0
+    static uint64_t ParseGUIDFromFileName(const std::filesystem::path& FilePath);
+
+private:
+    void ThreadMain();
+
+    // 扫描一次目录，bReportChanges=false 时只建立基线
+    void Scan(bool bReportChanges);
+
+private:
+    std::string WatchRoot;
+    uint32_t PollInterval = 500;
+
+    std::thread WorkerThread;
+    std::atomic<bool> bRunning{ false };
+    std::mutex WakeMutex;
+    std::condition_variable WakeCondition;
+
+    // 文件路径 -> 上次看到的修改时间 (只在工作线程访问)
+    std::unordered_map<std::string, std::filesystem::file_time_type> KnownFiles;
+
+    // 待处理变更：GUID -> 变更
+    std::mutex ChangeMutex;
+    std::unordered_map<uint64_t, FGASFileChange> PendingChanges;
+};
@@ -2,7 +2,9 @@
 #include <fstream>
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include "GASLogging.h"
+#include "GASMath.h"
 
 
 //辅助：写入字符串(长度 + 内容)
@@ -18,7 +20,7 @@ bool WriteString(std::ofstream & Stream, const std::string & Str)
 }
 
 // 辅助：读取字符串 (长度 + 内容)
-bool ReadString(std::ifstream& Stream, std::string& OutStr)
+bool ReadString(std::istream& Stream, std::string& OutStr)
 {
     uint32_t Len = 0;
     if (!Stream.read(reinterpret_cast<char*>(&Len), sizeof(uint32_t))) return false;
@@ -45,7 +47,7 @@ bool GASBinarySerializer::WriteData(std::ofstream& Stream, const void* Data, siz
 }
 
 //读数据
-bool GASBinarySerializer::ReadData(std::ifstream& Stream, void* Data, size_t Size)
+bool GASBinarySerializer::ReadData(std::istream& Stream, void* Data, size_t Size)
 {
     if (!Stream.read(reinterpret_cast<char*>(Data), Size))
     {
@@ -66,7 +68,10 @@ bool GASBinarySerializer::SaveAssetToDisk(const GASAsset* Asset, const std::stri
         return false;
     }
 
-    if (!WriteData(FileStream, &Asset->BaseHeader, sizeof(FGASAssetHeader)))
+    // 数据区总是按当前格式写出，版本号随之更新 (从旧文件加载的资产另存时也一样)
+    FGASAssetHeader Header = Asset->BaseHeader;
+    Header.Version = GAS_FILE_VERSION;
+    if (!WriteData(FileStream, &Header, sizeof(FGASAssetHeader)))
     {
         return false;
     }
@@ -84,6 +89,12 @@ bool GASBinarySerializer::SaveAssetToDisk(const GASAsset* Asset, const std::stri
     case EGASAssetType::Mesh:
         return SerializeMesh(FileStream, static_cast<const GASMesh*>(Asset));
 
+    case EGASAssetType::VertexAnimation:
+        return SerializeVertexAnimation(FileStream, static_cast<const GASVertexAnimation*>(Asset));
+
+    case EGASAssetType::Retarget:
+        return SerializeRetargetMap(FileStream, static_cast<const GASRetargetMap*>(Asset));
+
     default:
         GAS_LOG_ERROR("Unknown Asset Type during save. Type: %d", (int)Type);
         return false;
@@ -100,6 +111,48 @@ std::shared_ptr<GASAsset> GASBinarySerializer::LoadAssetFromDisk(const std::stri
         return nullptr;
     }
 
+    return LoadAssetFromStream(FileStream, FilePath);
+}
+
+// 只读内存流：直接在映射内存/包文件区间上反序列化，不拷贝数据
+class FGASMemoryStreamBuf : public std::streambuf
+{
+public:
+    FGASMemoryStreamBuf(const uint8_t* Data, size_t Size)
+    {
+        char* Begin = const_cast<char*>(reinterpret_cast<const char*>(Data));
+        setg(Begin, Begin, Begin + Size);
+    }
+
+protected:
+    std::streamsize xsgetn(char* Dest, std::streamsize Count) override
+    {
+        std::streamsize Available = egptr() - gptr();
+        std::streamsize ToCopy = (Count < Available) ? Count : Available;
+        if (ToCopy > 0)
+        {
+            std::memcpy(Dest, gptr(), (size_t)ToCopy);
+            gbump((int)ToCopy);
+        }
+        return ToCopy;
+    }
+};
+
+std::shared_ptr<GASAsset> GASBinarySerializer::LoadAssetFromMemory(const uint8_t* Data, size_t Size, const std::string& DebugName)
+{
+    if (!Data || Size < sizeof(FGASAssetHeader))
+    {
+        GAS_LOG_ERROR("Invalid memory range for asset: %s", DebugName.c_str());
+        return nullptr;
+    }
+
+    FGASMemoryStreamBuf StreamBuf(Data, Size);
+    std::istream MemoryStream(&StreamBuf);
+    return LoadAssetFromStream(MemoryStream, DebugName);
+}
+
+std::shared_ptr<GASAsset> GASBinarySerializer::LoadAssetFromStream(std::istream& FileStream, const std::string& FilePath)
+{
     FGASAssetHeader Header;
     if (!ReadData(FileStream, &Header, sizeof(FGASAssetHeader)))
     {
@@ -112,6 +165,12 @@ std::shared_ptr<GASAsset> GASBinarySerializer::LoadAssetFromDisk(const std::stri
         return nullptr;
     }
 
+    if (Header.Version > GAS_FILE_VERSION)
+    {
+        GAS_LOG_ERROR("Unsupported file version %u (max %u): %s", Header.Version, GAS_FILE_VERSION, FilePath.c_str());
+        return nullptr;
+    }
+
     std::shared_ptr<GASAsset> ResultAsset = nullptr;
     EGASAssetType Type = static_cast<EGASAssetType>(Header.AssetType);
 
@@ -147,6 +206,26 @@ std::shared_ptr<GASAsset> GASBinarySerializer::LoadAssetFromDisk(const std::stri
         }
         break;
     }
+    case EGASAssetType::VertexAnimation:
+    {
+        auto VAT = std::make_shared<GASVertexAnimation>();
+        VAT->BaseHeader = Header;
+        if (DeserializeVertexAnimation(FileStream, VAT.get()))
+        {
+            ResultAsset = VAT;
+        }
+        break;
+    }
+    case EGASAssetType::Retarget:
+    {
+        auto Map = std::make_shared<GASRetargetMap>();
+        Map->BaseHeader = Header;
+        if (DeserializeRetargetMap(FileStream, Map.get()))
+        {
+            ResultAsset = Map;
+        }
+        break;
+    }
     default:
         GAS_LOG_ERROR("Unknown Asset Type in header: %d", (int)Type);
         break;
@@ -165,12 +244,13 @@ bool GASBinarySerializer::SerializeSkeleton(std::ofstream& Stream, const GASSkel
 
         if (!WriteString(Stream, Bone.Name)) return false;
         if (!WriteData(Stream, &Bone.ParentIndex, sizeof(int32_t))) return false;
-        if (!WriteData(Stream, &Bone.InverseBindMatrix, sizeof(FGASMatrix4x4))) return false;
+        if (!WriteData(Stream, &Bone.InverseBindMatrix, sizeof(FGASMatrix3x4))) return false;
+        if (!WriteData(Stream, &Bone.NameHash, sizeof(uint64_t))) return false;
     }
     return true;
 }
 
-bool GASBinarySerializer::DeserializeSkeleton(std::ifstream& Stream, GASSkeleton* Skeleton)
+bool GASBinarySerializer::DeserializeSkeleton(std::istream& Stream, GASSkeleton* Skeleton)
 {
     //  读 SkeletonHeader
     if (!ReadData(Stream, &Skeleton->SkeletonHeader, sizeof(FGASSkeletonHeader))) return false;
@@ -195,7 +275,49 @@ bool GASBinarySerializer::DeserializeSkeleton(std::ifstream& Stream, GASSkeleton
         Bone.Name[CopyLen] = '\0'; 
 
         if (!ReadData(Stream, &Bone.ParentIndex, sizeof(int32_t))) return false;
-        if (!ReadData(Stream, &Bone.InverseBindMatrix, sizeof(FGASMatrix4x4))) return false; 
+
+        // 版本 4 起为列向量布局的 3x4；旧文件为行向量布局的 4x4，转置后去掉恒为 (0, 0, 0, 1) 的最后一行
+        if (Skeleton->BaseHeader.Version >= 4)
+        {
+            if (!ReadData(Stream, &Bone.InverseBindMatrix, sizeof(FGASMatrix3x4))) return false;
+        }
+        else
+        {
+            FGASMatrix4x4 Legacy;
+            if (!ReadData(Stream, &Legacy, sizeof(FGASMatrix4x4))) return false;
+            Bone.InverseBindMatrix = GASMath::ToMatrix3x4(GASMath::Transpose(Legacy));
+        }
+
+        // 版本 3 起名称哈希随文件保存，旧文件在 RebuildBoneMap 中补算
+        Bone.NameHash = 0;
+        if (Skeleton->BaseHeader.Version >= 3 && !ReadData(Stream, &Bone.NameHash, sizeof(uint64_t))) return false;
+    }
+
+    // 层偏移：版本 1 的保留字段不作数，其余情况校验后才启用
+    FGASSkeletonHeader& Header = Skeleton->SkeletonHeader;
+    if (Skeleton->BaseHeader.Version < 2 || Header.NumLevels > GAS_MAX_SKELETON_LEVELS)
+    {
+        Header.NumLevels = 0;
+    }
+    if (Header.NumLevels > 0)
+    {
+        bool bValid = Header.LevelOffsets[0] == 0 && Header.LevelOffsets[Header.NumLevels] == (uint32_t)BoneCount;
+        for (int32_t Level = 0; bValid && Level < Header.NumLevels; ++Level)
+        {
+            const int32_t Begin = Header.LevelOffsets[Level];
+            const int32_t End = Header.LevelOffsets[Level + 1];
+            bValid = Begin <= End;
+            for (int32_t b = Begin; bValid && b < End; ++b)
+            {
+                const int32_t Parent = Skeleton->Bones[b].ParentIndex;
+                bValid = (Level == 0) ? (Parent < 0) : (Parent >= Header.LevelOffsets[Level - 1] && Parent < Begin);
+            }
+        }
+        if (!bValid)
+        {
+            GAS_LOG_WARN("DeserializeSkeleton: Invalid bone levels, ignored");
+            Header.NumLevels = 0;
+        }
     }
 
     // 重建加速查找表 
@@ -208,8 +330,12 @@ bool GASBinarySerializer::DeserializeSkeleton(std::ifstream& Stream, GASSkeleton
 
 bool GASBinarySerializer::SerializeAnimation(std::ofstream& Stream, const GASAnimation* Animation)
 {
-    //  写 AnimHeader
-    if (!WriteData(Stream, &Animation->AnimHeader, sizeof(FGASAnimationHeader))) return false;
+    //  写 AnimHeader (包围盒轨道数以实际数组为准)
+    FGASAnimationHeader OutHeader = Animation->AnimHeader;
+    OutHeader.NumBoundsTracks = (uint32_t)Animation->BoundsTracks.Num();
+    OutHeader.NumRootMotionKeys = (uint32_t)Animation->RootMotion.Num();
+    OutHeader.NumEvents = (uint32_t)Animation->Events.Num();
+    if (!WriteData(Stream, &OutHeader, sizeof(FGASAnimationHeader))) return false;
 
     // 写 Tracks 数据
     size_t DataSize = Animation->Tracks.Num() * sizeof(FGASAnimTrackData);
@@ -217,14 +343,48 @@ bool GASBinarySerializer::SerializeAnimation(std::ofstream& Stream, const GASAni
     {
         if (!WriteData(Stream, Animation->Tracks.GetData(), DataSize)) return false;
     }
+
+    // 写动画包围盒
+    if (OutHeader.NumBoundsTracks > 0)
+    {
+        if (!WriteData(Stream, Animation->BoundsTracks.GetData(), Animation->BoundsTracks.GetTotalSizeInBytes())) return false;
+
+        uint32_t NumBlocks = (uint32_t)Animation->BoundsBlocks.Num();
+        if (!WriteData(Stream, &NumBlocks, sizeof(uint32_t))) return false;
+        if (NumBlocks > 0)
+        {
+            if (!WriteData(Stream, Animation->BoundsBlocks.GetData(), Animation->BoundsBlocks.GetTotalSizeInBytes())) return false;
+        }
+    }
+
+    // 写根运动曲线
+    if (OutHeader.NumRootMotionKeys > 0)
+    {
+        if (!WriteData(Stream, Animation->RootMotion.GetData(), Animation->RootMotion.GetTotalSizeInBytes())) return false;
+    }
+
+    // 写事件轨道
+    if (OutHeader.NumEvents > 0)
+    {
+        if (!WriteData(Stream, Animation->Events.GetData(), Animation->Events.GetTotalSizeInBytes())) return false;
+    }
     return true;
 }
 
-bool GASBinarySerializer::DeserializeAnimation(std::ifstream& Stream, GASAnimation* Animation)
+bool GASBinarySerializer::DeserializeAnimation(std::istream& Stream, GASAnimation* Animation)
 {
     //读 AnimHeader
     if (!ReadData(Stream, &Animation->AnimHeader, sizeof(FGASAnimationHeader))) return false;
 
+    // 版本 1 的保留字段不作数
+    if (Animation->BaseHeader.Version < 2)
+    {
+        Animation->AnimHeader.NumBoundsTracks = 0;
+        Animation->AnimHeader.AdditiveType = EGASAdditiveType::None;
+        Animation->AnimHeader.NumRootMotionKeys = 0;
+        Animation->AnimHeader.NumEvents = 0;
+    }
+
     // 计算大小并 Resize
     int32_t TotalElements = Animation->AnimHeader.FrameCount * Animation->AnimHeader.TrackCount;
     Animation->Tracks.Resize(TotalElements);
@@ -236,6 +396,62 @@ bool GASBinarySerializer::DeserializeAnimation(std::ifstream& Stream, GASAnimati
         if (!ReadData(Stream, Animation->Tracks.GetData(), DataSize)) return false;
     }
 
+    // 读动画包围盒
+    Animation->BoundsTracks.Empty();
+    Animation->BoundsBlocks.Empty();
+    if (Animation->AnimHeader.NumBoundsTracks > 0)
+    {
+        Animation->BoundsTracks.Resize(Animation->AnimHeader.NumBoundsTracks);
+        if (!ReadData(Stream, Animation->BoundsTracks.GetData(), Animation->BoundsTracks.GetTotalSizeInBytes())) return false;
+
+        uint32_t NumBlocks = 0;
+        if (!ReadData(Stream, &NumBlocks, sizeof(uint32_t))) return false;
+        Animation->BoundsBlocks.Resize(NumBlocks);
+        if (NumBlocks > 0)
+        {
+            if (!ReadData(Stream, Animation->BoundsBlocks.GetData(), Animation->BoundsBlocks.GetTotalSizeInBytes())) return false;
+        }
+
+        for (const FGASAnimBoundsTrack& Track : Animation->BoundsTracks)
+        {
+            if (Track.FramesPerBlock == 0 || Track.NumBlocks == 0 || (uint64_t)Track.FirstBlock + Track.NumBlocks > NumBlocks)
+            {
+                GAS_LOG_ERROR("DeserializeAnimation: Invalid bounds track for mesh %llu", (unsigned long long)Track.MeshGUID);
+                return false;
+            }
+        }
+    }
+
+    // 读根运动曲线
+    Animation->RootMotion.Empty();
+    if (Animation->AnimHeader.NumRootMotionKeys > 0)
+    {
+        if (Animation->AnimHeader.NumRootMotionKeys != Animation->AnimHeader.FrameCount)
+        {
+            GAS_LOG_ERROR("DeserializeAnimation: %u root motion keys for %u frames", Animation->AnimHeader.NumRootMotionKeys, Animation->AnimHeader.FrameCount);
+            return false;
+        }
+        Animation->RootMotion.Resize(Animation->AnimHeader.NumRootMotionKeys);
+        if (!ReadData(Stream, Animation->RootMotion.GetData(), Animation->RootMotion.GetTotalSizeInBytes())) return false;
+    }
+
+    // 读事件轨道 (查询依赖时间升序)
+    Animation->Events.Empty();
+    if (Animation->AnimHeader.NumEvents > 0)
+    {
+        Animation->Events.Resize(Animation->AnimHeader.NumEvents);
+        if (!ReadData(Stream, Animation->Events.GetData(), Animation->Events.GetTotalSizeInBytes())) return false;
+        for (int32_t i = 0; i < Animation->Events.Num(); ++i)
+        {
+            Animation->Events[i].Name[GAS_MAX_EVENT_NAME_LEN - 1] = '\0';
+            if (i > 0 && Animation->Events[i].Time < Animation->Events[i - 1].Time)
+            {
+                GAS_LOG_ERROR("DeserializeAnimation: Events are not sorted by time");
+                return false;
+            }
+        }
+    }
+
     return true;
 }
 
@@ -244,8 +460,11 @@ bool GASBinarySerializer::DeserializeAnimation(std::ifstream& Stream, GASAnimati
 
 bool GASBinarySerializer::SerializeMesh(std::ofstream& Stream, const GASMesh* Mesh)
 {
-    // MeshHeader
-    if (!WriteData(Stream, &Mesh->MeshHeader, sizeof(FGASMeshHeader))) return false;
+    // MeshHeader (SubMesh 数量以实际数组为准)
+    FGASMeshHeader OutHeader = Mesh->MeshHeader;
+    OutHeader.NumSubMeshes = (uint32_t)Mesh->SubMeshes.Num();
+    OutHeader.NumLODs = (uint32_t)Mesh->LODs.Num();
+    if (!WriteData(Stream, &OutHeader, sizeof(FGASMeshHeader))) return false;
 
     // 蒙皮标记 和 SkeletonGUID
     if (!WriteData(Stream, &Mesh->MeshHasSkin, sizeof(bool))) return false;
@@ -258,21 +477,166 @@ bool GASBinarySerializer::SerializeMesh(std::ofstream& Stream, const GASMesh* Me
         if (!WriteData(Stream, Mesh->Vertices.GetData(), VertexDataSize)) return false;
     }
 
-    //写 索引数据 
-    size_t IndexDataSize = Mesh->Indices.Num() * sizeof(uint32_t);
+    //写 索引数据 (16 或 32 位)
+    size_t IndexDataSize = (size_t)Mesh->GetNumIndices() * Mesh->GetIndexStride();
     if (IndexDataSize > 0)
     {
-        if (!WriteData(Stream, Mesh->Indices.GetData(), IndexDataSize)) return false;
+        if (!WriteData(Stream, Mesh->GetIndexData(), IndexDataSize)) return false;
+    }
+
+    // SubMesh 区间
+    if (OutHeader.NumSubMeshes > 0)
+    {
+        if (!WriteData(Stream, Mesh->SubMeshes.GetData(), Mesh->SubMeshes.GetTotalSizeInBytes())) return false;
+    }
+
+    // LOD 链与骨骼 LOD 表
+    if (OutHeader.NumLODs > 0)
+    {
+        uint32_t NumSections = (uint32_t)Mesh->LODSections.Num();
+        uint32_t NumBoneLODs = (uint32_t)Mesh->BoneLODTable.Num();
+        if (!WriteData(Stream, Mesh->LODs.GetData(), Mesh->LODs.GetTotalSizeInBytes())) return false;
+        if (!WriteData(Stream, &NumSections, sizeof(uint32_t))) return false;
+        if (NumSections > 0 && !WriteData(Stream, Mesh->LODSections.GetData(), Mesh->LODSections.GetTotalSizeInBytes())) return false;
+        if (!WriteData(Stream, &NumBoneLODs, sizeof(uint32_t))) return false;
+        if (NumBoneLODs > 0 && !WriteData(Stream, Mesh->BoneLODTable.GetData(), Mesh->BoneLODTable.GetTotalSizeInBytes())) return false;
+    }
+
+    // Meshlet (可选)
+    if (Mesh->HasMeshlets())
+    {
+        uint32_t Counts[4] = { (uint32_t)Mesh->Meshlets.Num(), (uint32_t)Mesh->MeshletVertices.Num(), (uint32_t)Mesh->MeshletTriangles.Num(), (uint32_t)Mesh->MeshletBones.Num() };
+        if (!WriteData(Stream, Counts, sizeof(Counts))) return false;
+        if (!WriteData(Stream, Mesh->Meshlets.GetData(), Mesh->Meshlets.GetTotalSizeInBytes())) return false;
+        if (!WriteData(Stream, Mesh->MeshletVertices.GetData(), Mesh->MeshletVertices.GetTotalSizeInBytes())) return false;
+        if (!WriteData(Stream, Mesh->MeshletTriangles.GetData(), Mesh->MeshletTriangles.GetTotalSizeInBytes())) return false;
+        if (!WriteData(Stream, Mesh->MeshletBones.GetData(), Mesh->MeshletBones.GetTotalSizeInBytes())) return false;
+    }
+
+    // 紧凑顶点流 (可选)
+    if (Mesh->HasCompactVertices())
+    {
+        if (!WriteData(Stream, &Mesh->CompactHeader, sizeof(FGASCompactVertexHeader))) return false;
+        if (!WriteData(Stream, Mesh->CompactPositions.GetData(), Mesh->CompactPositions.GetTotalSizeInBytes())) return false;
+        if (!WriteData(Stream, Mesh->CompactShading.GetData(), Mesh->CompactShading.GetTotalSizeInBytes())) return false;
+        if (!WriteData(Stream, Mesh->CompactSkin.GetData(), Mesh->CompactSkin.GetTotalSizeInBytes())) return false;
+    }
+
+    return true;
+}
+
+// 顶点蒙皮数据引用的骨骼数 (最大骨骼序号 + 1)，完整顶点已剥离时读紧凑蒙皮流
+static uint32_t CountReferencedBones(const GASMesh* Mesh)
+{
+    uint32_t NumBones = 0;
+    if (Mesh->Vertices.Num() > 0)
+    {
+        const int32_t InfluenceCount = Mesh->GetInfluenceCount();
+        for (const FGASSkinVertex& Vertex : Mesh->Vertices)
+        {
+            for (int32_t j = 0; j < InfluenceCount; ++j)
+            {
+                if (Vertex.BoneWeights.Weights[j] > 0.0f) NumBones = std::max(NumBones, Vertex.BoneIndices.Indices[j] + 1);
+            }
+        }
+    }
+    else if (Mesh->HasCompactVertices())
+    {
+        const FGASCompactVertexHeader& Compact = Mesh->CompactHeader;
+        for (uint32_t v = 0; v < Compact.NumVertices; ++v)
+        {
+            const uint8_t* Skin = Mesh->GetCompactSkinData((int32_t)v);
+            for (uint32_t j = 0; j < Compact.InfluenceCount; ++j)
+            {
+                const uint32_t Bone = (Compact.BoneIndexBytes == 1) ? Skin[j] : (uint32_t)(Skin[j * 2] | (Skin[j * 2 + 1] << 8));
+                NumBones = std::max(NumBones, Bone + 1);
+            }
+        }
+    }
+    return NumBones;
+}
+
+// Meshlet 校验：各区间在数组内，局部顶点指向有效网格顶点，局部三角形索引小于该簇顶点数，
+// 骨骼集合升序且不超出顶点实际引用的骨骼 (有骨骼 LOD 表时同时不超出其骨骼数)
+static bool ValidateMeshlets(const GASMesh* Mesh)
+{
+    const uint32_t NumVertices = (uint32_t)Mesh->GetNumVertices();
+    uint32_t NumBones = CountReferencedBones(Mesh);
+    if (Mesh->BoneLODTable.Num() > 0) NumBones = std::min(NumBones, (uint32_t)Mesh->BoneLODTable.Num());
+
+    for (int32_t m = 0; m < Mesh->Meshlets.Num(); ++m)
+    {
+        const FGASMeshlet& Meshlet = Mesh->Meshlets[m];
+        if ((uint64_t)Meshlet.VertexOffset + Meshlet.VertexCount > (uint64_t)Mesh->MeshletVertices.Num()
+            || (uint64_t)Meshlet.TriangleOffset + Meshlet.TriangleCount * 3u > (uint64_t)Mesh->MeshletTriangles.Num()
+            || (uint64_t)Meshlet.BoneOffset + Meshlet.BoneCount > (uint64_t)Mesh->MeshletBones.Num())
+        {
+            GAS_LOG_ERROR("Invalid meshlet range in mesh (meshlet %d)", m);
+            return false;
+        }
+
+        for (uint32_t i = 0; i < Meshlet.VertexCount; ++i)
+        {
+            if (Mesh->MeshletVertices[(int32_t)(Meshlet.VertexOffset + i)] >= NumVertices)
+            {
+                GAS_LOG_ERROR("Meshlet %d references vertex %u of %u", m, Mesh->MeshletVertices[(int32_t)(Meshlet.VertexOffset + i)], NumVertices);
+                return false;
+            }
+        }
+
+        for (uint32_t i = 0; i < Meshlet.TriangleCount * 3u; ++i)
+        {
+            if (Mesh->MeshletTriangles[(int32_t)(Meshlet.TriangleOffset + i)] >= Meshlet.VertexCount)
+            {
+                GAS_LOG_ERROR("Meshlet %d has a local index outside its %u vertices", m, (uint32_t)Meshlet.VertexCount);
+                return false;
+            }
+        }
+
+        for (uint32_t i = 0; i < Meshlet.BoneCount; ++i)
+        {
+            const uint16_t Bone = Mesh->MeshletBones[(int32_t)(Meshlet.BoneOffset + i)];
+            if (Bone >= NumBones || (i > 0 && Bone <= Mesh->MeshletBones[(int32_t)(Meshlet.BoneOffset + i - 1)]))
+            {
+                GAS_LOG_ERROR("Meshlet %d has an invalid bone set (bone %u, %u bones referenced)", m, (uint32_t)Bone, NumBones);
+                return false;
+            }
+        }
     }
+    return true;
+}
 
+// SubMesh / LOD Section 校验：索引区间与顶点区间都在缓冲区内 (按 64 位求和，避免 uint32 回绕)
+static bool ValidateSections(const GASArray<FGASSubMesh>& Sections, uint32_t NumIndices, uint32_t NumVertices, const char* Kind)
+{
+    for (int32_t s = 0; s < Sections.Num(); ++s)
+    {
+        const FGASSubMesh& Section = Sections[s];
+        if ((uint64_t)Section.IndexStart + Section.IndexCount > NumIndices
+            || (uint64_t)Section.VertexStart + Section.VertexCount > NumVertices)
+        {
+            GAS_LOG_ERROR("Invalid %s %d in mesh: indices [%u, +%u) of %u, vertices [%u, +%u) of %u", Kind, s,
+                Section.IndexStart, Section.IndexCount, NumIndices, Section.VertexStart, Section.VertexCount, NumVertices);
+            return false;
+        }
+    }
     return true;
 }
 
-bool GASBinarySerializer::DeserializeMesh(std::ifstream& Stream, GASMesh* Mesh)
+bool GASBinarySerializer::DeserializeMesh(std::istream& Stream, GASMesh* Mesh)
 {
     // 读 MeshHeader
     if (!ReadData(Stream, &Mesh->MeshHeader, sizeof(FGASMeshHeader))) return false;
 
+    // 版本 1 的保留字段未初始化，不能当作标志位使用
+    if (Mesh->BaseHeader.Version < 2)
+    {
+        Mesh->MeshHeader.MeshFlags = 0;
+        Mesh->MeshHeader.InfluenceCount = 0;
+        Mesh->MeshHeader.NumSubMeshes = 0;
+        Mesh->MeshHeader.NumLODs = 0;
+    }
+
     //  读MeshHasSkin和 SkeletonGUID
     if (!ReadData(Stream, &Mesh->MeshHasSkin, sizeof(bool))) return false;
     if (!ReadData(Stream, &Mesh->SkeletonGUID, sizeof(uint64_t))) return false;
@@ -286,12 +650,195 @@ bool GASBinarySerializer::DeserializeMesh(std::ifstream& Stream, GASMesh* Mesh)
     }
 
     // 读索引数据
-    Mesh->Indices.Resize(Mesh->MeshHeader.NumIndices);
-    size_t IndexDataSize = Mesh->Indices.Num() * sizeof(uint32_t);
-    if (IndexDataSize > 0)
+    if (Mesh->Is16BitIndices())
+    {
+        Mesh->Indices16.Resize(Mesh->MeshHeader.NumIndices);
+        if (Mesh->Indices16.Num() > 0 && !ReadData(Stream, Mesh->Indices16.GetData(), Mesh->Indices16.GetTotalSizeInBytes())) return false;
+    }
+    else
+    {
+        Mesh->Indices.Resize(Mesh->MeshHeader.NumIndices);
+        if (Mesh->Indices.Num() > 0 && !ReadData(Stream, Mesh->Indices.GetData(), Mesh->Indices.GetTotalSizeInBytes())) return false;
+    }
+
+    // 读 SubMesh，旧文件没有时整个网格作为一个 SubMesh
+    Mesh->SubMeshes.Resize(Mesh->MeshHeader.NumSubMeshes);
+    if (Mesh->SubMeshes.Num() > 0)
+    {
+        if (!ReadData(Stream, Mesh->SubMeshes.GetData(), Mesh->SubMeshes.GetTotalSizeInBytes())) return false;
+    }
+    else if (Mesh->MeshHeader.NumIndices > 0)
     {
-        if (!ReadData(Stream, Mesh->Indices.GetData(), IndexDataSize)) return false;
+        FGASSubMesh SubMesh;
+        SubMesh.IndexCount = Mesh->MeshHeader.NumIndices;
+        SubMesh.VertexCount = Mesh->MeshHeader.NumVertices;
+        Mesh->SubMeshes.Add(SubMesh);
     }
+    if (!ValidateSections(Mesh->SubMeshes, Mesh->MeshHeader.NumIndices, Mesh->MeshHeader.NumVertices, "submesh")) return false;
+
+    // 读 LOD 链与骨骼 LOD 表
+    if (Mesh->MeshHeader.NumLODs > 0)
+    {
+        uint32_t NumSections = 0;
+        uint32_t NumBoneLODs = 0;
+        Mesh->LODs.Resize(Mesh->MeshHeader.NumLODs);
+        if (!ReadData(Stream, Mesh->LODs.GetData(), Mesh->LODs.GetTotalSizeInBytes())) return false;
+        if (!ReadData(Stream, &NumSections, sizeof(uint32_t))) return false;
+        Mesh->LODSections.Resize(NumSections);
+        if (NumSections > 0 && !ReadData(Stream, Mesh->LODSections.GetData(), Mesh->LODSections.GetTotalSizeInBytes())) return false;
+        if (!ReadData(Stream, &NumBoneLODs, sizeof(uint32_t))) return false;
+        Mesh->BoneLODTable.Resize(NumBoneLODs);
+        if (NumBoneLODs > 0 && !ReadData(Stream, Mesh->BoneLODTable.GetData(), Mesh->BoneLODTable.GetTotalSizeInBytes())) return false;
+
+        for (const FGASMeshLOD& LOD : Mesh->LODs)
+        {
+            if ((uint64_t)LOD.FirstSection + LOD.NumSections > NumSections)
+            {
+                GAS_LOG_ERROR("Invalid LOD section range in mesh");
+                return false;
+            }
+        }
+        if (!ValidateSections(Mesh->LODSections, Mesh->MeshHeader.NumIndices, Mesh->MeshHeader.NumVertices, "LOD section")) return false;
+    }
+
+    // 读 Meshlet
+    if (Mesh->HasMeshlets())
+    {
+        uint32_t Counts[4] = { 0, 0, 0, 0 };
+        if (!ReadData(Stream, Counts, sizeof(Counts))) return false;
+        Mesh->Meshlets.Resize(Counts[0]);
+        Mesh->MeshletVertices.Resize(Counts[1]);
+        Mesh->MeshletTriangles.Resize(Counts[2]);
+        Mesh->MeshletBones.Resize(Counts[3]);
+        if (!ReadData(Stream, Mesh->Meshlets.GetData(), Mesh->Meshlets.GetTotalSizeInBytes())) return false;
+        if (!ReadData(Stream, Mesh->MeshletVertices.GetData(), Mesh->MeshletVertices.GetTotalSizeInBytes())) return false;
+        if (!ReadData(Stream, Mesh->MeshletTriangles.GetData(), Mesh->MeshletTriangles.GetTotalSizeInBytes())) return false;
+        if (!ReadData(Stream, Mesh->MeshletBones.GetData(), Mesh->MeshletBones.GetTotalSizeInBytes())) return false;
+    }
+
+    // 读紧凑顶点流
+    if (Mesh->MeshHeader.MeshFlags & static_cast<uint32_t>(EGASMeshFlags::CompactVertices))
+    {
+        if (!ReadData(Stream, &Mesh->CompactHeader, sizeof(FGASCompactVertexHeader))) return false;
 
+        const FGASCompactVertexHeader& Compact = Mesh->CompactHeader;
+        if (!IsValidInfluenceCount(Compact.InfluenceCount) || (Compact.BoneIndexBytes != 1 && Compact.BoneIndexBytes != 2)
+            || Compact.SkinStride < Compact.InfluenceCount * (Compact.BoneIndexBytes + 1))
+        {
+            GAS_LOG_ERROR("Invalid compact vertex header in mesh");
+            return false;
+        }
+
+        const int32_t NumVertices = (int32_t)Compact.NumVertices;
+        Mesh->CompactPositions.Resize(NumVertices);
+        Mesh->CompactShading.Resize(NumVertices);
+        Mesh->CompactSkin.Resize(NumVertices * Compact.SkinStride);
+        if (!ReadData(Stream, Mesh->CompactPositions.GetData(), Mesh->CompactPositions.GetTotalSizeInBytes())) return false;
+        if (!ReadData(Stream, Mesh->CompactShading.GetData(), Mesh->CompactShading.GetTotalSizeInBytes())) return false;
+        if (!ReadData(Stream, Mesh->CompactSkin.GetData(), Mesh->CompactSkin.GetTotalSizeInBytes())) return false;
+    }
+
+    // Meshlet 内容依赖顶点数与蒙皮数据，须在紧凑顶点流之后校验
+    if (Mesh->HasMeshlets() && !ValidateMeshlets(Mesh)) return false;
+
+    return true;
+}
+
+
+// 顶点动画纹理 (VAT) 实现
+
+bool GASBinarySerializer::SerializeVertexAnimation(std::ofstream& Stream, const GASVertexAnimation* VAT)
+{
+    // 数量以实际数组为准
+    FGASVATHeader OutHeader = VAT->VATHeader;
+    OutHeader.NumClips = (uint32_t)VAT->Clips.Num();
+    OutHeader.NumVertices = (uint32_t)VAT->SourceVertices.Num();
+    OutHeader.NumSections = (uint32_t)VAT->Sections.Num();
+    OutHeader.NumIndices = (uint32_t)VAT->Indices.Num();
+    if ((uint64_t)OutHeader.TextureWidth * OutHeader.TextureHeight != (uint64_t)VAT->Texels.Num())
+    {
+        GAS_LOG_ERROR("SerializeVertexAnimation: Texel count %d does not match %ux%u", VAT->Texels.Num(), OutHeader.TextureWidth, OutHeader.TextureHeight);
+        return false;
+    }
+    if (!WriteData(Stream, &OutHeader, sizeof(FGASVATHeader))) return false;
+
+    if (VAT->Clips.Num() > 0 && !WriteData(Stream, VAT->Clips.GetData(), VAT->Clips.GetTotalSizeInBytes())) return false;
+    if (VAT->SourceVertices.Num() > 0 && !WriteData(Stream, VAT->SourceVertices.GetData(), VAT->SourceVertices.GetTotalSizeInBytes())) return false;
+    if (VAT->Sections.Num() > 0 && !WriteData(Stream, VAT->Sections.GetData(), VAT->Sections.GetTotalSizeInBytes())) return false;
+    if (VAT->Indices.Num() > 0 && !WriteData(Stream, VAT->Indices.GetData(), VAT->Indices.GetTotalSizeInBytes())) return false;
+    if (VAT->Texels.Num() > 0 && !WriteData(Stream, VAT->Texels.GetData(), VAT->Texels.GetTotalSizeInBytes())) return false;
     return true;
-}
\ No newline at end of file
+}
+
+bool GASBinarySerializer::DeserializeVertexAnimation(std::istream& Stream, GASVertexAnimation* VAT)
+{
+    if (!ReadData(Stream, &VAT->VATHeader, sizeof(FGASVATHeader))) return false;
+    const FGASVATHeader& Header = VAT->VATHeader;
+
+    const uint64_t NumTexels = (uint64_t)Header.TextureWidth * Header.TextureHeight;
+    if (NumTexels < (uint64_t)Header.NumFrames * Header.NumVertices || NumTexels > 0x7FFFFFFF)
+    {
+        GAS_LOG_ERROR("DeserializeVertexAnimation: Invalid texture size %ux%u", Header.TextureWidth, Header.TextureHeight);
+        return false;
+    }
+
+    VAT->Clips.Resize(Header.NumClips);
+    VAT->SourceVertices.Resize(Header.NumVertices);
+    VAT->Sections.Resize(Header.NumSections);
+    VAT->Indices.Resize(Header.NumIndices);
+    VAT->Texels.Resize((int32_t)NumTexels);
+
+    if (Header.NumClips > 0 && !ReadData(Stream, VAT->Clips.GetData(), VAT->Clips.GetTotalSizeInBytes())) return false;
+    if (Header.NumVertices > 0 && !ReadData(Stream, VAT->SourceVertices.GetData(), VAT->SourceVertices.GetTotalSizeInBytes())) return false;
+    if (Header.NumSections > 0 && !ReadData(Stream, VAT->Sections.GetData(), VAT->Sections.GetTotalSizeInBytes())) return false;
+    if (Header.NumIndices > 0 && !ReadData(Stream, VAT->Indices.GetData(), VAT->Indices.GetTotalSizeInBytes())) return false;
+    if (NumTexels > 0 && !ReadData(Stream, VAT->Texels.GetData(), VAT->Texels.GetTotalSizeInBytes())) return false;
+
+    for (const FGASVATClip& Clip : VAT->Clips)
+    {
+        if ((uint64_t)Clip.FirstFrame + Clip.NumFrames > Header.NumFrames)
+        {
+            GAS_LOG_ERROR("DeserializeVertexAnimation: Clip frames out of range");
+            return false;
+        }
+    }
+    for (uint32_t Index : VAT->Indices)
+    {
+        if (Index >= Header.NumVertices)
+        {
+            GAS_LOG_ERROR("DeserializeVertexAnimation: Index %u out of range", Index);
+            return false;
+        }
+    }
+    return true;
+}
+
+// 重定向表 (Retarget) 实现
+bool GASBinarySerializer::SerializeRetargetMap(std::ofstream& Stream, const GASRetargetMap* Map)
+{
+    FGASRetargetHeader OutHeader = Map->RetargetHeader;
+    OutHeader.NumBones = (uint32_t)Map->Bones.Num();
+    if (!WriteData(Stream, &OutHeader, sizeof(FGASRetargetHeader))) return false;
+
+    if (Map->Bones.Num() > 0 && !WriteData(Stream, Map->Bones.GetData(), Map->Bones.GetTotalSizeInBytes())) return false;
+    return true;
+}
+
+bool GASBinarySerializer::DeserializeRetargetMap(std::istream& Stream, GASRetargetMap* Map)
+{
+    if (!ReadData(Stream, &Map->RetargetHeader, sizeof(FGASRetargetHeader))) return false;
+    const FGASRetargetHeader& Header = Map->RetargetHeader;
+
+    Map->Bones.Resize(Header.NumBones);
+    if (Header.NumBones > 0 && !ReadData(Stream, Map->Bones.GetData(), Map->Bones.GetTotalSizeInBytes())) return false;
+
+    for (const FGASRetargetBone& Bone : Map->Bones)
+    {
+        if (Bone.SourceIndex >= (int32_t)Header.NumSourceBones)
+        {
+            GAS_LOG_ERROR("DeserializeRetargetMap: Source bone %d out of range (%u bones)", Bone.SourceIndex, Header.NumSourceBones);
+            return false;
+        }
+    }
+    return true;
+}
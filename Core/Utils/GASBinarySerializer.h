@@ -17,12 +17,18 @@ public:
    
     static std::shared_ptr<GASAsset> LoadAssetFromDisk(const std::string& FilePath);
 
+    // 从内存区间反序列化资产 (用于包文件/内存映射)，DebugName 仅用于日志
+    static std::shared_ptr<GASAsset> LoadAssetFromMemory(const uint8_t* Data, size_t Size, const std::string& DebugName);
+
 private:
+    // 从任意输入流反序列化 (文件与内存共用)
+    static std::shared_ptr<GASAsset> LoadAssetFromStream(std::istream& Stream, const std::string& DebugName);
+
     //辅助函数：将内存块写入文件
     static bool WriteData(std::ofstream& Stream, const void* Data, size_t Size);
 
     // 辅助函数：从文件读取内存块 
-    static bool ReadData(std::ifstream& Stream, void* Data, size_t Size);
+    static bool ReadData(std::istream& Stream, void* Data, size_t Size);
 
     //辅助函数：写入 Skeleton 专有数据
     static bool SerializeSkeleton(std::ofstream& Stream, const GASSkeleton* Skeleton);
@@ -33,12 +39,24 @@ private:
     //辅助函数：写入 Mesh专有数据 
     static bool SerializeMesh(std::ofstream& Stream, const GASMesh* Mesh);
 
+    //辅助函数：写入 VAT 专有数据
+    static bool SerializeVertexAnimation(std::ofstream& Stream, const GASVertexAnimation* VAT);
+
+    //辅助函数：写入重定向表
+    static bool SerializeRetargetMap(std::ofstream& Stream, const GASRetargetMap* Map);
+
     //辅助函数：读取 Skeleton 专有数据 
-    static bool DeserializeSkeleton(std::ifstream& Stream, GASSkeleton* Skeleton);
+    static bool DeserializeSkeleton(std::istream& Stream, GASSkeleton* Skeleton);
 
     // 辅助函数：读取 Animation 专有数据 
-    static bool DeserializeAnimation(std::ifstream& Stream, GASAnimation* Animation);
+    static bool DeserializeAnimation(std::istream& Stream, GASAnimation* Animation);
 
     // 辅助函数：读取Mesh专有数据 
-    static bool DeserializeMesh(std::ifstream& Stream, GASMesh* Mesh);
+    static bool DeserializeMesh(std::istream& Stream, GASMesh* Mesh);
+
+    // 辅助函数：读取 VAT 专有数据
+    static bool DeserializeVertexAnimation(std::istream& Stream, GASVertexAnimation* VAT);
+
+    // 辅助函数：读取重定向表
+    static bool DeserializeRetargetMap(std::istream& Stream, GASRetargetMap* Map);
 };
\ No newline at end of file
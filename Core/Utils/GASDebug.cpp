@@ -1,5 +1,17 @@
 ﻿#pragma once
 #include"GASDebug.h"
+#include <chrono>
+#include <iomanip>
+#include <random>
+#include "GASSimdMath.h"
+#include "GASAnimEventBuilder.h"
+#include "GASVertexCompression.h"
+#include "GASRootMotionExtractor.h"
+#include "../../Runtime/Animation/GASIKSolver.h"
+#include "../../Runtime/Animation/GASAnimGraph.h"
+#if defined(_MSC_VER) && defined(_DEBUG)
+#include <crtdbg.h>
+#endif
 #pragma comment(lib, "opengl32.lib")
 #pragma comment(lib, "glu32.lib")
 #pragma comment(lib, "user32.lib")
@@ -96,6 +108,731 @@ bool RunImportTest(const std::string& SourceFBX)
     return false;
 }
 
+bool RunLODTest(const std::string& SourceFBX)
+{
+    std::cout << "\n------------------------------------------" << std::endl;
+    std::cout << "[Test] LOD test for: " << SourceFBX << std::endl;
+
+    if (!fs::exists(SourceFBX))
+    {
+        std::cerr << "[Test] Error: Source file not found: " << SourceFBX << std::endl;
+        return false;
+    }
+
+    GASImporter Importer;
+    std::shared_ptr<GASSkeleton> Skeleton;
+    std::vector<std::shared_ptr<GASAnimation>> Animations;
+    std::vector<std::shared_ptr<GASMesh>> Meshes;
+    if (!Importer.ImportFromFile(SourceFBX, Skeleton, Animations, Meshes) || Meshes.empty())
+    {
+        std::cerr << "[Test] Import FAILED for " << SourceFBX << std::endl;
+        return false;
+    }
+
+    bool bPassed = true;
+    for (const auto& Mesh : Meshes)
+    {
+        uint32_t LOD0Triangles = 0;
+        for (const FGASSubMesh& SubMesh : Mesh->SubMeshes) LOD0Triangles += SubMesh.IndexCount / 3;
+
+        std::cout << "       - " << Mesh->AssetName << ": LOD0 " << LOD0Triangles << " triangles, " << Mesh->Vertices.Num() << " vertices" << std::endl;
+        for (int32_t l = 0; l < Mesh->LODs.Num(); ++l)
+        {
+            const FGASMeshLOD& LOD = Mesh->LODs[l];
+            std::cout << "         LOD" << (l + 1) << " " << LOD.NumTriangles << " triangles, " << LOD.NumVertices << " vertices, error " << LOD.MaxError << std::endl;
+        }
+
+        if (Mesh->LODs.Num() == 0 || Mesh->LODs[0].NumTriangles >= LOD0Triangles)
+        {
+            std::cerr << "[Test] LOD FAILED: " << Mesh->AssetName << " has no reduced LOD1" << std::endl;
+            bPassed = false;
+        }
+    }
+
+    std::cout << (bPassed ? "[Test] LOD SUCCESS" : "[Test] LOD FAILED") << std::endl;
+    return bPassed;
+}
+
+bool RunTangentSignTest()
+{
+    std::cout << "\n------------------------------------------" << std::endl;
+    std::cout << "[Test] Tangent sign test" << std::endl;
+
+    // 两个并排的四边形 (法线 +Z)：左侧 UV 正常，右侧 U 方向镜像
+    // 切线/副切线按 Assimp CalcTangentSpace 的方式由三角形 UV 导数求得
+    GASMesh Mesh;
+    Mesh.Vertices.Resize(8);
+    for (int32_t q = 0; q < 2; ++q)
+    {
+        const bool bMirrored = (q == 1);
+        for (int32_t c = 0; c < 4; ++c)
+        {
+            const float X = (float)(c & 1), Y = (float)(c >> 1);
+            FGASSkinVertex& Vertex = Mesh.Vertices[q * 4 + c];
+            Vertex = FGASSkinVertex();
+            Vertex.Position = FGASVector3(X + q * 2.0f, Y, 0.0f);
+            Vertex.Normal = FGASVector3(0.0f, 0.0f, 1.0f);
+            Vertex.UV = FGASVector3(bMirrored ? 1.0f - X : X, Y, 0.0f);
+            Vertex.BoneWeights.Weights[0] = 1.0f;
+        }
+
+        const FGASSkinVertex& V0 = Mesh.Vertices[q * 4 + 0];
+        const FGASSkinVertex& V1 = Mesh.Vertices[q * 4 + 1];
+        const FGASSkinVertex& V2 = Mesh.Vertices[q * 4 + 2];
+        const FGASVector3 Edge1 = GASMath::Subtract(V1.Position, V0.Position), Edge2 = GASMath::Subtract(V2.Position, V0.Position);
+        const float DU1 = V1.UV.X - V0.UV.X, DV1 = V1.UV.Y - V0.UV.Y, DU2 = V2.UV.X - V0.UV.X, DV2 = V2.UV.Y - V0.UV.Y;
+        const float InvDet = 1.0f / (DU1 * DV2 - DU2 * DV1);
+        const FGASVector3 Tangent = GASMath::Normalize(GASMath::Scale(GASMath::Subtract(GASMath::Scale(Edge1, DV2), GASMath::Scale(Edge2, DV1)), InvDet));
+        const FGASVector3 Bitangent = GASMath::Normalize(GASMath::Scale(GASMath::Subtract(GASMath::Scale(Edge2, DU1), GASMath::Scale(Edge1, DU2)), InvDet));
+        for (int32_t c = 0; c < 4; ++c)
+        {
+            Mesh.Vertices[q * 4 + c].Tangent = Tangent;
+            Mesh.Vertices[q * 4 + c].Bitangent = Bitangent;
+        }
+    }
+
+    if (!GASVertexCompression::BuildCompactStreams(&Mesh))
+    {
+        std::cerr << "[Test] Tangent sign FAILED: BuildCompactStreams" << std::endl;
+        return false;
+    }
+
+    const FGASVertexCompressionError Error = GASVertexCompression::Validate(&Mesh);
+    bool bPassed = Error.TangentSignMismatches == 0;
+    for (int32_t i = 0; i < Mesh.Vertices.Num(); ++i)
+    {
+        const int16_t Expected = (i < 4) ? 1 : -1;
+        if (Mesh.CompactShading[i].TangentSign != Expected) bPassed = false;
+    }
+
+    std::cout << "       - Tangent sign mismatches: " << Error.TangentSignMismatches
+        << ", mirrored sign " << (int)Mesh.CompactShading[4].TangentSign << std::endl;
+    std::cout << (bPassed ? "[Test] Tangent sign SUCCESS" : "[Test] Tangent sign FAILED") << std::endl;
+    return bPassed;
+}
+
+// 返回每个元素的平均纳秒数
+template<typename FuncType>
+static double MeasureNanoseconds(int32_t Count, int32_t Iterations, FuncType&& Func)
+{
+    const auto Start = std::chrono::high_resolution_clock::now();
+    for (int32_t i = 0; i < Iterations; ++i) Func();
+    const auto End = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(End - Start).count() / ((double)Count * Iterations);
+}
+
+static float MaxError(const float* A, const float* B, size_t NumFloats)
+{
+    float Error = 0.0f;
+    for (size_t i = 0; i < NumFloats; ++i) Error = std::max(Error, std::fabs(A[i] - B[i]));
+    return Error;
+}
+
+static bool ReportBenchmark(const char* Name, double ScalarNs, double SimdNs, float Error, float Tolerance)
+{
+    const bool bPassed = Error <= Tolerance;
+    std::cout << "[Bench] " << std::left << std::setw(20) << Name << std::right << std::fixed << std::setprecision(2)
+        << " scalar " << std::setw(7) << ScalarNs << " ns  simd " << std::setw(7) << SimdNs << " ns  x" << std::setw(5) << (SimdNs > 0.0 ? ScalarNs / SimdNs : 0.0)
+        << std::scientific << "  max error " << Error << std::defaultfloat << (bPassed ? "" : "  (FAILED)") << std::endl;
+    return bPassed;
+}
+
+bool RunMathBenchmark(int32_t Count, int32_t Iterations)
+{
+    if (Count <= 0 || Iterations <= 0) return false;
+
+    // 固定种子，非均匀缩放覆盖一般仿射矩阵
+    std::mt19937 Random(12345);
+    std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> ScaleRange(0.5f, 2.0f);
+
+    std::vector<FGASTransform> Transforms(Count);
+    std::vector<FGASQuaternion> QuatA(Count), QuatB(Count);
+    for (int32_t i = 0; i < Count; ++i)
+    {
+        FGASTransform& T = Transforms[i];
+        T.Translation = FGASVector3(Unit(Random) * 100.0f, Unit(Random) * 100.0f, Unit(Random) * 100.0f);
+        T.Rotation = GASMath::Normalize(FGASQuaternion(Unit(Random), Unit(Random), Unit(Random), Unit(Random)));
+        T.Scale = FGASVector3(ScaleRange(Random), ScaleRange(Random), ScaleRange(Random));
+        QuatA[i] = T.Rotation;
+        QuatB[i] = GASMath::Normalize(FGASQuaternion(Unit(Random), Unit(Random), Unit(Random), Unit(Random)));
+    }
+
+    std::vector<FGASMatrix4x4> Matrices(Count), MatricesB(Count), ScalarMatrices(Count), SimdMatrices(Count);
+    std::vector<FGASQuaternion> ScalarQuats(Count), SimdQuats(Count);
+    for (int32_t i = 0; i < Count; ++i)
+    {
+        Matrices[i] = GASMath::ToMatrix(Transforms[i]);
+        MatricesB[i] = GASMath::ToMatrix(Transforms[(i + 1) % Count]);
+    }
+
+    const size_t QuatFloats = (size_t)Count * 4;
+    const size_t MatrixFloats = (size_t)Count * 16;
+    bool bPassed = true;
+
+    std::cout << "\n[Bench] " << Count << " elements x " << Iterations << " iterations (SSE2 " << (GAS_SIMD_SSE ? "on" : "off") << ")" << std::endl;
+
+    double ScalarNs = MeasureNanoseconds(Count, Iterations, [&]() { for (int32_t i = 0; i < Count; ++i) ScalarQuats[i] = GASMath::Multiply(QuatA[i], QuatB[i]); });
+    double SimdNs = MeasureNanoseconds(Count, Iterations, [&]() { GASSimd::QuatMultiplyBatch(QuatA.data(), QuatB.data(), Count, SimdQuats.data()); });
+    bPassed &= ReportBenchmark("QuatMultiply", ScalarNs, SimdNs, MaxError(&ScalarQuats[0].X, &SimdQuats[0].X, QuatFloats), 1e-5f);
+
+    ScalarNs = MeasureNanoseconds(Count, Iterations, [&]()
+    {
+        for (int32_t i = 0; i < Count; ++i)
+        {
+            const FGASQuaternion& A = QuatA[i];
+            const FGASQuaternion& B = QuatB[i];
+            const float Sign = (A.X * B.X + A.Y * B.Y + A.Z * B.Z + A.W * B.W) < 0.0f ? -0.3f : 0.3f;
+            ScalarQuats[i] = GASMath::Normalize(FGASQuaternion(A.X * 0.7f + B.X * Sign, A.Y * 0.7f + B.Y * Sign, A.Z * 0.7f + B.Z * Sign, A.W * 0.7f + B.W * Sign));
+        }
+    });
+    SimdNs = MeasureNanoseconds(Count, Iterations, [&]() { GASSimd::QuatNlerpBatch(QuatA.data(), QuatB.data(), 0.3f, Count, SimdQuats.data()); });
+    bPassed &= ReportBenchmark("QuatNlerp", ScalarNs, SimdNs, MaxError(&ScalarQuats[0].X, &SimdQuats[0].X, QuatFloats), 1e-5f);
+
+    ScalarNs = MeasureNanoseconds(Count, Iterations, [&]() { for (int32_t i = 0; i < Count; ++i) ScalarMatrices[i] = GASMath::ToMatrix(Transforms[i]); });
+    SimdNs = MeasureNanoseconds(Count, Iterations, [&]() { GASSimd::ComposeTransformBatch(Transforms.data(), Count, SimdMatrices.data()); });
+    bPassed &= ReportBenchmark("ComposeTransform", ScalarNs, SimdNs, MaxError(&ScalarMatrices[0].M[0][0], &SimdMatrices[0].M[0][0], MatrixFloats), 1e-4f);
+
+    ScalarNs = MeasureNanoseconds(Count, Iterations, [&]() { for (int32_t i = 0; i < Count; ++i) ScalarMatrices[i] = GASMath::Multiply(Matrices[i], MatricesB[i]); });
+    SimdNs = MeasureNanoseconds(Count, Iterations, [&]() { GASSimd::AffineMultiplyBatch(Matrices.data(), MatricesB.data(), Count, SimdMatrices.data()); });
+    bPassed &= ReportBenchmark("AffineMultiply", ScalarNs, SimdNs, MaxError(&ScalarMatrices[0].M[0][0], &SimdMatrices[0].M[0][0], MatrixFloats), 1e-3f);
+
+    ScalarNs = MeasureNanoseconds(Count, Iterations, [&]() { for (int32_t i = 0; i < Count; ++i) ScalarMatrices[i] = GASMath::Inverse(Matrices[i]); });
+    SimdNs = MeasureNanoseconds(Count, Iterations, [&]() { GASSimd::AffineInverseBatch(Matrices.data(), Count, SimdMatrices.data()); });
+    bPassed &= ReportBenchmark("AffineInverse", ScalarNs, SimdNs, MaxError(&ScalarMatrices[0].M[0][0], &SimdMatrices[0].M[0][0], MatrixFloats), 1e-3f);
+
+    ScalarNs = MeasureNanoseconds(Count, Iterations, [&]() { for (int32_t i = 0; i < Count; ++i) ScalarQuats[i] = GASMath::ToQuaternion(Matrices[i]); });
+    SimdNs = MeasureNanoseconds(Count, Iterations, [&]() { GASSimd::ToQuaternionBatch(Matrices.data(), Count, SimdQuats.data()); });
+    bPassed &= ReportBenchmark("ToQuaternion", ScalarNs, SimdNs, MaxError(&ScalarQuats[0].X, &SimdQuats[0].X, QuatFloats), 1e-4f);
+
+    return bPassed;
+}
+
+// 暴力参考：事件 Index 是否落在 [StartTime, EndTime)，循环时取第一个不早于 StartTime 的周期副本
+static bool IsEventCrossed(const GASAnimation& Animation, int32_t Index, float StartTime, float EndTime, bool bLooping, float LoopLength)
+{
+    const float Time = Animation.Events[Index].Time;
+    if (!bLooping) return Time >= StartTime && Time < EndTime;
+    if (EndTime - StartTime >= LoopLength) return true;
+    return Time + std::ceil((StartTime - Time) / LoopLength) * LoopLength < EndTime;
+}
+
+bool RunEventQueryTest(int32_t NumQueries)
+{
+    std::cout << "\n------------------------------------------" << std::endl;
+    std::cout << "[Test] Event query test: " << NumQueries << " random ranges" << std::endl;
+
+    // 周期 2 秒；事件与查询时刻都取 1/64 秒的整数倍，浮点运算精确，区间端点恰好落在事件上时也能与暴力结果逐一比较
+    GASAnimation Animation;
+    Animation.AnimHeader = {};
+    Animation.AnimHeader.FrameCount = 61;
+    Animation.AnimHeader.FrameRate = 30.0f;
+    const float LoopLength = 2.0f;
+    const float Step = 1.0f / 64.0f;
+
+    std::mt19937 Random(2024);
+    std::uniform_int_distribution<int32_t> EventSlot(0, 128);
+    GASAnimEventBuilder::AddEvent(&Animation, 0.0f, "Start");
+    GASAnimEventBuilder::AddEvent(&Animation, LoopLength, "End");
+    for (int32_t i = 0; i < 40; ++i)
+    {
+        // 槽位范围小，会出现同一时刻的多个事件
+        GASAnimEventBuilder::AddEvent(&Animation, EventSlot(Random) * Step, "Event" + std::to_string(i));
+    }
+    GASAnimEventBuilder::SortEvents(&Animation);
+    const int32_t NumEvents = Animation.Events.Num();
+
+    std::uniform_int_distribution<int32_t> StartSlot(-384, 384);
+    std::uniform_int_distribution<int32_t> ShortSpan(0, 16);
+    std::uniform_int_distribution<int32_t> LongSpan(0, 320);
+    std::vector<int32_t> Hits(NumEvents);
+    int32_t NumFailed = 0;
+    for (int32_t q = 0; q < NumQueries; ++q)
+    {
+        const bool bLooping = (q % 3) != 0;
+        const float StartTime = StartSlot(Random) * Step;
+        const float EndTime = StartTime + ((q % 4) == 0 ? LongSpan(Random) : ShortSpan(Random)) * Step;
+
+        FGASAnimEventRange Ranges[2];
+        const int32_t NumRanges = Animation.QueryEvents(StartTime, EndTime, bLooping, Ranges);
+        std::fill(Hits.begin(), Hits.end(), 0);
+        for (int32_t r = 0; r < NumRanges; ++r)
+        {
+            for (int32_t i = 0; i < Ranges[r].Count; ++i) ++Hits[Ranges[r].First + i];
+        }
+
+        for (int32_t i = 0; i < NumEvents; ++i)
+        {
+            const int32_t Expected = IsEventCrossed(Animation, i, StartTime, EndTime, bLooping, LoopLength) ? 1 : 0;
+            if (Hits[i] == Expected) continue;
+            if (NumFailed++ < 8)
+            {
+                std::cout << "       - Mismatch: [" << StartTime << ", " << EndTime << ") looping " << bLooping
+                    << " event " << i << " at " << Animation.Events[i].Time << " hit " << Hits[i] << " expected " << Expected << std::endl;
+            }
+        }
+    }
+
+    // 逐帧推进五个周期 (步长随机，最后一帧截到终点)：每个事件恰好命中五次
+    std::fill(Hits.begin(), Hits.end(), 0);
+    std::uniform_int_distribution<int32_t> TickSpan(1, 20);
+    const float TotalTime = 5.0f * LoopLength;
+    for (float Time = 0.0f; Time < TotalTime;)
+    {
+        const float Next = std::min(Time + TickSpan(Random) * Step * 0.5f, TotalTime);
+        FGASAnimEventRange Ranges[2];
+        const int32_t NumRanges = Animation.QueryEvents(Time, Next, true, Ranges);
+        for (int32_t r = 0; r < NumRanges; ++r)
+        {
+            for (int32_t i = 0; i < Ranges[r].Count; ++i) ++Hits[Ranges[r].First + i];
+        }
+        Time = Next;
+    }
+    for (int32_t i = 0; i < NumEvents; ++i)
+    {
+        if (Hits[i] == 5) continue;
+        if (NumFailed++ < 8)
+        {
+            std::cout << "       - Tick walk: event " << i << " at " << Animation.Events[i].Time << " hit " << Hits[i] << " times over 5 loops" << std::endl;
+        }
+    }
+
+    std::cout << "       - " << NumEvents << " events, " << NumFailed << " mismatches" << std::endl;
+    std::cout << (NumFailed == 0 ? "[Test] Event query SUCCESS" : "[Test] Event query FAILED") << std::endl;
+    return NumFailed == 0;
+}
+
+// Key * Transform (Key 为模型空间的水平位移 + 绕 Y 轴转向)
+static FGASTransform ApplyRootMotion(const FGASRootMotionKey& Key, const FGASTransform& Transform)
+{
+    const FGASQuaternion Yaw(0.0f, std::sin(Key.Yaw * 0.5f), 0.0f, std::cos(Key.Yaw * 0.5f));
+    FGASTransform Out = Transform;
+    Out.Translation = GASMath::Add(Key.Translation, GASMath::RotateVector(Yaw, Transform.Translation));
+    Out.Rotation = GASMath::Normalize(GASMath::Multiply(Yaw, Transform.Rotation));
+    return Out;
+}
+
+// 位置差 + 旋转差 (1 - |dot|)
+static float TransformDistance(const FGASTransform& A, const FGASTransform& B)
+{
+    const float Dot = A.Rotation.X * B.Rotation.X + A.Rotation.Y * B.Rotation.Y + A.Rotation.Z * B.Rotation.Z + A.Rotation.W * B.Rotation.W;
+    return GASMath::Length(GASMath::Subtract(A.Translation, B.Translation)) + (1.0f - std::fabs(Dot));
+}
+
+bool RunRootMotionTest()
+{
+    std::cout << "\n------------------------------------------" << std::endl;
+    std::cout << "[Test] Root motion test" << std::endl;
+
+    GASSkeleton Skeleton;
+    Skeleton.Bones.Resize(2);
+    SetGASBoneName(Skeleton.Bones[0], "Root");
+    SetGASBoneName(Skeleton.Bones[1], "Spine");
+    Skeleton.Bones[0].ParentIndex = -1;
+    Skeleton.Bones[1].ParentIndex = 0;
+    Skeleton.RebuildBoneMap();
+
+    // 根骨骼不在原点且带侧倾：一秒内转身 90 度并向前移动 1.5 米
+    const int32_t NumFrames = 31;
+    GASAnimation Animation;
+    Animation.AnimHeader = {};
+    Animation.AnimHeader.TrackCount = 2;
+    Animation.AnimHeader.FrameCount = NumFrames;
+    Animation.AnimHeader.FrameRate = 30.0f;
+    Animation.AnimHeader.Duration = 1.0f;
+    Animation.Tracks.Resize(2 * NumFrames);
+    const FGASQuaternion Roll = GASMath::Normalize(FGASQuaternion(std::sin(0.1f), 0.0f, 0.0f, std::cos(0.1f)));
+    for (int32_t f = 0; f < NumFrames; ++f)
+    {
+        const float S = (float)f / (NumFrames - 1);
+        const float Yaw = S * GASMath::PI * 0.5f;
+        FGASTransform& Root = Animation.Tracks[f * 2].LocalTransform;
+        Root.Translation = FGASVector3(1.0f, 0.9f, 1.5f * S);
+        Root.Rotation = GASMath::Normalize(GASMath::Multiply(FGASQuaternion(0.0f, std::sin(Yaw * 0.5f), 0.0f, std::cos(Yaw * 0.5f)), Roll));
+        Animation.Tracks[f * 2 + 1].LocalTransform.Translation = FGASVector3(0.0f, 0.3f, 0.0f);
+    }
+    std::vector<FGASTransform> Original(NumFrames);
+    for (int32_t f = 0; f < NumFrames; ++f) Original[f] = Animation.Tracks[f * 2].LocalTransform;
+
+    FGASRootMotionSettings Settings;
+    if (!GASRootMotionExtractor::Extract(&Animation, &Skeleton, Settings))
+    {
+        std::cerr << "[Test] Root motion FAILED: Extract" << std::endl;
+        return false;
+    }
+
+    // 1. Key * 新轨道 = 原轨道；2. 新轨道的水平位置与朝向恒等于第 0 帧
+    float ReconstructError = 0.0f, DriftError = 0.0f;
+    const FGASTransform& Rebased0 = Animation.Tracks[0].LocalTransform;
+    for (int32_t f = 0; f < NumFrames; ++f)
+    {
+        const FGASTransform& Rebased = Animation.Tracks[f * 2].LocalTransform;
+        ReconstructError = std::max(ReconstructError, TransformDistance(ApplyRootMotion(Animation.RootMotion[f], Rebased), Original[f]));
+        DriftError = std::max(DriftError, TransformDistance(Rebased, Rebased0));
+    }
+
+    // 3. 循环衔接：第 k - 1 圈末帧与第 k 圈首帧是同一时刻，世界空间根骨骼应重合
+    float LoopError = 0.0f;
+    const float LoopLength = (float)(NumFrames - 1) / Animation.AnimHeader.FrameRate;
+    for (int32_t k = 1; k <= 3; ++k)
+    {
+        FGASRootMotionKey PreviousLoop, CurrentLoop;
+        Animation.GetRootMotion(0.0f, (k - 1) * LoopLength, true, PreviousLoop);
+        Animation.GetRootMotion(0.0f, k * LoopLength, true, CurrentLoop);
+        const FGASTransform LoopEnd = ApplyRootMotion(GASAnimation::ComposeRootMotion(PreviousLoop, Animation.RootMotion[NumFrames - 1]), Animation.Tracks[(NumFrames - 1) * 2].LocalTransform);
+        const FGASTransform LoopStart = ApplyRootMotion(CurrentLoop, Rebased0);
+        LoopError = std::max(LoopError, TransformDistance(LoopEnd, LoopStart));
+    }
+
+    std::cout << "       - Reconstruct error " << ReconstructError << ", drift from frame 0 " << DriftError << ", loop seam " << LoopError << std::endl;
+    const bool bPassed = ReconstructError < 1e-4f && DriftError < 1e-4f && LoopError < 1e-4f;
+    std::cout << (bPassed ? "[Test] Root motion SUCCESS" : "[Test] Root motion FAILED") << std::endl;
+    return bPassed;
+}
+
+static FGASVector3 GetSoA(const FGASVector3SoA& Array, int32_t Index) { return FGASVector3(Array.X[Index], Array.Y[Index], Array.Z[Index]); }
+static void SetSoA(const FGASVector3SoA& Array, int32_t Index, const FGASVector3& Value) { Array.X[Index] = Value.X; Array.Y[Index] = Value.Y; Array.Z[Index] = Value.Z; }
+
+// 以 Origin 为球心、半径 [MinRadius, MaxRadius] 内的随机点
+static FGASVector3 RandomPointInShell(std::mt19937& Random, const FGASVector3& Origin, float MinRadius, float MaxRadius)
+{
+    std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> Radius(MinRadius, MaxRadius);
+    FGASVector3 Direction;
+    do { Direction = FGASVector3(Unit(Random), Unit(Random), Unit(Random)); } while (GASMath::LengthSq(Direction) < 0.01f);
+    return GASMath::Add(Origin, GASMath::Scale(GASMath::Normalize(Direction), Radius(Random)));
+}
+
+bool RunIKTest(int32_t NumInstances)
+{
+    std::cout << "\n------------------------------------------" << std::endl;
+    std::cout << "[Test] IK test: " << NumInstances << " instances" << std::endl;
+    if (NumInstances <= 0) return false;
+
+    // 骨骼：Pelvis -> Thigh -> Shin -> Foot (腿)；Pelvis -> Spine -> Spine1 -> Spine2 -> Spine3 -> Hand (5 关节链)
+    const char* BoneNames[] = { "Pelvis", "Thigh", "Shin", "Foot", "Spine", "Spine1", "Spine2", "Spine3", "Hand" };
+    const int32_t ParentIndices[] = { -1, 0, 1, 2, 0, 4, 5, 6, 7 };
+    const int32_t NumBones = 9;
+    GASSkeleton Skeleton;
+    Skeleton.Bones.Resize(NumBones);
+    for (int32_t b = 0; b < NumBones; ++b)
+    {
+        SetGASBoneName(Skeleton.Bones[b], BoneNames[b]);
+        Skeleton.Bones[b].ParentIndex = ParentIndices[b];
+    }
+    Skeleton.RebuildBoneMap();
+
+    FGASIKChain Leg, Arm;
+    if (!GASIKSolver::FindChain(&Skeleton, "Thigh", "Foot", Leg) || !GASIKSolver::FindChain(&Skeleton, "Spine", "Hand", Arm))
+    {
+        std::cout << "[Test] IK FAILED: FindChain" << std::endl;
+        return false;
+    }
+
+    // 随机局部姿态 (旋转随机，骨骼长度固定)
+    std::mt19937 Random(7);
+    std::uniform_real_distribution<float> Unit(-1.0f, 1.0f);
+    auto RandomRotation = [&](float Amount) { return GASMath::Normalize(FGASQuaternion(Unit(Random) * Amount, Unit(Random) * Amount, Unit(Random) * Amount, 1.0f)); };
+    const float ThighLength = 0.45f, ShinLength = 0.42f, SpineLength = 0.25f;
+    std::vector<FGASTransform> LocalPoses((size_t)NumInstances * NumBones), ModelPoses((size_t)NumInstances * NumBones);
+    for (int32_t i = 0; i < NumInstances; ++i)
+    {
+        FGASTransform* Local = &LocalPoses[(size_t)i * NumBones];
+        Local[0].Translation = FGASVector3(Unit(Random), 1.0f, Unit(Random));
+        Local[1].Translation = FGASVector3(0.1f, 0.0f, 0.0f);
+        Local[2].Translation = FGASVector3(0.0f, -ThighLength, 0.0f);
+        Local[3].Translation = FGASVector3(0.0f, -ShinLength, 0.0f);
+        Local[4].Translation = FGASVector3(0.0f, 0.2f, 0.0f);
+        for (int32_t b = 1; b < NumBones; ++b)
+        {
+            if (b > 4) Local[b].Translation = FGASVector3(0.0f, SpineLength, 0.0f);
+            Local[b].Rotation = RandomRotation(0.3f);
+        }
+        GASIKSolver::ComputeModelPose(&Skeleton, Local, &ModelPoses[(size_t)i * NumBones]);
+    }
+
+    // 两骨骼：目标在可达范围内随机
+    std::vector<float> TwoBoneData((size_t)NumInstances * 15);
+    auto TwoBoneArray = [&](int32_t Slot) { FGASVector3SoA Array; Array.X = &TwoBoneData[(size_t)(Slot * 3 + 0) * NumInstances]; Array.Y = &TwoBoneData[(size_t)(Slot * 3 + 1) * NumInstances]; Array.Z = &TwoBoneData[(size_t)(Slot * 3 + 2) * NumInstances]; return Array; };
+    FGASTwoBoneIKBatch TwoBone;
+    TwoBone.NumInstances = NumInstances;
+    TwoBone.Root = TwoBoneArray(0);
+    TwoBone.Mid = TwoBoneArray(1);
+    TwoBone.End = TwoBoneArray(2);
+    TwoBone.Target = TwoBoneArray(3);
+    TwoBone.Pole = TwoBoneArray(4);
+    const float LegReach = ThighLength + ShinLength;
+    for (int32_t i = 0; i < NumInstances; ++i)
+    {
+        const FGASTransform* Model = &ModelPoses[(size_t)i * NumBones];
+        SetSoA(TwoBone.Root, i, Model[1].Translation);
+        SetSoA(TwoBone.Mid, i, Model[2].Translation);
+        SetSoA(TwoBone.End, i, Model[3].Translation);
+        SetSoA(TwoBone.Target, i, RandomPointInShell(Random, Model[1].Translation, 0.2f * LegReach, 0.95f * LegReach));
+        SetSoA(TwoBone.Pole, i, GASMath::Add(Model[2].Translation, FGASVector3(0.0f, 0.0f, 1.0f)));
+    }
+    GASIKSolver::SolveTwoBoneBatch(TwoBone);
+
+    // 解出的位置、写回局部旋转后重新求得的模型空间位置，两者都与目标和骨骼长度对照
+    float SolvedError = 0.0f, AppliedError = 0.0f, TwoBoneLengthError = 0.0f;
+    std::vector<FGASTransform> CheckPose(NumBones);
+    for (int32_t i = 0; i < NumInstances; ++i)
+    {
+        const FGASVector3 Target = GetSoA(TwoBone.Target, i);
+        const FGASVector3 Solved[3] = { GetSoA(TwoBone.Root, i), GetSoA(TwoBone.Mid, i), GetSoA(TwoBone.End, i) };
+        SolvedError = std::max(SolvedError, GASMath::Length(GASMath::Subtract(Solved[2], Target)));
+
+        FGASTransform* Local = &LocalPoses[(size_t)i * NumBones];
+        GASIKSolver::ApplyChain(&Skeleton, Leg, Solved, true, Local, &ModelPoses[(size_t)i * NumBones]);
+        GASIKSolver::ComputeModelPose(&Skeleton, Local, CheckPose.data());
+        AppliedError = std::max(AppliedError, GASMath::Length(GASMath::Subtract(CheckPose[3].Translation, Target)));
+        TwoBoneLengthError = std::max(TwoBoneLengthError, std::fabs(GASMath::Length(GASMath::Subtract(CheckPose[2].Translation, CheckPose[1].Translation)) - ThighLength));
+        TwoBoneLengthError = std::max(TwoBoneLengthError, std::fabs(GASMath::Length(GASMath::Subtract(CheckPose[3].Translation, CheckPose[2].Translation)) - ShinLength));
+    }
+
+    // FABRIK：5 关节链，目标在可达范围内随机；接近伸直的目标收敛慢，10 次迭代最大误差约 3.5cm，64 次约 0.1mm
+    const int32_t NumJoints = Arm.NumBones;
+    const float ArmReach = SpineLength * (NumJoints - 1);
+    std::vector<float> Positions((size_t)NumJoints * 3 * NumInstances), TargetData((size_t)3 * NumInstances);
+    FGASFabrikBatch Fabrik;
+    Fabrik.NumInstances = NumInstances;
+    Fabrik.NumJoints = NumJoints;
+    Fabrik.Positions = Positions.data();
+    Fabrik.Target.X = &TargetData[0];
+    Fabrik.Target.Y = &TargetData[NumInstances];
+    Fabrik.Target.Z = &TargetData[(size_t)2 * NumInstances];
+    Fabrik.NumIterations = 64;
+    auto JointPosition = [&](int32_t Joint, int32_t Instance)
+    {
+        return FGASVector3(Positions[(size_t)(Joint * 3 + 0) * NumInstances + Instance], Positions[(size_t)(Joint * 3 + 1) * NumInstances + Instance], Positions[(size_t)(Joint * 3 + 2) * NumInstances + Instance]);
+    };
+    for (int32_t i = 0; i < NumInstances; ++i)
+    {
+        const FGASTransform* Model = &ModelPoses[(size_t)i * NumBones];
+        for (int32_t j = 0; j < NumJoints; ++j)
+        {
+            const FGASVector3& P = Model[Arm.Bones[j]].Translation;
+            Positions[(size_t)(j * 3 + 0) * NumInstances + i] = P.X;
+            Positions[(size_t)(j * 3 + 1) * NumInstances + i] = P.Y;
+            Positions[(size_t)(j * 3 + 2) * NumInstances + i] = P.Z;
+        }
+        SetSoA(Fabrik.Target, i, RandomPointInShell(Random, Model[Arm.Bones[0]].Translation, 0.3f * ArmReach, 0.9f * ArmReach));
+    }
+    GASIKSolver::SolveFabrikBatch(Fabrik);
+
+    float FabrikMaxError = 0.0f, FabrikMeanError = 0.0f, FabrikLengthError = 0.0f;
+    for (int32_t i = 0; i < NumInstances; ++i)
+    {
+        const float Error = GASMath::Length(GASMath::Subtract(JointPosition(NumJoints - 1, i), GetSoA(Fabrik.Target, i)));
+        FabrikMaxError = std::max(FabrikMaxError, Error);
+        FabrikMeanError += Error / NumInstances;
+        for (int32_t j = 1; j < NumJoints; ++j)
+        {
+            FabrikLengthError = std::max(FabrikLengthError, std::fabs(GASMath::Length(GASMath::Subtract(JointPosition(j, i), JointPosition(j - 1, i))) - SpineLength));
+        }
+    }
+
+    std::cout << "       - Two-bone: solved error " << SolvedError << ", applied error " << AppliedError << ", bone length error " << TwoBoneLengthError << std::endl;
+    std::cout << "       - FABRIK (" << NumJoints << " joints, " << Fabrik.NumIterations << " iterations): max error " << FabrikMaxError
+        << ", mean error " << FabrikMeanError << ", bone length error " << FabrikLengthError << std::endl;
+
+    const bool bPassed = SolvedError < 1e-4f && AppliedError < 1e-4f && TwoBoneLengthError < 1e-4f && FabrikMaxError < 1e-3f && FabrikLengthError < 1e-4f;
+    std::cout << (bPassed ? "[Test] IK SUCCESS" : "[Test] IK FAILED") << std::endl;
+    return bPassed;
+}
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+// 调试 CRT 分配钩子：统计期间的堆分配 (operator new 也经由 CRT 堆)
+static long GAllocationCount = 0;
+static int __cdecl CountAllocationHook(int AllocType, void*, size_t, int, long, const unsigned char*, int)
+{
+    if (AllocType == _HOOK_ALLOC || AllocType == _HOOK_REALLOC) ++GAllocationCount;
+    return TRUE;
+}
+#endif
+
+// 每帧平移 X = Tag、Y = 归一化进度的测试片段
+static void MakeGraphTestClip(GASAnimation& OutClip, int32_t NumBones, int32_t NumFrames, float Tag)
+{
+    OutClip.AnimHeader = {};
+    OutClip.AnimHeader.TrackCount = NumBones;
+    OutClip.AnimHeader.FrameCount = NumFrames;
+    OutClip.AnimHeader.FrameRate = 30.0f;
+    OutClip.AnimHeader.Duration = (float)(NumFrames - 1) / 30.0f;
+    OutClip.Tracks.Resize(NumBones * NumFrames);
+    for (int32_t f = 0; f < NumFrames; ++f)
+    {
+        for (int32_t b = 0; b < NumBones; ++b)
+        {
+            OutClip.Tracks[f * NumBones + b].LocalTransform.Translation = FGASVector3(Tag, (float)f / (NumFrames - 1), 0.0f);
+        }
+    }
+}
+
+bool RunAnimGraphTest(int32_t NumInstances, int32_t NumFrames)
+{
+    std::cout << "\n------------------------------------------" << std::endl;
+    std::cout << "[Test] Anim graph test: " << NumInstances << " instances x " << NumFrames << " frames" << std::endl;
+    if (NumInstances <= 0 || NumFrames <= 0) return false;
+
+    // 站立 (叠加倾斜) / 移动 (1D 混合空间) / 跳跃 (非循环) / 平移 (2D 混合空间)，覆盖全部指令与切换条件
+    const int32_t NumBones = 40;
+    GASAnimation Idle, LeanDelta, Walk, Run, Jump, Left, Right, Forward, Back;
+    MakeGraphTestClip(Idle, NumBones, 31, 0.0f);
+    MakeGraphTestClip(LeanDelta, NumBones, 31, 4.0f);
+    LeanDelta.AnimHeader.AdditiveType = EGASAdditiveType::FirstFrame;
+    MakeGraphTestClip(Walk, NumBones, 31, 1.0f);
+    MakeGraphTestClip(Run, NumBones, 21, 2.0f);
+    MakeGraphTestClip(Jump, NumBones, 16, 5.0f);
+    MakeGraphTestClip(Left, NumBones, 11, 10.0f);
+    MakeGraphTestClip(Right, NumBones, 11, 20.0f);
+    MakeGraphTestClip(Forward, NumBones, 11, 30.0f);
+    MakeGraphTestClip(Back, NumBones, 11, 40.0f);
+
+    GASAnimGraphBuilder Builder;
+    const int32_t Speed = Builder.AddParameter("Speed");
+    const int32_t JumpParam = Builder.AddParameter("Jump");
+    const int32_t DirX = Builder.AddParameter("DirX");
+    const int32_t DirY = Builder.AddParameter("DirY");
+    const int32_t Lean = Builder.AddParameter("Lean", 0.5f);
+
+    const int32_t IdleState = Builder.BeginState(true, 0);
+    Builder.PushClip(Builder.AddClip(&Idle));
+    Builder.PushClip(Builder.AddClip(&LeanDelta));
+    Builder.Additive(Lean);
+    Builder.EndState();
+    const int32_t MoveState = Builder.BeginState(true, 0);
+    Builder.PushBlendSpace1D(Speed, { { 1.0f, 0.0f, (uint32_t)Builder.AddClip(&Walk) }, { 3.0f, 0.0f, (uint32_t)Builder.AddClip(&Run) } });
+    Builder.EndState();
+    const int32_t JumpState = Builder.BeginState(false);
+    Builder.PushClip(Builder.AddClip(&Jump));
+    Builder.PushClip(Builder.AddClip(&Idle));
+    Builder.Blend(Lean);
+    Builder.EndState();
+    const int32_t StrafeState = Builder.BeginState(true);
+    Builder.PushBlendSpace2D(DirX, DirY, 2, 2, { { -1.0f, -1.0f, (uint32_t)Builder.AddClip(&Left) }, { 1.0f, -1.0f, (uint32_t)Builder.AddClip(&Right) },
+        { -1.0f, 1.0f, (uint32_t)Builder.AddClip(&Forward) }, { 1.0f, 1.0f, (uint32_t)Builder.AddClip(&Back) } });
+    Builder.EndState();
+    Builder.AddTransition(IdleState, MoveState, EGASAnimGraphCondition::Greater, Speed, 0.1f, 0.25f);
+    Builder.AddTransition(MoveState, IdleState, EGASAnimGraphCondition::Less, Speed, 0.1f, 0.25f);
+    Builder.AddTransition(MoveState, StrafeState, EGASAnimGraphCondition::Greater, DirX, 0.5f, 0.2f);
+    Builder.AddTransition(-1, JumpState, EGASAnimGraphCondition::Greater, JumpParam, 0.5f, 0.1f);
+    Builder.AddTransition(JumpState, IdleState, EGASAnimGraphCondition::PhaseAbove, 0, 1.0f, 0.2f);
+
+    GASAnimGraph Graph;
+    if (!Builder.Compile(Graph))
+    {
+        std::cout << "[Test] Anim graph FAILED: Compile" << std::endl;
+        return false;
+    }
+
+    // 叠加片段只能作为 Additive 的第二个操作数
+    bool bRejectsMisuse = true;
+    for (int32_t Case = 0; Case < 3; ++Case)
+    {
+        GASAnimGraphBuilder Bad;
+        const int32_t Weight = Bad.AddParameter("Weight", 0.5f);
+        Bad.BeginState();
+        Bad.PushClip(Bad.AddClip(Case == 2 ? &LeanDelta : &Idle));
+        if (Case == 0) { Bad.PushClip(Bad.AddClip(&Walk)); Bad.Additive(Weight); }
+        if (Case == 1) { Bad.PushClip(Bad.AddClip(&LeanDelta)); Bad.Blend(Weight); }
+        Bad.EndState();
+        GASAnimGraph BadGraph;
+        if (Bad.Compile(BadGraph)) bRejectsMisuse = false;
+    }
+
+    FGASAnimGraphContext Context;
+    Graph.InitContext(Context);
+    std::vector<FGASTransform> Pose(Graph.GetNumBones());
+
+    // 姿态数值：测试片段的平移 X 即混合后的 Tag，Y 为归一化进度
+    auto PoseX = [&](const FGASAnimGraphInstance& Instance) { return Graph.Evaluate(Instance, Context, Pose.data()) ? Pose[0].Translation.X : -1.0f; };
+    FGASAnimGraphInstance Probe;
+    Graph.InitInstance(Probe);
+    Graph.Advance(Probe, 0.3f);
+    const float AdditiveX = PoseX(Probe);
+    const float AdditiveY = Pose[0].Translation.Y;
+    const bool bAdditiveOk = std::fabs(AdditiveX - 4.0f * 0.5f) < 1e-4f && std::fabs(AdditiveY - Probe.CurrentPhase * 1.5f) < 1e-3f;
+
+    // 1D：Speed = 2 位于 Walk (1) 与 Run (3) 正中，淡化 (0.25 秒) 结束后 X = 1.5
+    Probe.Parameters[Speed] = 2.0f;
+    Graph.Advance(Probe, 0.0f);
+    for (int32_t k = 0; k < 10; ++k) Graph.Advance(Probe, 1.0f / 30.0f);
+    const float Blend1DX = PoseX(Probe);
+    const bool bBlend1DOk = Probe.CurrentState == MoveState && Probe.PreviousState < 0 && std::fabs(Blend1DX - 1.5f) < 1e-4f
+        && std::fabs(Graph.GetStateLength(MoveState, Probe) - (1.0f + 2.0f / 3.0f) * 0.5f) < 1e-5f;
+
+    // 同步组：移动 -> 站立 延续归一化进度
+    const float MovePhase = Probe.CurrentPhase;
+    Probe.Parameters[Speed] = 0.0f;
+    Graph.Advance(Probe, 0.0f);
+    const bool bSyncOk = Probe.CurrentState == IdleState && Probe.PreviousState == MoveState
+        && std::fabs(Probe.CurrentPhase - MovePhase) < 1e-6f && Probe.PreviousPhase == Probe.CurrentPhase;
+
+    // 交叉淡化中点：移动 (Speed = 0 钳制到 Walk，X = 1) 与站立 (X = 2) 各半
+    Graph.Advance(Probe, 0.125f);
+    const float FadeX = PoseX(Probe);
+    const bool bFadeOk = std::fabs(FadeX - 1.5f) < 1e-3f;
+
+    // 2D：DirX = 0.6、DirY = 0，X 方向权重 0.2/0.8，Y 方向各半
+    Probe.Parameters[Speed] = 2.0f;
+    Graph.Advance(Probe, 0.0f);
+    Probe.Parameters[DirX] = 0.6f;
+    Graph.Advance(Probe, 0.0f);
+    for (int32_t k = 0; k < 10; ++k) Graph.Advance(Probe, 1.0f / 30.0f);
+    const float Blend2DX = PoseX(Probe);
+    const float Expected2DX = 0.5f * (0.2f * 10.0f + 0.8f * 20.0f) + 0.5f * (0.2f * 30.0f + 0.8f * 40.0f);
+    const bool bBlend2DOk = Probe.CurrentState == StrafeState && std::fabs(Blend2DX - Expected2DX) < 1e-3f;
+
+    std::cout << "       - Poses: additive X " << AdditiveX << " (2), 1D X " << Blend1DX << " (1.5), 2D X " << Blend2DX << " (" << Expected2DX
+        << "), fade midpoint X " << FadeX << " (1.5), sync phase " << (bSyncOk ? "carried" : "lost")
+        << ", additive misuse " << (bRejectsMisuse ? "rejected" : "accepted") << std::endl;
+    const bool bPosesOk = bRejectsMisuse && bAdditiveOk && bBlend1DOk && bSyncOk && bFadeOk && bBlend2DOk;
+    std::vector<FGASAnimGraphInstance> Instances(NumInstances);
+    for (int32_t i = 0; i < NumInstances; ++i)
+    {
+        Graph.InitInstance(Instances[i]);
+        Instances[i].Parameters[Speed] = (i % 5) * 0.8f;
+        Instances[i].Parameters[DirX] = (i % 7) * 0.2f - 0.4f;
+        Instances[i].Parameters[DirY] = (i % 3) * 0.5f - 0.5f;
+    }
+
+    // 计时段内只有 Advance / Evaluate；每帧改写部分参数，让实例经历切换与淡化
+    const FGASTransform* PoseData = Context.Poses.data();
+    const size_t PoseCapacity = Context.Poses.capacity();
+    int32_t NumEvaluateFailed = 0;
+#if defined(_MSC_VER) && defined(_DEBUG)
+    GAllocationCount = 0;
+    _CRT_ALLOC_HOOK PreviousHook = _CrtSetAllocHook(CountAllocationHook);
+#endif
+    const auto Start = std::chrono::high_resolution_clock::now();
+    for (int32_t Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        for (int32_t i = Frame % 11; i < NumInstances; i += 11) Instances[i].Parameters[JumpParam] = (Frame & 1) ? 0.0f : 1.0f;
+        Graph.AdvanceBatch(Instances.data(), NumInstances, 1.0f / 30.0f);
+        for (int32_t i = 0; i < NumInstances; ++i)
+        {
+            if (!Graph.Evaluate(Instances[i], Context, Pose.data())) ++NumEvaluateFailed;
+        }
+    }
+    const auto End = std::chrono::high_resolution_clock::now();
+#if defined(_MSC_VER) && defined(_DEBUG)
+    _CrtSetAllocHook(PreviousHook);
+    const long NumAllocations = GAllocationCount;
+#else
+    const long NumAllocations = 0;
+    std::cout << "       - Heap allocation count needs a Debug build (_CrtSetAllocHook); only the context buffer is checked" << std::endl;
+#endif
+
+    const bool bContextStable = Context.Poses.data() == PoseData && Context.Poses.capacity() == PoseCapacity;
+    std::cout << "       - " << std::chrono::duration<double, std::milli>(End - Start).count() / NumFrames << " ms per frame, "
+        << NumAllocations << " heap allocations, " << NumEvaluateFailed << " failed evaluations, context buffer " << (bContextStable ? "unchanged" : "reallocated") << std::endl;
+
+    const bool bPassed = bPosesOk && NumAllocations == 0 && NumEvaluateFailed == 0 && bContextStable;
+    std::cout << (bPassed ? "[Test] Anim graph SUCCESS" : "[Test] Anim graph FAILED") << std::endl;
+    return bPassed;
+}
+
 void GASDebugAssimp::DrawLine(const FGASVector3& Start, const FGASVector3& End, const FGASVector3& Color)
 {
     glLineWidth(2.0f); // 线宽
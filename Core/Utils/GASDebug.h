@@ -12,6 +12,28 @@ void EnsureDirectoriesExist();
 
 bool RunImportTest(const std::string& SourceFBX);
 
+// 直接导入源文件 (不写缓存)，检查每个网格都生成了 LOD 且 LOD1 三角形数少于 LOD0
+bool RunLODTest(const std::string& SourceFBX);
+
+// 镜像 UV 四边形：检查紧凑顶点流的 TangentSign 与原始副切线一致
+bool RunTangentSignTest();
+
+// GASSimd 批量接口与 GASMath 标量版本的微基准：打印每元素耗时、加速比与最大误差，误差超出容差时返回 false
+bool RunMathBenchmark(int32_t Count = 4096, int32_t Iterations = 200);
+
+// GASAnimation::QueryEvents 与逐事件暴力扫描对照 (随机区间，含循环跨越、端点恰在事件上)，并逐帧推进五个周期检查每个事件恰好命中五次
+bool RunEventQueryTest(int32_t NumQueries = 200000);
+
+// 根骨骼不在原点且转身的片段：检查提取后轨道可还原、水平部分不漂移、循环点前后世界空间根骨骼连续
+bool RunRootMotionTest();
+
+// GASIKSolver 批量求解检查：可达目标下两骨骼的命中误差与骨骼长度 (含 ApplyChain 写回)、FABRIK 64 次迭代后每个实例的末端误差 (按最大值判定)
+bool RunIKTest(int32_t NumInstances = 1000);
+
+// GASAnimGraph：校验叠加/混合/淡化/同步组的姿态数值与非法叠加用法被拒绝；
+// 批量推进与求值在 Debug 构建下用 CRT 分配钩子统计计时段内的堆分配，要求为 0
+bool RunAnimGraphTest(int32_t NumInstances = 5000, int32_t NumFrames = 10);
+
 class GASAssimpLogStream : public Assimp::LogStream
 {
 public:
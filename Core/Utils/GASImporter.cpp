@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include "GASImporter.h"
 #include "GASDataConverter.h"
+#include "GASVertexCompression.h"
+#include "GASMath.h"
 #include "GASLogging.h"          
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
@@ -11,8 +13,82 @@
 
 #include "GASHashManager.h"
 #include "GASDebug.h"
+#include "GASAdditiveBuilder.h"
+#include "GASAnimEventBuilder.h"
 
 
+static uint64_t CombineHash(uint64_t Seed, uint64_t Value)
+{
+    return Seed ^ (Value + 0x9e3779b9 + (Seed << 6) + (Seed >> 2));
+}
+
+// 查找引用该 aiMesh 的第一个节点
+static const aiNode* FindMeshNode(const aiNode* Node, unsigned int MeshIndex)
+{
+    for (unsigned int i = 0; i < Node->mNumMeshes; ++i)
+    {
+        if (Node->mMeshes[i] == MeshIndex) return Node;
+    }
+    for (unsigned int i = 0; i < Node->mNumChildren; ++i)
+    {
+        if (const aiNode* Found = FindMeshNode(Node->mChildren[i], MeshIndex)) return Found;
+    }
+    return nullptr;
+}
+
+// 按规范化名称查找节点
+static const aiNode* FindBoneNode(const aiNode* Node, const std::string& NormalizedName)
+{
+    if (GASDataConverter::NormalizeBoneName(Node->mName.C_Str()) == NormalizedName) return Node;
+    for (unsigned int i = 0; i < Node->mNumChildren; ++i)
+    {
+        if (const aiNode* Found = FindBoneNode(Node->mChildren[i], NormalizedName)) return Found;
+    }
+    return nullptr;
+}
+
+static aiMatrix4x4 GetNodeGlobalTransform(const aiNode* Node)
+{
+    aiMatrix4x4 Global;
+    for (; Node; Node = Node->mParent) Global = Node->mTransformation * Global;
+    return Global;
+}
+
+// 没有骨骼的 aiMesh (道具、挂件) 刚性绑定到其节点最近的祖先骨骼，找不到时绑定根骨骼
+// OutTransform 把节点局部顶点变换到该骨骼的绑定空间，使绑定姿态下的蒙皮结果与场景中的位置一致
+static bool ComputeRigidBinding(const aiScene* Scene, const aiMesh* Mesh, const GASSkeleton* Skeleton, uint32_t& OutBone, FGASMatrix4x4& OutTransform)
+{
+    if (Skeleton->GetNumBones() == 0) return false;
+
+    unsigned int MeshIndex = 0;
+    while (MeshIndex < Scene->mNumMeshes && Scene->mMeshes[MeshIndex] != Mesh) ++MeshIndex;
+    const aiNode* MeshNode = FindMeshNode(Scene->mRootNode, MeshIndex);
+
+    int32_t BoneIndex = -1;
+    const aiNode* BoneNode = nullptr;
+    for (const aiNode* Node = MeshNode; Node && BoneIndex < 0; Node = Node->mParent)
+    {
+        BoneIndex = Skeleton->FindBoneIndex(GASDataConverter::NormalizeBoneName(Node->mName.C_Str()));
+        BoneNode = Node;
+    }
+    if (BoneIndex < 0)
+    {
+        BoneIndex = 0;
+        BoneNode = FindBoneNode(Scene->mRootNode, Skeleton->Bones[0].Name);
+    }
+
+    // 节点 -> 骨骼局部：BoneGlobal^-1 * NodeGlobal (Assimp 为列向量约定，转换后转置回列向量布局)
+    aiMatrix4x4 InverseBoneGlobal = BoneNode ? GetNodeGlobalTransform(BoneNode) : aiMatrix4x4();
+    InverseBoneGlobal.Inverse();
+    const aiMatrix4x4 NodeGlobal = MeshNode ? GetNodeGlobalTransform(MeshNode) : aiMatrix4x4();
+    const FGASMatrix4x4 NodeToBone = GASMath::Transpose(GASDataConverter::ToMatrix4x4(InverseBoneGlobal * NodeGlobal));
+
+    // 蒙皮为 BoneGlobal * IBM * v，绑定姿态下要得到 NodeGlobal * v，故 v' = IBM^-1 * NodeToBone * v
+    OutBone = (uint32_t)BoneIndex;
+    OutTransform = GASMath::Inverse(GASMath::ToMatrix4x4(Skeleton->Bones[BoneIndex].InverseBindMatrix)) * NodeToBone;
+    return true;
+}
+
 GASImporter::GASImporter() {}
 GASImporter::~GASImporter() {}
 
@@ -29,11 +105,13 @@ bool GASImporter::ImportFromFile(const std::string& FilePath,
     // 1. Triangulate: 保证所有网格是三角形
     // 2. LimitBoneWeights: 限制每个顶点最多4根骨骼 (这是GPU蒙皮的标准限制)
     // 3. ConvertToLeftHanded: 自动处理大部分坐标系转换 (Z反转, 面剔除顺序等)
+    // 4. JoinIdenticalVertices: 合并属性相同的面角顶点，否则 FBX 每个面角一个顶点，LOD 简化无从下手
 
     //将骨骼最大影响设置设置为8
     Importer.SetPropertyInteger(AI_CONFIG_PP_LBW_MAX_WEIGHTS, 8);
 
     const unsigned int Flags = aiProcess_Triangulate |
+        aiProcess_JoinIdenticalVertices |
         aiProcess_LimitBoneWeights |
         aiProcess_GenSmoothNormals |
         aiProcess_ConvertToLeftHanded |
@@ -61,32 +139,79 @@ bool GASImporter::ImportFromFile(const std::string& FilePath,
     if (Scene->mNumAnimations > 0)
     {
         ProcessAnimations(Scene, OutSkeleton.get(), OutAnimations);
+
+        const std::string EventPath = fs::path(FilePath).replace_extension(".events").string();
+        if (Options.bImportEventSidecar && GASFileHelper::FileExists(EventPath))
+        {
+            std::vector<std::string> ClipNames;
+            for (unsigned int i = 0; i < Scene->mNumAnimations; ++i) ClipNames.push_back(Scene->mAnimations[i]->mName.C_Str());
+            GASAnimEventBuilder::LoadSidecar(EventPath, ClipNames, OutAnimations);
+
+            // 事件随帧数据计入大小与哈希
+            for (const auto& Anim : OutAnimations)
+            {
+                if (!Anim || Anim->Events.Num() == 0) continue;
+                Anim->BaseHeader.DataSize += (uint32_t)Anim->Events.GetTotalSizeInBytes();
+                Anim->BaseHeader.XXHash64 = CombineHash(Anim->BaseHeader.XXHash64, CalculateXXHash64(Anim->Events.GetData(), Anim->Events.GetTotalSizeInBytes()));
+            }
+        }
     }
 
     //处理mesh
     if (Scene->HasMeshes())
     {
-        for (unsigned int i = 0; i < Scene->mNumMeshes; ++i)
+        if (Options.bMergeMeshes)
         {
-            const aiMesh* Mesh = Scene->mMeshes[i];
-
-            bool bHasSkinning = Mesh->HasBones() && Mesh->mNumBones > 0;
+            // 同一源文件的所有 aiMesh 合并为一个 GASMesh，按材质排序使相同材质连续，合并为同一个 SubMesh
+            std::vector<unsigned int> MeshOrder(Scene->mNumMeshes);
+            for (unsigned int i = 0; i < Scene->mNumMeshes; ++i) MeshOrder[i] = i;
+            std::stable_sort(MeshOrder.begin(), MeshOrder.end(), [Scene](unsigned int A, unsigned int B)
+                {
+                    return Scene->mMeshes[A]->mMaterialIndex < Scene->mMeshes[B]->mMaterialIndex;
+                });
 
+            // 命名与分开导入时一致 (源路径_网格名)，多个网格合并时网格名为 Merged
             auto NewMesh = std::make_shared<GASMesh>();
-            NewMesh->AssetName = FilePath + "_" + Mesh->mName.C_Str();
+            NewMesh->AssetName = FilePath + "_" + (Scene->mNumMeshes == 1 ? std::string(Scene->mMeshes[0]->mName.C_Str()) : std::string("Merged"));
             NewMesh->SkeletonGUID = OutSkeleton->GetGUID();
 
-            // ProcessMesh (负责提取蒙皮权重和顶点)
-            if (ProcessMesh(Scene,Mesh, OutSkeleton.get(), NewMesh.get()))
+            for (unsigned int i : MeshOrder)
             {
-                OutMeshes.push_back(NewMesh);
+                const aiMesh* Mesh = Scene->mMeshes[i];
+                if (ProcessMesh(Scene, Mesh, OutSkeleton.get(), NewMesh.get()) && Mesh->HasBones())
+                {
+                    NewMesh->SetHasSkin(true);
+                }
             }
 
-            if (bHasSkinning)
+            if (NewMesh->Vertices.Num() > 0 && FinalizeMesh(NewMesh.get(), OutSkeleton.get()))
             {
-                NewMesh->SetHasSkin(true);
+                OutMeshes.push_back(NewMesh);
             }
+        }
+        else
+        {
+            for (unsigned int i = 0; i < Scene->mNumMeshes; ++i)
+            {
+                const aiMesh* Mesh = Scene->mMeshes[i];
+
+                bool bHasSkinning = Mesh->HasBones() && Mesh->mNumBones > 0;
 
+                auto NewMesh = std::make_shared<GASMesh>();
+                NewMesh->AssetName = FilePath + "_" + Mesh->mName.C_Str();
+                NewMesh->SkeletonGUID = OutSkeleton->GetGUID();
+
+                // ProcessMesh (负责提取蒙皮权重和顶点)
+                if (ProcessMesh(Scene, Mesh, OutSkeleton.get(), NewMesh.get()) && FinalizeMesh(NewMesh.get(), OutSkeleton.get()))
+                {
+                    OutMeshes.push_back(NewMesh);
+                }
+
+                if (bHasSkinning)
+                {
+                    NewMesh->SetHasSkin(true);
+                }
+            }
         }
     }
     return true;
@@ -121,9 +246,15 @@ bool GASImporter::ProcessSkeleton(const aiScene* Scene, GASSkeleton* TargetSkele
     //  递归构建 
     RecursivelyProcessBoneNode(Scene->mRootNode, -1, TargetSkeleton, FGASMatrix4x4());
 
+    // 按深度分层重排，之后生成的动画轨道与网格骨骼索引都基于新顺序
+    if (Options.bSortBonesByDepth)
+    {
+        GASSkeletonTopology::SortByDepth(TargetSkeleton);
+    }
+
     // 4. 填充 Header
     TargetSkeleton->BaseHeader.Magic = GAS_ASSET_MAGIC;
-    TargetSkeleton->BaseHeader.Version = 1;
+    TargetSkeleton->BaseHeader.Version = GAS_FILE_VERSION;
     TargetSkeleton->BaseHeader.AssetType = EGASAssetType::Skeleton;
 
     uint32_t BoneCount = (uint32_t)TargetSkeleton->Bones.Num();
@@ -160,11 +291,10 @@ bool GASImporter::ProcessAnimations(const aiScene* Scene, const GASSkeleton* Ske
         NewAnim->Tracks.Resize(TotalDataSize);
 
         // 建立映射
-        std::map<std::string, const aiNodeAnim*> NodeAnimMap;
+        std::unordered_map<uint64_t, const aiNodeAnim*> NodeAnimMap;
         for (unsigned int ch = 0; ch < SrcAnim->mNumChannels; ++ch)
         {
-            std::string NodeName = GASDataConverter::NormalizeBoneName(SrcAnim->mChannels[ch]->mNodeName.C_Str());
-            NodeAnimMap[NodeName] = SrcAnim->mChannels[ch];
+            NodeAnimMap[GASHashBoneName(SrcAnim->mChannels[ch]->mNodeName.C_Str())] = SrcAnim->mChannels[ch];
         }
 
         double TimePerFrame = 1.0 / NewAnim->AnimHeader.FrameRate;
@@ -176,11 +306,11 @@ bool GASImporter::ProcessAnimations(const aiScene* Scene, const GASSkeleton* Ske
 
             for (int32_t BoneIdx = 0; BoneIdx < Skeleton->GetNumBones(); ++BoneIdx)
             {
-                const std::string& BoneName = Skeleton->Bones[BoneIdx].Name;
-                std::string NormalizedName = GASDataConverter::NormalizeBoneName(BoneName);
+                const FGASBoneDefinition& Bone = Skeleton->Bones[BoneIdx];
+                const char* BoneName = Bone.Name;
 
                 FGASAnimTrackData TrackData;
-                auto It = NodeAnimMap.find(NormalizedName);
+                auto It = NodeAnimMap.find(Bone.NameHash);
 
                 if (It != NodeAnimMap.end())
                 {
@@ -192,7 +322,7 @@ bool GASImporter::ProcessAnimations(const aiScene* Scene, const GASSkeleton* Ske
                 else
                 {
                     // 无动画数据，可能是静态骨骼，尝试去 aiScene 的 Node 树里找它的默认 Static Transform
-                    aiNode* TargetNode = Scene->mRootNode->FindNode(BoneName.c_str());
+                    aiNode* TargetNode = Scene->mRootNode->FindNode(BoneName);
                     if (TargetNode)
                     {
                         aiVector3D scaling, position;
@@ -215,14 +345,35 @@ bool GASImporter::ProcessAnimations(const aiScene* Scene, const GASSkeleton* Ske
             }
         }
 
+        // 根运动与叠加转换都会改写帧数据，须在计算哈希之前
+        NewAnim->AnimHeader.NumRootMotionKeys = 0;
+        NewAnim->AnimHeader.AdditiveType = EGASAdditiveType::None;
+        if (Options.bExtractRootMotion && !GASRootMotionExtractor::Extract(NewAnim.get(), Skeleton, Options.RootMotionSettings))
+        {
+            GAS_LOG_WARN("Import: Animation %u has no root motion curve", i);
+        }
+
+        // 叠加动画：帧数据改为相对参考姿态的差值
+        if (Options.AdditiveType != EGASAdditiveType::None)
+        {
+            if (!GASAdditiveBuilder::MakeAdditive(NewAnim.get(), Skeleton, Options.AdditiveType))
+            {
+                GAS_LOG_WARN("Import: Animation %u kept as a regular clip", i);
+            }
+        }
+
         // Header 填充
         NewAnim->BaseHeader.Magic = GAS_ASSET_MAGIC;
-        NewAnim->BaseHeader.Version = 1;
+        NewAnim->BaseHeader.Version = GAS_FILE_VERSION;
         NewAnim->BaseHeader.AssetType = EGASAssetType::Animation;
         NewAnim->BaseHeader.HeaderSize = sizeof(FGASAnimationHeader) + sizeof(FGASAssetHeader);
-        NewAnim->BaseHeader.DataSize = (uint32_t)(TotalDataSize * sizeof(FGASAnimTrackData));
+        NewAnim->BaseHeader.DataSize = (uint32_t)(TotalDataSize * sizeof(FGASAnimTrackData) + NewAnim->RootMotion.GetTotalSizeInBytes());
 
-        NewAnim->BaseHeader.XXHash64 = CalculateXXHash64(NewAnim->Tracks.GetData(), NewAnim->BaseHeader.DataSize);
+        NewAnim->BaseHeader.XXHash64 = CalculateXXHash64(NewAnim->Tracks.GetData(), TotalDataSize * sizeof(FGASAnimTrackData));
+        if (NewAnim->HasRootMotion())
+        {
+            NewAnim->BaseHeader.XXHash64 = CombineHash(NewAnim->BaseHeader.XXHash64, CalculateXXHash64(NewAnim->RootMotion.GetData(), NewAnim->RootMotion.GetTotalSizeInBytes()));
+        }
 
         NewAnim->AnimHeader.TargetSkeletonGUID = Skeleton->GetGUID();
         NewAnim->AnimHeader.FrameCount = (uint32_t)FrameCount;
@@ -239,11 +390,25 @@ bool GASImporter::ProcessAnimations(const aiScene* Scene, const GASSkeleton* Ske
 //Mesh逻辑处理
 bool GASImporter::ProcessMesh(const aiScene* Scene, const aiMesh* Mesh, const GASSkeleton* Skeleton, GASMesh* TargetMesh)
 {
-    if (!Mesh->HasPositions() || !Mesh->HasBones() || Mesh->mNumBones == 0)
+    if (!Mesh->HasPositions())
     {
-        GAS_LOG_WARN("Mesh has no positions or bones, skipping skinning data extraction.");
+        GAS_LOG_WARN("Mesh %s has no positions, skipped.", Mesh->mName.C_Str());
         return false;
     }
+
+    // 没有骨骼时整块刚性绑定到一根骨骼
+    const bool bRigid = !Mesh->HasBones() || Mesh->mNumBones == 0;
+    uint32_t RigidBone = 0;
+    FGASMatrix4x4 RigidTransform;
+    if (bRigid)
+    {
+        if (!ComputeRigidBinding(Scene, Mesh, Skeleton, RigidBone, RigidTransform))
+        {
+            GAS_LOG_WARN("Mesh %s has no bones and the skeleton is empty, skipped.", Mesh->mName.C_Str());
+            return false;
+        }
+        GAS_LOG("Mesh %s has no bones, rigidly bound to bone %s", Mesh->mName.C_Str(), Skeleton->Bones[RigidBone].Name);
+    }
     std::string DiffusePath = "";
 
     // 映射骨骼名称到本地索引
@@ -254,7 +419,8 @@ bool GASImporter::ProcessMesh(const aiScene* Scene, const aiMesh* Mesh, const GA
         const aiMaterial* Material = Scene->mMaterials[Mesh->mMaterialIndex];
 
         aiString Path;
-        if (Material->GetTexture(aiTextureType_DIFFUSE, 0, &Path) == aiReturn_SUCCESS)
+        // 合并时只记录第一个带贴图的材质
+        if (TargetMesh->DiffuseTexturePath.empty() && Material->GetTexture(aiTextureType_DIFFUSE, 0, &Path) == aiReturn_SUCCESS)
         {
             TargetMesh->DiffuseTexturePath = Path.C_Str();
             std::replace(TargetMesh->DiffuseTexturePath.begin(), TargetMesh->DiffuseTexturePath.end(), '\\', '/');
@@ -293,19 +459,27 @@ bool GASImporter::ProcessMesh(const aiScene* Scene, const aiMesh* Mesh, const GA
         }
     }
 
-    // 3. 处理顶点数据
-    TargetMesh->Vertices.Resize(Mesh->mNumVertices);
+    // 3. 处理顶点数据 (追加到已有顶点之后)
+    const uint32_t BaseVertex = (uint32_t)TargetMesh->Vertices.Num();
+    TargetMesh->Vertices.Resize(BaseVertex + Mesh->mNumVertices);
+
     FGASAABB BBox;
     BBox.Min = FGASVector3(FLT_MAX, FLT_MAX, FLT_MAX);
     BBox.Max = FGASVector3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    if (BaseVertex > 0) BBox = TargetMesh->MeshHeader.AABB;
 
     for (unsigned int i = 0; i < Mesh->mNumVertices; ++i)
     {
-        FGASSkinVertex& Vertex = TargetMesh->Vertices[i];
+        FGASSkinVertex& Vertex = TargetMesh->Vertices[BaseVertex + i];
         std::vector<BoneInfluence>& Influences = AllInfluences[i];
 
         // 基础几何
         Vertex.Position = GASDataConverter::ToVector3(Mesh->mVertices[i]);
+        if (bRigid)
+        {
+            Vertex.Position = GASMath::TransformPosition(RigidTransform, Vertex.Position);
+            Influences.push_back({ RigidBone, 1.0f });
+        }
 
         // AABB 更新
         BBox.Min.x = std::min(BBox.Min.x, Vertex.Position.x);
@@ -316,17 +490,30 @@ bool GASImporter::ProcessMesh(const aiScene* Scene, const aiMesh* Mesh, const GA
         BBox.Max.z = std::max(BBox.Max.z, Vertex.Position.z);
 
         if (Mesh->HasNormals()) Vertex.Normal = GASDataConverter::ToVector3(Mesh->mNormals[i]);
-        if (Mesh->HasTangentsAndBitangents()) Vertex.Tangent = GASDataConverter::ToVector3(Mesh->mTangents[i]);
+        if (Mesh->HasTangentsAndBitangents())
+        {
+            // 副切线只用于确定切线空间手性 (UV 镜像)，压缩时记为 TangentSign
+            Vertex.Tangent = GASDataConverter::ToVector3(Mesh->mTangents[i]);
+            Vertex.Bitangent = GASDataConverter::ToVector3(Mesh->mBitangents[i]);
+        }
+        if (bRigid)
+        {
+            // 方向只取线性部分 (不考虑非均匀缩放)
+            const FGASVector3 Origin = GASMath::TransformPosition(RigidTransform, FGASVector3(0, 0, 0));
+            Vertex.Normal = GASMath::Normalize(GASMath::Subtract(GASMath::TransformPosition(RigidTransform, Vertex.Normal), Origin));
+            Vertex.Tangent = GASMath::Normalize(GASMath::Subtract(GASMath::TransformPosition(RigidTransform, Vertex.Tangent), Origin));
+            Vertex.Bitangent = GASMath::Normalize(GASMath::Subtract(GASMath::TransformPosition(RigidTransform, Vertex.Bitangent), Origin));
+        }
         if (Mesh->HasTextureCoords(0)) {
             Vertex.UV.x = Mesh->mTextureCoords[0][i].x;
             Vertex.UV.y = Mesh->mTextureCoords[0][i].y;
             Vertex.UV.z = 0;
         }
 
-        // 权重排序与截断
+        // 权重排序与截断 (降序，后续按影响数截断时保留最大的)
+        std::sort(Influences.begin(), Influences.end());
         if (Influences.size() > MAX_BONE_INFLUENCES)
         {
-            std::partial_sort(Influences.begin(), Influences.begin() + MAX_BONE_INFLUENCES, Influences.end());
             Influences.resize(MAX_BONE_INFLUENCES);
         }
 
@@ -344,43 +531,166 @@ bool GASImporter::ProcessMesh(const aiScene* Scene, const aiMesh* Mesh, const GA
             }
         }
     }
+    TargetMesh->MeshHeader.AABB = BBox;
 
-    // 4. 处理索引
+    // 4. 处理索引 (偏移到合并后的顶点区间)
+    const uint32_t IndexStart = (uint32_t)TargetMesh->Indices.Num();
     if (Mesh->HasFaces())
     {
-        TargetMesh->Indices.Resize(Mesh->mNumFaces * 3);
-        uint32_t CurrentIndex = 0;
+        TargetMesh->Indices.Resize(IndexStart + Mesh->mNumFaces * 3);
+        uint32_t CurrentIndex = IndexStart;
         for (unsigned int i = 0; i < Mesh->mNumFaces; ++i)
         {
             const aiFace& Face = Mesh->mFaces[i];
             if (Face.mNumIndices == 3)
             {
-                TargetMesh->Indices[CurrentIndex++] = Face.mIndices[0];
-                TargetMesh->Indices[CurrentIndex++] = Face.mIndices[1];
-                TargetMesh->Indices[CurrentIndex++] = Face.mIndices[2];
+                TargetMesh->Indices[CurrentIndex++] = BaseVertex + Face.mIndices[0];
+                TargetMesh->Indices[CurrentIndex++] = BaseVertex + Face.mIndices[1];
+                TargetMesh->Indices[CurrentIndex++] = BaseVertex + Face.mIndices[2];
             }
         }
+        TargetMesh->Indices.Resize(CurrentIndex);
     }
+    const uint32_t IndexCount = (uint32_t)TargetMesh->Indices.Num() - IndexStart;
 
-    // 5. 填充 Header 和 Hash
+    // 5. 记录 SubMesh，相同材质且连续时与上一个合并
+    const int32_t MaterialIndex = (int32_t)Mesh->mMaterialIndex;
+    if (TargetMesh->SubMeshes.Num() > 0 && TargetMesh->SubMeshes.Last().MaterialIndex == MaterialIndex)
+    {
+        FGASSubMesh& Last = TargetMesh->SubMeshes.Last();
+        Last.IndexCount += IndexCount;
+        Last.VertexCount += Mesh->mNumVertices;
+    }
+    else
+    {
+        FGASSubMesh SubMesh;
+        SubMesh.IndexStart = IndexStart;
+        SubMesh.IndexCount = IndexCount;
+        SubMesh.MaterialIndex = MaterialIndex;
+        SubMesh.VertexStart = BaseVertex;
+        SubMesh.VertexCount = Mesh->mNumVertices;
+        TargetMesh->SubMeshes.Add(SubMesh);
+    }
+
+    return true;
+}
+
+// Mesh 收尾：选择影响数、索引位宽，填充 Header 和 Hash，生成紧凑顶点流
+bool GASImporter::FinalizeMesh(GASMesh* TargetMesh, const GASSkeleton* Skeleton)
+{
+    if (TargetMesh->Vertices.Num() == 0) return false;
+
+    // 候选影响数，以及截断到该数量时单个顶点丢弃的最大权重 (权重已降序)
+    static const int32_t CandidateCounts[] = { 1, 2, 4, MAX_BONE_INFLUENCES };
+    float MaxDroppedWeight[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    int32_t MaxUsedInfluences = 0;
+
+    for (const FGASSkinVertex& Vertex : TargetMesh->Vertices)
+    {
+        int32_t Used = 0;
+        while (Used < MAX_BONE_INFLUENCES && Vertex.BoneWeights.Weights[Used] > 0.0f) ++Used;
+        MaxUsedInfluences = std::max(MaxUsedInfluences, Used);
+
+        for (int32_t c = 0; c < 4; ++c)
+        {
+            float Dropped = 0.0f;
+            for (int32_t j = CandidateCounts[c]; j < Used; ++j) Dropped += Vertex.BoneWeights.Weights[j];
+            MaxDroppedWeight[c] = std::max(MaxDroppedWeight[c], Dropped);
+        }
+    }
+
+    // 选择能覆盖实际最大影响数，或丢弃权重在容差内的最小档位
+    int32_t InfluenceCount = MAX_BONE_INFLUENCES;
+    for (int32_t c = 0; c < 4; ++c)
+    {
+        if (CandidateCounts[c] >= MaxUsedInfluences || MaxDroppedWeight[c] <= Options.InfluenceWeightTolerance)
+        {
+            InfluenceCount = CandidateCounts[c];
+            break;
+        }
+    }
+
+    // 降档后截断并重新归一化
+    if (InfluenceCount < MaxUsedInfluences)
+    {
+        for (FGASSkinVertex& Vertex : TargetMesh->Vertices)
+        {
+            float TotalWeight = 0.0f;
+            for (int32_t j = 0; j < InfluenceCount; ++j) TotalWeight += Vertex.BoneWeights.Weights[j];
+            for (int32_t j = InfluenceCount; j < MAX_BONE_INFLUENCES; ++j)
+            {
+                Vertex.BoneWeights.Weights[j] = 0.0f;
+                Vertex.BoneIndices.Indices[j] = 0;
+            }
+            if (TotalWeight > 0.0f)
+            {
+                for (int32_t j = 0; j < InfluenceCount; ++j) Vertex.BoneWeights.Weights[j] /= TotalWeight;
+            }
+        }
+    }
+    GAS_LOG("Mesh %s: %d bone influences per vertex (max used %d)", TargetMesh->AssetName.c_str(), InfluenceCount, MaxUsedInfluences);
+
+    // LOD 链 (影响数确定之后、索引位宽转换之前)
+    if (Options.bGenerateLODs)
+    {
+        GASMeshSimplifier::GenerateLODs(TargetMesh, Skeleton, Options.LODSettings);
+    }
+
+    // 顶点数允许时使用 16 位索引
+    if (TargetMesh->Vertices.Num() <= 0x10000)
+    {
+        TargetMesh->Indices16.Resize(TargetMesh->Indices.Num());
+        for (int32_t i = 0; i < TargetMesh->Indices.Num(); ++i)
+        {
+            TargetMesh->Indices16[i] = (uint16_t)TargetMesh->Indices[i];
+        }
+        TargetMesh->Indices = GASArray<uint32_t>();
+        TargetMesh->MeshHeader.MeshFlags |= static_cast<uint32_t>(EGASMeshFlags::Index16);
+    }
+
+    // Meshlet
+    if (Options.bBuildMeshlets)
+    {
+        GASMeshletBuilder::BuildMeshlets(TargetMesh, Options.MeshletSettings);
+    }
+
+    // 填充 Header 和 Hash
     TargetMesh->BaseHeader.Magic = GAS_ASSET_MAGIC;
-    TargetMesh->BaseHeader.Version = 1;
+    TargetMesh->BaseHeader.Version = GAS_FILE_VERSION;
     TargetMesh->BaseHeader.AssetType = EGASAssetType::Mesh;
     TargetMesh->BaseHeader.HeaderSize = sizeof(FGASMeshHeader);
 
-    TargetMesh->MeshHeader.NumVertices = (uint32_t)Mesh->mNumVertices;
-    TargetMesh->MeshHeader.NumIndices = (uint32_t)TargetMesh->Indices.Num();
-    TargetMesh->MeshHeader.AABB = BBox;
+    TargetMesh->MeshHeader.NumVertices = (uint32_t)TargetMesh->Vertices.Num();
+    TargetMesh->MeshHeader.NumIndices = (uint32_t)TargetMesh->GetNumIndices();
+    TargetMesh->MeshHeader.InfluenceCount = (uint32_t)InfluenceCount;
+    TargetMesh->MeshHeader.NumSubMeshes = (uint32_t)TargetMesh->SubMeshes.Num();
 
     uint32_t VertSize = TargetMesh->MeshHeader.NumVertices * sizeof(FGASSkinVertex);
-    uint32_t IdxSize = TargetMesh->MeshHeader.NumIndices * sizeof(uint32_t);
-    TargetMesh->BaseHeader.DataSize = VertSize + IdxSize;
+    uint32_t IdxSize = TargetMesh->MeshHeader.NumIndices * TargetMesh->GetIndexStride();
+    uint32_t SubMeshSize = TargetMesh->MeshHeader.NumSubMeshes * sizeof(FGASSubMesh);
+    uint32_t LODSize = (uint32_t)(TargetMesh->LODs.GetTotalSizeInBytes() + TargetMesh->LODSections.GetTotalSizeInBytes() + TargetMesh->BoneLODTable.GetTotalSizeInBytes());
+    uint32_t MeshletSize = (uint32_t)(TargetMesh->Meshlets.GetTotalSizeInBytes() + TargetMesh->MeshletVertices.GetTotalSizeInBytes()
+        + TargetMesh->MeshletTriangles.GetTotalSizeInBytes() + TargetMesh->MeshletBones.GetTotalSizeInBytes());
+    TargetMesh->MeshHeader.NumLODs = (uint32_t)TargetMesh->LODs.Num();
+    TargetMesh->BaseHeader.DataSize = VertSize + IdxSize + SubMeshSize + LODSize + MeshletSize;
 
-   
     uint64_t VertHash = CalculateXXHash64(TargetMesh->Vertices.GetData(), VertSize);
-    uint64_t IdxHash = CalculateXXHash64(TargetMesh->Indices.GetData(), IdxSize);
+    uint64_t IdxHash = CalculateXXHash64(TargetMesh->GetIndexData(), IdxSize);
     TargetMesh->BaseHeader.XXHash64 = VertHash ^ (IdxHash + 0x9e3779b9 + (VertHash << 6) + (VertHash >> 2));
 
+    // 紧凑顶点流
+    if (Options.bBuildCompactVertices && GASVertexCompression::BuildCompactStreams(TargetMesh))
+    {
+        FGASVertexCompressionError Error = GASVertexCompression::Validate(TargetMesh);
+        GAS_LOG("Compact vertices for %s: normal %.6f, tangent %.6f, uv %.6f, weight %.4f, index mismatches %d, tangent sign mismatches %d",
+            TargetMesh->AssetName.c_str(), Error.MaxNormalError, Error.MaxTangentError, Error.MaxUVError, Error.MaxWeightError, Error.IndexMismatches, Error.TangentSignMismatches);
+
+        if (!Options.bKeepFullVertices)
+        {
+            GASVertexCompression::StripFullVertices(TargetMesh);
+        }
+    }
+
     return true;
 }
 
@@ -445,11 +755,12 @@ void GASImporter::RecursivelyProcessBoneNode(
         // 设置 IBM (Inverse Bind Matrix)
         if (InverseBindMatrixMap.count(NormalizedName))
         {
-            NewBone.InverseBindMatrix = InverseBindMatrixMap[NormalizedName];
+            // Assimp 的 OffsetMatrix 转换后为行向量布局，转置为列向量布局的 3x4
+            NewBone.InverseBindMatrix = GASMath::ToMatrix3x4(GASMath::Transpose(InverseBindMatrixMap[NormalizedName]));
         }
         else
         {
-            NewBone.InverseBindMatrix = FGASMatrix4x4(); // Identity
+            NewBone.InverseBindMatrix = FGASMatrix3x4(); // Identity
         }
         GASDataConverter::DecomposeMatrix(TotalTransform, NewBone.LocalBindPose.Translation, NewBone.LocalBindPose.Rotation, NewBone.LocalBindPose.Scale);
         CurrentBoneIndex = (int32_t)TargetSkeleton->Bones.Num();
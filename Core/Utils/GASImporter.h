@@ -7,6 +7,11 @@
 #include <map>
 #include "../Types/GASAsset.h"
 #include "GASFileHelper.h"
+#include "GASMeshSimplifier.h"
+#include "GASMeshletBuilder.h"
+#include "GASAnimBoundsBaker.h"
+#include "GASSkeletonTopology.h"
+#include "GASRootMotionExtractor.h"
 
 struct aiScene;
 struct aiNode;
@@ -14,6 +19,47 @@ struct aiAnimation;
 struct aiNodeAnim;
 struct aiMesh;
 
+// 导入选项
+struct FGASImportOptions
+{
+    // 为 Mesh 生成紧凑顶点流 (八面体法线/half UV/8 位权重)
+    bool bBuildCompactVertices = true;
+
+    // 骨骼按深度分层重排 (父先子后、同层连续)，层偏移写入 SkeletonHeader，动画轨道与网格骨骼索引随之一致
+    bool bSortBonesByDepth = true;
+
+    // 生成紧凑流后是否保留完整 FGASSkinVertex (编辑器/校验需要)
+    bool bKeepFullVertices = true;
+
+    // 每顶点影响数选择 (1/2/4/8)：截断后丢弃的权重不超过该容差即可降档，0 表示只按实际最大影响数选择
+    float InfluenceWeightTolerance = 0.0f;
+
+    // 同一源文件的所有网格合并为一个 GASMesh，按材质生成 SubMesh
+    bool bMergeMeshes = true;
+
+    // 自动生成 LOD 链与骨骼 LOD 表
+    bool bGenerateLODs = true;
+    FGASLODSettings LODSettings;
+
+    // 为每级 LOD 生成 Meshlet
+    bool bBuildMeshlets = true;
+    FGASMeshletSettings MeshletSettings;
+
+    // 提取根骨骼水平位移与转向为根运动曲线 (导航等只需位移的场合无需采样整套姿态)
+    bool bExtractRootMotion = false;
+    FGASRootMotionSettings RootMotionSettings;
+
+    // 读取与源文件同名的 .events 旁路文件，写入各动画的事件轨道 (Assimp 不导出 FBX 标记)
+    bool bImportEventSidecar = true;
+
+    // 动画按参考姿态转换为叠加动画 (None 保持普通动画)；叠加动画不烘焙包围盒
+    EGASAdditiveType AdditiveType = EGASAdditiveType::None;
+
+    // 为每个 (蒙皮 Mesh, 动画) 烘焙逐块动画包围盒 (由 GASAssetManager 在分配 GUID 后执行)
+    bool bBakeAnimatedBounds = true;
+    FGASAnimBoundsSettings AnimBoundsSettings;
+};
+
 // 负责加载外部模型文件 (FBX/GLTF)，并生成 GASSkeleton 和 GASAnimation 对象
 
 class GASImporter
@@ -22,6 +68,9 @@ public:
     GASImporter();
     ~GASImporter();
 
+    void SetImportOptions(const FGASImportOptions& InOptions) { Options = InOptions; }
+    const FGASImportOptions& GetImportOptions() const { return Options; }
+
     //从文件加载并处理资产
     bool ImportFromFile(const std::string& FilePath, std::shared_ptr<GASSkeleton>& OutSkeleton, std::vector<std::shared_ptr<GASAnimation>>& OutAnimations, std::vector<std::shared_ptr<GASMesh>>& OutMeshes);
 
@@ -33,9 +82,12 @@ private:
     // 处理动画：对所有动画轨道进行重采样 (Baking)
     bool ProcessAnimations(const aiScene* Scene, const GASSkeleton* Skeleton, std::vector<std::shared_ptr<GASAnimation>>& TargetAnimList);
 
-    //处理mesh
+    //处理mesh：把 aiMesh 的顶点/索引追加到 TargetMesh，并记录 SubMesh
     bool ProcessMesh(const aiScene* Scene, const aiMesh* Mesh, const GASSkeleton* Skeleton, GASMesh* TargetMesh);
 
+    // Mesh 收尾：影响数分析、LOD 生成、16 位索引转换、Meshlet、Header/Hash、紧凑顶点流
+    bool FinalizeMesh(GASMesh* TargetMesh, const GASSkeleton* Skeleton);
+
     // 辅助工具
 
     bool MarkRequiredNodes(aiNode* Node);
@@ -49,6 +101,8 @@ private:
     void EvaluateChannel(const aiNodeAnim* Channel, double Time, FGASTransform& OutTransform);
 
 private:
+    FGASImportOptions Options;
+
     // 临时缓存：记录哪些节点是真正的骨骼 
     // Assimp 中很多节点只是辅助节点，我们需要通过 Mesh 中的 Bone 列表来标记哪些是有用的
     std::map<std::string, bool> ValidBoneMap;
@@ -0,0 +1,131 @@
+﻿#include "GASMappedFile.h"
+#include "GASLogging.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+GASMappedFile::~GASMappedFile()
+{
+    Close();
+}
+
+#ifdef _WIN32
+
+bool GASMappedFile::Open(const std::string& FilePath)
+{
+    Close();
+
+    HANDLE File = CreateFileA(FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+    if (File == INVALID_HANDLE_VALUE)
+    {
+        GAS_LOG_ERROR("Failed to open file for mapping: %s", FilePath.c_str());
+        return false;
+    }
+
+    LARGE_INTEGER FileSize;
+    if (!GetFileSizeEx(File, &FileSize) || FileSize.QuadPart == 0)
+    {
+        CloseHandle(File);
+        return false;
+    }
+
+    HANDLE Mapping = CreateFileMappingA(File, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!Mapping)
+    {
+        GAS_LOG_ERROR("CreateFileMapping failed: %s", FilePath.c_str());
+        CloseHandle(File);
+        return false;
+    }
+
+    void* View = MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!View)
+    {
+        GAS_LOG_ERROR("MapViewOfFile failed: %s", FilePath.c_str());
+        CloseHandle(Mapping);
+        CloseHandle(File);
+        return false;
+    }
+
+    FileHandle = File;
+    MappingHandle = Mapping;
+    Data = static_cast<const uint8_t*>(View);
+    Size = static_cast<size_t>(FileSize.QuadPart);
+    return true;
+}
+
+void GASMappedFile::Close()
+{
+    if (Data)
+    {
+        UnmapViewOfFile(Data);
+        Data = nullptr;
+    }
+    if (MappingHandle)
+    {
+        CloseHandle(MappingHandle);
+        MappingHandle = nullptr;
+    }
+    if (FileHandle)
+    {
+        CloseHandle(FileHandle);
+        FileHandle = nullptr;
+    }
+    Size = 0;
+}
+
+#else
+
+bool GASMappedFile::Open(const std::string& FilePath)
+{
+    Close();
+
+    int Fd = open(FilePath.c_str(), O_RDONLY);
+    if (Fd < 0)
+    {
+        GAS_LOG_ERROR("Failed to open file for mapping: %s", FilePath.c_str());
+        return false;
+    }
+
+    struct stat FileStat;
+    if (fstat(Fd, &FileStat) != 0 || FileStat.st_size == 0)
+    {
+        close(Fd);
+        return false;
+    }
+
+    void* View = mmap(nullptr, (size_t)FileStat.st_size, PROT_READ, MAP_PRIVATE, Fd, 0);
+    if (View == MAP_FAILED)
+    {
+        GAS_LOG_ERROR("mmap failed: %s", FilePath.c_str());
+        close(Fd);
+        return false;
+    }
+
+    FileDescriptor = Fd;
+    Data = static_cast<const uint8_t*>(View);
+    Size = (size_t)FileStat.st_size;
+    return true;
+}
+
+void GASMappedFile::Close()
+{
+    if (Data)
+    {
+        munmap(const_cast<uint8_t*>(Data), Size);
+        Data = nullptr;
+    }
+    if (FileDescriptor >= 0)
+    {
+        close(FileDescriptor);
+        FileDescriptor = -1;
+    }
+    Size = 0;
+}
+
+#endif
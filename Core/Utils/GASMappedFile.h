@@ -0,0 +1,38 @@
+﻿#pragma once
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// 只读内存映射文件：Windows 使用 CreateFileMapping，其他平台使用 mmap。
+// 映射失败时调用方可退回到普通文件读取。
+class GASMappedFile
+{
+public:
+    GASMappedFile() = default;
+    ~GASMappedFile();
+
+    GASMappedFile(const GASMappedFile&) = delete;
+    GASMappedFile& operator=(const GASMappedFile&) = delete;
+
+    // 映射整个文件 (只读)
+    bool Open(const std::string& FilePath);
+
+    // 解除映射并关闭文件句柄
+    void Close();
+
+    bool IsOpen() const { return Data != nullptr; }
+
+    const uint8_t* GetData() const { return Data; }
+    size_t GetSize() const { return Size; }
+
+private:
+    const uint8_t* Data = nullptr;
+    size_t Size = 0;
+
+#ifdef _WIN32
+    void* FileHandle = nullptr;
+    void* MappingHandle = nullptr;
+#else
+    int FileDescriptor = -1;
+#endif
+};
@@ -53,6 +53,18 @@ namespace GASMath
         return R;
     }
 
+    // 共轭 (单位四元数的逆)
+    inline FGASQuaternion Conjugate(const FGASQuaternion& Q) { return { -Q.X, -Q.Y, -Q.Z, Q.W }; }
+
+    // 用单位四元数旋转向量
+    inline FGASVector3 RotateVector(const FGASQuaternion& Q, const FGASVector3& V)
+    {
+        // V + 2w(q x V) + 2q x (q x V)
+        const FGASVector3 QV(Q.X, Q.Y, Q.Z);
+        const FGASVector3 T = Scale(Cross(QV, V), 2.0f);
+        return Add(Add(V, Scale(T, Q.W)), Cross(QV, T));
+    }
+
     inline FGASQuaternion Normalize(const FGASQuaternion& Q)
     {
         float LenSq = Q.X * Q.X + Q.Y * Q.Y + Q.Z * Q.Z + Q.W * Q.W;
@@ -108,24 +120,29 @@ namespace GASMath
 
     inline FGASMatrix4x4 IdentityMatrix() { return FGASMatrix4x4(); }
 
-    // 矩阵乘法
+    // 矩阵乘法 (与 FGASMatrix4x4::operator* 为同一实现；批量仿射乘法见 GASSimd::AffineMultiplyBatch)
     inline FGASMatrix4x4 Multiply(const FGASMatrix4x4& A, const FGASMatrix4x4& B)
+    {
+        return A * B;
+    }
+
+    // 转置 (导入的逆绑定矩阵为行向量布局，转置后与 ComposeTransform 的列向量布局一致)
+    inline FGASMatrix4x4 Transpose(const FGASMatrix4x4& A)
     {
         FGASMatrix4x4 R;
-        for (int i = 0; i < 4; i++) for (int j = 0; j < 4; j++) R.M[i][j] = 0.f;
-
-        for (int r = 0; r < 4; ++r) {
-            for (int c = 0; c < 4; ++c) {
-                // R[r][c] = Row(A, r) dot Col(B, c)
-                R.M[r][c] = A.M[r][0] * B.M[0][c] +
-                    A.M[r][1] * B.M[1][c] +
-                    A.M[r][2] * B.M[2][c] +
-                    A.M[r][3] * B.M[3][c];
-            }
-        }
+        for (int r = 0; r < 4; ++r) for (int c = 0; c < 4; ++c) R.M[r][c] = A.M[c][r];
         return R;
     }
 
+    // 变换点 (列向量：M * (P, 1))
+    inline FGASVector3 TransformPosition(const FGASMatrix4x4& M, const FGASVector3& P)
+    {
+        return {
+            M.M[0][0] * P.X + M.M[0][1] * P.Y + M.M[0][2] * P.Z + M.M[0][3],
+            M.M[1][0] * P.X + M.M[1][1] * P.Y + M.M[1][2] * P.Z + M.M[1][3],
+            M.M[2][0] * P.X + M.M[2][1] * P.Y + M.M[2][2] * P.Z + M.M[2][3] };
+    }
+
     // 四元数转旋转矩阵
     inline FGASMatrix4x4 ToMatrix(const FGASQuaternion& Q)
     {
@@ -174,6 +191,66 @@ namespace GASMath
     }
 
 
+    // 提取列向量布局矩阵的旋转 (先按列去除缩放)，ToMatrix(FGASQuaternion) 的逆运算
+    inline FGASQuaternion ToQuaternion(const FGASMatrix4x4& InM)
+    {
+        float R[3][3];
+        for (int c = 0; c < 3; ++c)
+        {
+            float Len = std::sqrt(InM.M[0][c] * InM.M[0][c] + InM.M[1][c] * InM.M[1][c] + InM.M[2][c] * InM.M[2][c]);
+            float Inv = Len > SMALL_NUMBER ? 1.0f / Len : 0.0f;
+            for (int r = 0; r < 3; ++r) R[r][c] = InM.M[r][c] * Inv;
+        }
+
+        FGASQuaternion Q;
+        float Trace = R[0][0] + R[1][1] + R[2][2];
+        if (Trace > 0.0f)
+        {
+            float S = 0.5f / std::sqrt(Trace + 1.0f);
+            Q.W = 0.25f / S;
+            Q.X = (R[2][1] - R[1][2]) * S;
+            Q.Y = (R[0][2] - R[2][0]) * S;
+            Q.Z = (R[1][0] - R[0][1]) * S;
+        }
+        else if (R[0][0] > R[1][1] && R[0][0] > R[2][2])
+        {
+            float S = 2.0f * std::sqrt(1.0f + R[0][0] - R[1][1] - R[2][2]);
+            Q.W = (R[2][1] - R[1][2]) / S;
+            Q.X = 0.25f * S;
+            Q.Y = (R[0][1] + R[1][0]) / S;
+            Q.Z = (R[0][2] + R[2][0]) / S;
+        }
+        else if (R[1][1] > R[2][2])
+        {
+            float S = 2.0f * std::sqrt(1.0f + R[1][1] - R[0][0] - R[2][2]);
+            Q.W = (R[0][2] - R[2][0]) / S;
+            Q.X = (R[0][1] + R[1][0]) / S;
+            Q.Y = 0.25f * S;
+            Q.Z = (R[1][2] + R[2][1]) / S;
+        }
+        else
+        {
+            float S = 2.0f * std::sqrt(1.0f + R[2][2] - R[0][0] - R[1][1]);
+            Q.W = (R[1][0] - R[0][1]) / S;
+            Q.X = (R[0][2] + R[2][0]) / S;
+            Q.Y = (R[1][2] + R[2][1]) / S;
+            Q.Z = 0.25f * S;
+        }
+        return Normalize(Q);
+    }
+
+    // 分解列向量布局的仿射矩阵 (不含切变)，ComposeTransform 的逆运算
+    inline FGASTransform ToTransform(const FGASMatrix4x4& InM)
+    {
+        FGASTransform T;
+        T.Translation = FGASVector3(InM.M[0][3], InM.M[1][3], InM.M[2][3]);
+        T.Rotation = ToQuaternion(InM);
+        T.Scale = FGASVector3(Length(FGASVector3(InM.M[0][0], InM.M[1][0], InM.M[2][0])),
+            Length(FGASVector3(InM.M[0][1], InM.M[1][1], InM.M[2][1])),
+            Length(FGASVector3(InM.M[0][2], InM.M[1][2], InM.M[2][2])));
+        return T;
+    }
+
      // 4x4 矩阵求逆 (使用代数余子式法)
 
     inline FGASMatrix4x4 Inverse(const FGASMatrix4x4& InM)
@@ -215,4 +292,90 @@ namespace GASMath
 
         return Out;
     }
+
+    // =========================================================
+    // 3x4 仿射矩阵 (列向量布局，隐含最后一行 (0, 0, 0, 1))
+    // =========================================================
+
+    inline FGASMatrix3x4 ToMatrix3x4(const FGASMatrix4x4& InM)
+    {
+        FGASMatrix3x4 R;
+        for (int r = 0; r < 3; ++r) for (int c = 0; c < 4; ++c) R.M[r][c] = InM.M[r][c];
+        return R;
+    }
+
+    inline FGASMatrix4x4 ToMatrix4x4(const FGASMatrix3x4& InM)
+    {
+        FGASMatrix4x4 R;
+        for (int r = 0; r < 3; ++r) for (int c = 0; c < 4; ++c) R.M[r][c] = InM.M[r][c];
+        return R;
+    }
+
+    // TRS 合成，同 ComposeTransform
+    inline FGASMatrix3x4 ToMatrix3x4(const FGASTransform& T)
+    {
+        const FGASMatrix4x4 Rot = ToMatrix(T.Rotation);
+        const float S[3] = { T.Scale.X, T.Scale.Y, T.Scale.Z };
+        FGASMatrix3x4 R;
+        for (int r = 0; r < 3; ++r) for (int c = 0; c < 3; ++c) R.M[r][c] = Rot.M[r][c] * S[c];
+        R.M[0][3] = T.Translation.X;
+        R.M[1][3] = T.Translation.Y;
+        R.M[2][3] = T.Translation.Z;
+        return R;
+    }
+
+    // 分解 (不含切变)，ToMatrix3x4 的逆运算
+    inline FGASTransform ToTransform(const FGASMatrix3x4& InM)
+    {
+        return ToTransform(ToMatrix4x4(InM));
+    }
+
+    // A * B：只算 3x3 与平移，36 次乘法 (4x4 为 64 次)
+    inline FGASMatrix3x4 Multiply(const FGASMatrix3x4& A, const FGASMatrix3x4& B)
+    {
+        FGASMatrix3x4 R;
+        for (int r = 0; r < 3; ++r)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                R.M[r][c] = A.M[r][0] * B.M[0][c] + A.M[r][1] * B.M[1][c] + A.M[r][2] * B.M[2][c];
+            }
+            R.M[r][3] += A.M[r][3];
+        }
+        return R;
+    }
+
+    inline FGASVector3 TransformPosition(const FGASMatrix3x4& M, const FGASVector3& P)
+    {
+        return {
+            M.M[0][0] * P.X + M.M[0][1] * P.Y + M.M[0][2] * P.Z + M.M[0][3],
+            M.M[1][0] * P.X + M.M[1][1] * P.Y + M.M[1][2] * P.Z + M.M[1][3],
+            M.M[2][0] * P.X + M.M[2][1] * P.Y + M.M[2][2] * P.Z + M.M[2][3] };
+    }
+
+    // 仿射求逆：inv(L) 为 L 各列两两叉积 (伴随矩阵的转置) 除以行列式，平移取 -inv(L) * T
+    // 纯旋转时 inv(L) 即转置；这里保留缩放 (导入的逆绑定矩阵常带单位换算缩放)，奇异时返回单位矩阵 (同 Inverse)
+    inline FGASMatrix3x4 Inverse(const FGASMatrix3x4& InM)
+    {
+        const FGASVector3 C0(InM.M[0][0], InM.M[1][0], InM.M[2][0]);
+        const FGASVector3 C1(InM.M[0][1], InM.M[1][1], InM.M[2][1]);
+        const FGASVector3 C2(InM.M[0][2], InM.M[1][2], InM.M[2][2]);
+        const FGASVector3 Rows[3] = { Cross(C1, C2), Cross(C2, C0), Cross(C0, C1) };
+
+        const float Det = Dot(C0, Rows[0]);
+        if (std::abs(Det) < SMALL_NUMBER) return FGASMatrix3x4();
+
+        const float InvDet = 1.0f / Det;
+        const FGASVector3 T(InM.M[0][3], InM.M[1][3], InM.M[2][3]);
+        FGASMatrix3x4 R;
+        for (int r = 0; r < 3; ++r)
+        {
+            const FGASVector3 Row = Scale(Rows[r], InvDet);
+            R.M[r][0] = Row.X;
+            R.M[r][1] = Row.Y;
+            R.M[r][2] = Row.Z;
+            R.M[r][3] = -Dot(Row, T);
+        }
+        return R;
+    }
 }
\ No newline at end of file
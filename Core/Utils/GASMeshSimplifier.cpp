@@ -0,0 +1,688 @@
+﻿#include "GASMeshSimplifier.h"
+#include <vector>
+#include <map>
+#include <tuple>
+#include <queue>
+#include <unordered_map>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <cstddef>
+#include "GASMath.h"
+#include "GASLogging.h"
+#include "GASHashManager.h"
+
+// 顶点分类：决定该顶点能否作为折叠的起点
+enum class EGASSimplifyVertexKind : uint8_t
+{
+    Manifold,   // 内部顶点，可自由折叠
+    Border,     // 开放边界，只能沿边界折叠
+    Locked      // 接缝 / 材质边界 / 非流形，不可移除
+};
+
+// 对称 4x4 二次型，只存上三角 10 项
+struct FGASQuadric
+{
+    double A00 = 0, A01 = 0, A02 = 0, A03 = 0;
+    double A11 = 0, A12 = 0, A13 = 0;
+    double A22 = 0, A23 = 0;
+    double A33 = 0;
+
+    static FGASQuadric FromPlane(const FGASVector3& Normal, float D, double Weight)
+    {
+        const double A = Normal.X, B = Normal.Y, C = Normal.Z;
+        FGASQuadric Q;
+        Q.A00 = Weight * A * A; Q.A01 = Weight * A * B; Q.A02 = Weight * A * C; Q.A03 = Weight * A * D;
+        Q.A11 = Weight * B * B; Q.A12 = Weight * B * C; Q.A13 = Weight * B * D;
+        Q.A22 = Weight * C * C; Q.A23 = Weight * C * D;
+        Q.A33 = Weight * D * D;
+        return Q;
+    }
+
+    void Add(const FGASQuadric& Other)
+    {
+        A00 += Other.A00; A01 += Other.A01; A02 += Other.A02; A03 += Other.A03;
+        A11 += Other.A11; A12 += Other.A12; A13 += Other.A13;
+        A22 += Other.A22; A23 += Other.A23;
+        A33 += Other.A33;
+    }
+
+    // v^T Q v，v = (P, 1)
+    double Evaluate(const FGASVector3& P) const
+    {
+        const double X = P.X, Y = P.Y, Z = P.Z;
+        return A00 * X * X + 2.0 * A01 * X * Y + 2.0 * A02 * X * Z + 2.0 * A03 * X
+            + A11 * Y * Y + 2.0 * A12 * Y * Z + 2.0 * A13 * Y
+            + A22 * Z * Z + 2.0 * A23 * Z
+            + A33;
+    }
+};
+
+// 候选折叠 From -> To，版本号用于丢弃过期条目
+struct FGASCollapse
+{
+    double Cost;
+    uint32_t From;
+    uint32_t To;
+    uint32_t FromVersion;
+    uint32_t ToVersion;
+
+    bool operator>(const FGASCollapse& Other) const { return Cost > Other.Cost; }
+};
+
+static uint64_t MakeEdgeKey(uint32_t A, uint32_t B)
+{
+    return (A < B) ? (((uint64_t)A << 32) | B) : (((uint64_t)B << 32) | A);
+}
+
+// 两个顶点蒙皮权重的 L1 距离 (按骨骼索引对齐)
+static float SkinWeightDistance(const FGASSkinVertex& A, const FGASSkinVertex& B)
+{
+    float Distance = 0.0f;
+    for (int32_t i = 0; i < MAX_BONE_INFLUENCES; ++i)
+    {
+        const float WeightA = A.BoneWeights.Weights[i];
+        if (WeightA <= 0.0f) continue;
+
+        float WeightB = 0.0f;
+        for (int32_t j = 0; j < MAX_BONE_INFLUENCES; ++j)
+        {
+            if (B.BoneWeights.Weights[j] > 0.0f && B.BoneIndices.Indices[j] == A.BoneIndices.Indices[i])
+            {
+                WeightB = B.BoneWeights.Weights[j];
+                break;
+            }
+        }
+        Distance += std::abs(WeightA - WeightB);
+    }
+
+    for (int32_t j = 0; j < MAX_BONE_INFLUENCES; ++j)
+    {
+        const float WeightB = B.BoneWeights.Weights[j];
+        if (WeightB <= 0.0f) continue;
+
+        bool bFound = false;
+        for (int32_t i = 0; i < MAX_BONE_INFLUENCES && !bFound; ++i)
+        {
+            bFound = A.BoneWeights.Weights[i] > 0.0f && A.BoneIndices.Indices[i] == B.BoneIndices.Indices[j];
+        }
+        if (!bFound) Distance += WeightB;
+    }
+    return Distance;
+}
+
+static FGASVector3 TriangleNormal(const FGASVector3& P0, const FGASVector3& P1, const FGASVector3& P2)
+{
+    return GASMath::Cross(GASMath::Subtract(P1, P0), GASMath::Subtract(P2, P0));
+}
+
+// 焊接比较的字节区间：除 VertexID 外的全部属性 (位置、法线、切线、UV、蒙皮)
+static const size_t WeldOffset = offsetof(FGASSkinVertex, Position);
+static const size_t WeldSize = sizeof(FGASSkinVertex) - WeldOffset;
+
+static bool IsSameVertex(const FGASSkinVertex& A, const FGASSkinVertex& B)
+{
+    return std::memcmp((const uint8_t*)&A + WeldOffset, (const uint8_t*)&B + WeldOffset, WeldSize) == 0;
+}
+
+// 点到三角形的最近距离平方
+static float PointTriangleDistanceSq(const FGASVector3& P, const FGASVector3& A, const FGASVector3& B, const FGASVector3& C)
+{
+    const FGASVector3 AB = GASMath::Subtract(B, A);
+    const FGASVector3 AC = GASMath::Subtract(C, A);
+    const FGASVector3 AP = GASMath::Subtract(P, A);
+
+    const float D1 = GASMath::Dot(AB, AP);
+    const float D2 = GASMath::Dot(AC, AP);
+    if (D1 <= 0.0f && D2 <= 0.0f) return GASMath::LengthSq(AP);
+
+    const FGASVector3 BP = GASMath::Subtract(P, B);
+    const float D3 = GASMath::Dot(AB, BP);
+    const float D4 = GASMath::Dot(AC, BP);
+    if (D3 >= 0.0f && D4 <= D3) return GASMath::LengthSq(BP);
+
+    const FGASVector3 CP = GASMath::Subtract(P, C);
+    const float D5 = GASMath::Dot(AB, CP);
+    const float D6 = GASMath::Dot(AC, CP);
+    if (D6 >= 0.0f && D5 <= D6) return GASMath::LengthSq(CP);
+
+    FGASVector3 Closest;
+    const float VC = D1 * D4 - D3 * D2;
+    const float VB = D5 * D2 - D1 * D6;
+    const float VA = D3 * D6 - D5 * D4;
+    if (VC <= 0.0f && D1 >= 0.0f && D3 <= 0.0f)
+    {
+        Closest = GASMath::Add(A, GASMath::Scale(AB, D1 / (D1 - D3)));
+    }
+    else if (VB <= 0.0f && D2 >= 0.0f && D6 <= 0.0f)
+    {
+        Closest = GASMath::Add(A, GASMath::Scale(AC, D2 / (D2 - D6)));
+    }
+    else if (VA <= 0.0f && (D4 - D3) >= 0.0f && (D5 - D6) >= 0.0f)
+    {
+        Closest = GASMath::Add(B, GASMath::Scale(GASMath::Subtract(C, B), (D4 - D3) / ((D4 - D3) + (D5 - D6))));
+    }
+    else
+    {
+        const float Denom = VA + VB + VC;
+        if (std::abs(Denom) < 1e-20f) return GASMath::LengthSq(AP);
+        Closest = GASMath::Add(A, GASMath::Add(GASMath::Scale(AB, VB / Denom), GASMath::Scale(AC, VC / Denom)));
+    }
+    return GASMath::LengthSq(GASMath::Subtract(P, Closest));
+}
+
+bool GASMeshSimplifier::GenerateLODs(GASMesh* Mesh, const GASSkeleton* Skeleton, const FGASLODSettings& Settings)
+{
+    if (!Mesh) return false;
+
+    Mesh->LODs.Empty();
+    Mesh->LODSections.Empty();
+    Mesh->BoneLODTable.Empty();
+
+    if (Mesh->Is16BitIndices())
+    {
+        GAS_LOG_ERROR("Simplifier: LODs must be generated before the 16-bit index conversion (%s)", Mesh->AssetName.c_str());
+        return false;
+    }
+
+    const uint32_t NumVertices = (uint32_t)Mesh->Vertices.Num();
+    const uint32_t NumTriangles = (uint32_t)Mesh->Indices.Num() / 3;
+    if (Settings.NumLODs <= 0 || NumTriangles < (uint32_t)std::max(1, Settings.MinTriangles) * 2)
+    {
+        return false;
+    }
+
+    // Section：LOD0 的 SubMesh，没有时整个网格作为一个
+    std::vector<FGASSubMesh> Sections(Mesh->SubMeshes.begin(), Mesh->SubMeshes.end());
+    if (Sections.empty())
+    {
+        FGASSubMesh Whole;
+        Whole.IndexCount = NumTriangles * 3;
+        Whole.VertexCount = NumVertices;
+        Sections.push_back(Whole);
+    }
+
+    std::vector<uint32_t> TriSection(NumTriangles, 0);
+    for (uint32_t s = 0; s < (uint32_t)Sections.size(); ++s)
+    {
+        const uint32_t First = Sections[s].IndexStart / 3;
+        const uint32_t Last = std::min(NumTriangles, (Sections[s].IndexStart + Sections[s].IndexCount) / 3);
+        for (uint32_t t = First; t < Last; ++t) TriSection[t] = s;
+    }
+
+    // 1. 焊接：同一 Section 顶点区间内属性完全相同的顶点视为同一个 (未做 JoinIdenticalVertices 时每个面角各有一个顶点)
+    //    简化只在代表顶点上进行，LOD0 的索引保持不变
+    std::vector<uint32_t> VertexSection(NumVertices, 0);
+    for (uint32_t s = 0; s < (uint32_t)Sections.size(); ++s)
+    {
+        const uint32_t End = std::min(Sections[s].VertexStart + Sections[s].VertexCount, NumVertices);
+        for (uint32_t v = std::min(Sections[s].VertexStart, NumVertices); v < End; ++v) VertexSection[v] = s;
+    }
+
+    std::vector<uint32_t> WeldTarget(NumVertices);
+    std::unordered_map<uint64_t, std::vector<uint32_t>> WeldBuckets;
+    uint32_t NumWelded = 0;
+    for (uint32_t v = 0; v < NumVertices; ++v)
+    {
+        WeldTarget[v] = v;
+        const FGASSkinVertex& Vertex = Mesh->Vertices[v];
+        std::vector<uint32_t>& Bucket = WeldBuckets[CalculateXXHash64((const uint8_t*)&Vertex + WeldOffset, WeldSize, VertexSection[v])];
+        for (uint32_t Candidate : Bucket)
+        {
+            if (VertexSection[Candidate] == VertexSection[v] && IsSameVertex(Mesh->Vertices[Candidate], Vertex))
+            {
+                WeldTarget[v] = Candidate;
+                ++NumWelded;
+                break;
+            }
+        }
+        if (WeldTarget[v] == v) Bucket.push_back(v);
+    }
+
+    std::vector<uint32_t> Tris(NumTriangles * 3);
+    for (uint32_t i = 0; i < NumTriangles * 3; ++i) Tris[i] = WeldTarget[Mesh->Indices[i]];
+
+    // 焊接后出现重复角的三角形本就退化，直接剔除
+    std::vector<uint8_t> TriAlive(NumTriangles, 1);
+    uint32_t LiveTriangles = NumTriangles;
+    std::vector<uint8_t> Referenced(NumVertices, 0);
+    for (uint32_t t = 0; t < NumTriangles; ++t)
+    {
+        const uint32_t* Tri = &Tris[t * 3];
+        if (Tri[0] == Tri[1] || Tri[1] == Tri[2] || Tri[0] == Tri[2])
+        {
+            TriAlive[t] = 0;
+            --LiveTriangles;
+            continue;
+        }
+        for (int32_t k = 0; k < 3; ++k) Referenced[Tri[k]] = 1;
+    }
+    if (NumWelded > 0)
+    {
+        GAS_LOG("Simplifier: %s welded %u of %u vertices for simplification", Mesh->AssetName.c_str(), NumWelded, NumVertices);
+    }
+
+    // 2. 顶点分类
+    std::vector<EGASSimplifyVertexKind> Kind(NumVertices, EGASSimplifyVertexKind::Manifold);
+
+    // 焊接后位置仍相同的多个顶点是真正的属性接缝 (UV 接缝、硬边、材质边界、蒙皮不连续)，全部锁定
+    std::map<std::tuple<uint32_t, uint32_t, uint32_t>, uint32_t> PositionMap;
+    for (uint32_t v = 0; v < NumVertices; ++v)
+    {
+        if (!Referenced[v]) continue;
+
+        const FGASVector3& P = Mesh->Vertices[v].Position;
+        std::tuple<uint32_t, uint32_t, uint32_t> Key;
+        std::memcpy(&std::get<0>(Key), &P.X, sizeof(float));
+        std::memcpy(&std::get<1>(Key), &P.Y, sizeof(float));
+        std::memcpy(&std::get<2>(Key), &P.Z, sizeof(float));
+
+        auto Result = PositionMap.emplace(Key, v);
+        if (!Result.second)
+        {
+            Kind[v] = EGASSimplifyVertexKind::Locked;
+            Kind[Result.first->second] = EGASSimplifyVertexKind::Locked;
+        }
+    }
+
+    std::unordered_map<uint64_t, uint32_t> EdgeUse;
+    for (uint32_t t = 0; t < NumTriangles; ++t)
+    {
+        if (!TriAlive[t]) continue;
+        for (int32_t e = 0; e < 3; ++e)
+        {
+            EdgeUse[MakeEdgeKey(Tris[t * 3 + e], Tris[t * 3 + (e + 1) % 3])]++;
+        }
+    }
+    for (const auto& Pair : EdgeUse)
+    {
+        const uint32_t A = (uint32_t)(Pair.first >> 32);
+        const uint32_t B = (uint32_t)(Pair.first & 0xffffffffu);
+        for (uint32_t V : { A, B })
+        {
+            if (Pair.second > 2) Kind[V] = EGASSimplifyVertexKind::Locked;
+            else if (Pair.second == 1 && Kind[V] == EGASSimplifyVertexKind::Manifold) Kind[V] = EGASSimplifyVertexKind::Border;
+        }
+    }
+
+    // 3. 顶点二次型：面平面按面积加权，开放边界额外加垂直约束平面
+    std::vector<FGASQuadric> Quadrics(NumVertices);
+    for (uint32_t t = 0; t < NumTriangles; ++t)
+    {
+        if (!TriAlive[t]) continue;
+        const uint32_t* Tri = &Tris[t * 3];
+        const FGASVector3& P0 = Mesh->Vertices[Tri[0]].Position;
+        FGASVector3 Normal = TriangleNormal(P0, Mesh->Vertices[Tri[1]].Position, Mesh->Vertices[Tri[2]].Position);
+        const float Length = GASMath::Length(Normal);
+        if (Length < GASMath::SMALL_NUMBER) continue;
+
+        Normal = GASMath::Scale(Normal, 1.0f / Length);
+        FGASQuadric Q = FGASQuadric::FromPlane(Normal, -GASMath::Dot(Normal, P0), Length * 0.5f);
+        for (int32_t k = 0; k < 3; ++k) Quadrics[Tri[k]].Add(Q);
+
+        for (int32_t e = 0; e < 3; ++e)
+        {
+            const uint32_t A = Tri[e];
+            const uint32_t B = Tri[(e + 1) % 3];
+            if (EdgeUse[MakeEdgeKey(A, B)] != 1) continue;
+
+            const FGASVector3& PA = Mesh->Vertices[A].Position;
+            FGASVector3 Edge = GASMath::Subtract(Mesh->Vertices[B].Position, PA);
+            FGASVector3 BorderNormal = GASMath::Normalize(GASMath::Cross(Edge, Normal));
+            FGASQuadric BorderQ = FGASQuadric::FromPlane(BorderNormal, -GASMath::Dot(BorderNormal, PA), Settings.BorderWeight * GASMath::LengthSq(Edge));
+            Quadrics[A].Add(BorderQ);
+            Quadrics[B].Add(BorderQ);
+        }
+    }
+
+    // 4. 顶点 -> 三角形邻接
+    std::vector<std::vector<uint32_t>> VertTris(NumVertices);
+    for (uint32_t t = 0; t < NumTriangles; ++t)
+    {
+        if (!TriAlive[t]) continue;
+        for (int32_t k = 0; k < 3; ++k) VertTris[Tris[t * 3 + k]].push_back(t);
+    }
+
+    std::vector<uint32_t> Version(NumVertices, 0);
+    std::vector<uint8_t> Removed(NumVertices, 0);
+    std::vector<uint32_t> CollapsedInto(NumVertices, 0);
+
+    // 折叠代价，非法折叠返回 false
+    auto ComputeCost = [&](uint32_t From, uint32_t To, double& OutCost) -> bool
+    {
+        if (Kind[From] == EGASSimplifyVertexKind::Locked) return false;
+
+        uint32_t Shared = 0;
+        for (uint32_t t : VertTris[From])
+        {
+            if (TriAlive[t] && (Tris[t * 3] == To || Tris[t * 3 + 1] == To || Tris[t * 3 + 2] == To)) ++Shared;
+        }
+        // 内部顶点只沿流形边折叠，边界顶点只沿边界边折叠
+        if (Kind[From] == EGASSimplifyVertexKind::Manifold && Shared != 2) return false;
+        if (Kind[From] == EGASSimplifyVertexKind::Border && Shared != 1) return false;
+
+        const FGASSkinVertex& VFrom = Mesh->Vertices[From];
+        const FGASSkinVertex& VTo = Mesh->Vertices[To];
+
+        FGASQuadric Q = Quadrics[From];
+        Q.Add(Quadrics[To]);
+
+        const double EdgeLengthSq = GASMath::LengthSq(GASMath::Subtract(VTo.Position, VFrom.Position));
+        const double UVDistanceSq = GASMath::LengthSq(GASMath::Subtract(VTo.UV, VFrom.UV));
+        OutCost = std::max(0.0, Q.Evaluate(VTo.Position))
+            + EdgeLengthSq * (Settings.SkinWeightPenalty * SkinWeightDistance(VFrom, VTo) + Settings.UVPenalty * UVDistanceSq);
+        return true;
+    };
+
+    // 折叠后周围三角形不能翻转或退化
+    auto IsCollapseSafe = [&](uint32_t From, uint32_t To) -> bool
+    {
+        const FGASVector3& NewPosition = Mesh->Vertices[To].Position;
+        for (uint32_t t : VertTris[From])
+        {
+            const uint32_t* Tri = &Tris[t * 3];
+            if (!TriAlive[t] || Tri[0] == To || Tri[1] == To || Tri[2] == To) continue;
+
+            FGASVector3 P[3];
+            for (int32_t k = 0; k < 3; ++k) P[k] = Mesh->Vertices[Tri[k]].Position;
+            const FGASVector3 OldNormal = TriangleNormal(P[0], P[1], P[2]);
+            for (int32_t k = 0; k < 3; ++k) if (Tri[k] == From) P[k] = NewPosition;
+            const FGASVector3 NewNormal = TriangleNormal(P[0], P[1], P[2]);
+
+            const float NewLengthSq = GASMath::LengthSq(NewNormal);
+            if (NewLengthSq < GASMath::SMALL_NUMBER) return false;
+            if (GASMath::Dot(OldNormal, NewNormal) < 0.2f * std::sqrt(GASMath::LengthSq(OldNormal) * NewLengthSq)) return false;
+        }
+        return true;
+    };
+
+    std::priority_queue<FGASCollapse, std::vector<FGASCollapse>, std::greater<FGASCollapse>> Heap;
+    auto PushCollapse = [&](uint32_t From, uint32_t To)
+    {
+        double Cost;
+        if (ComputeCost(From, To, Cost))
+        {
+            Heap.push({ Cost, From, To, Version[From], Version[To] });
+        }
+    };
+
+    for (const auto& Pair : EdgeUse)
+    {
+        const uint32_t A = (uint32_t)(Pair.first >> 32);
+        const uint32_t B = (uint32_t)(Pair.first & 0xffffffffu);
+        PushCollapse(A, B);
+        PushCollapse(B, A);
+    }
+
+    // 被移除的原始顶点到简化后表面 (其最终归并顶点周围的存活三角形) 的最大距离，模型空间单位
+    auto MeasureMaxDistance = [&]() -> float
+    {
+        float MaxDistanceSq = 0.0f;
+        for (uint32_t v = 0; v < NumVertices; ++v)
+        {
+            if (!Removed[v]) continue;
+
+            uint32_t Survivor = CollapsedInto[v];
+            while (Removed[Survivor]) Survivor = CollapsedInto[Survivor];
+
+            const FGASVector3& P = Mesh->Vertices[v].Position;
+            float DistanceSq = GASMath::LengthSq(GASMath::Subtract(P, Mesh->Vertices[Survivor].Position));
+            for (uint32_t t : VertTris[Survivor])
+            {
+                if (!TriAlive[t]) continue;
+                const uint32_t* Tri = &Tris[t * 3];
+                DistanceSq = std::min(DistanceSq, PointTriangleDistanceSq(P, Mesh->Vertices[Tri[0]].Position, Mesh->Vertices[Tri[1]].Position, Mesh->Vertices[Tri[2]].Position));
+            }
+            MaxDistanceSq = std::max(MaxDistanceSq, DistanceSq);
+        }
+        return std::sqrt(MaxDistanceSq);
+    };
+
+    // 5. 逐级折叠，每达到一级目标三角形数就记录一次快照
+    struct FGASLODSnapshot
+    {
+        std::vector<uint32_t> TriIds;
+        std::vector<uint32_t> Indices;
+        float MaxDistance = 0.0f;
+    };
+    std::vector<FGASLODSnapshot> Snapshots;
+
+    uint32_t PreviousTriangles = LiveTriangles;
+    std::vector<uint32_t> Neighbors;
+
+    while ((int32_t)Snapshots.size() < Settings.NumLODs)
+    {
+        const uint32_t Target = std::max((uint32_t)std::max(1, Settings.MinTriangles), (uint32_t)(PreviousTriangles * Settings.TriangleRatio));
+
+        while (LiveTriangles > Target && !Heap.empty())
+        {
+            FGASCollapse Collapse = Heap.top();
+            Heap.pop();
+
+            const uint32_t From = Collapse.From;
+            const uint32_t To = Collapse.To;
+            if (Removed[From] || Removed[To] || Collapse.FromVersion != Version[From] || Collapse.ToVersion != Version[To]) continue;
+
+            // 周围拓扑可能已变化，重新评估；代价变大则延后
+            double Cost;
+            if (!ComputeCost(From, To, Cost)) continue;
+            if (Cost > Collapse.Cost * 1.0001 + 1e-12)
+            {
+                Heap.push({ Cost, From, To, Version[From], Version[To] });
+                continue;
+            }
+            if (!IsCollapseSafe(From, To)) continue;
+
+            // 执行折叠 From -> To
+            for (uint32_t t : VertTris[From])
+            {
+                if (!TriAlive[t]) continue;
+
+                uint32_t* Tri = &Tris[t * 3];
+                if (Tri[0] == To || Tri[1] == To || Tri[2] == To)
+                {
+                    TriAlive[t] = 0;
+                    --LiveTriangles;
+                }
+                else
+                {
+                    for (int32_t k = 0; k < 3; ++k) if (Tri[k] == From) Tri[k] = To;
+                    VertTris[To].push_back(t);
+                }
+            }
+            VertTris[From].clear();
+            Quadrics[To].Add(Quadrics[From]);
+            Removed[From] = 1;
+            CollapsedInto[From] = To;
+            ++Version[To];
+
+            // 清理失效三角形并重新评估 To 周围的边
+            std::vector<uint32_t>& ToTris = VertTris[To];
+            ToTris.erase(std::remove_if(ToTris.begin(), ToTris.end(), [&TriAlive](uint32_t t) { return !TriAlive[t]; }), ToTris.end());
+
+            Neighbors.clear();
+            for (uint32_t t : ToTris)
+            {
+                for (int32_t k = 0; k < 3; ++k)
+                {
+                    const uint32_t V = Tris[t * 3 + k];
+                    if (V != To && std::find(Neighbors.begin(), Neighbors.end(), V) == Neighbors.end()) Neighbors.push_back(V);
+                }
+            }
+            for (uint32_t V : Neighbors)
+            {
+                PushCollapse(To, V);
+                PushCollapse(V, To);
+            }
+        }
+
+        // 简化不动了 (接缝 / 边界过多)，不再生成更远的 LOD
+        if (LiveTriangles > PreviousTriangles * 0.9f) break;
+
+        FGASLODSnapshot Snapshot;
+        Snapshot.MaxDistance = MeasureMaxDistance();
+        for (uint32_t t = 0; t < NumTriangles; ++t)
+        {
+            if (!TriAlive[t]) continue;
+            Snapshot.TriIds.push_back(t);
+            Snapshot.Indices.insert(Snapshot.Indices.end(), &Tris[t * 3], &Tris[t * 3] + 3);
+        }
+        Snapshots.push_back(std::move(Snapshot));
+
+        PreviousTriangles = LiveTriangles;
+        if (LiveTriangles <= (uint32_t)std::max(1, Settings.MinTriangles)) break;
+    }
+
+    if (Snapshots.empty())
+    {
+        GAS_LOG_WARN("Simplifier: %s could not be simplified, no LODs generated", Mesh->AssetName.c_str());
+        return false;
+    }
+
+    // 6. 顶点按存活的最远 LOD 排序 (Section 顶点区间内)，使每级只引用区间前缀
+    std::vector<int32_t> Level(NumVertices, -1);
+    for (uint32_t i = 0; i < NumTriangles * 3; ++i) Level[Mesh->Indices[i]] = 0;
+    for (int32_t l = 0; l < (int32_t)Snapshots.size(); ++l)
+    {
+        for (uint32_t V : Snapshots[l].Indices) Level[V] = std::max(Level[V], l + 1);
+    }
+
+    std::vector<uint32_t> Remap(NumVertices);
+    for (uint32_t v = 0; v < NumVertices; ++v) Remap[v] = v;
+
+    std::vector<uint8_t> Covered(NumVertices, 0);
+    bool bPrefixRanges = true;
+    for (const FGASSubMesh& Section : Sections)
+    {
+        const uint32_t Begin = std::min(Section.VertexStart, NumVertices);
+        const uint32_t End = std::min(Section.VertexStart + Section.VertexCount, NumVertices);
+        for (uint32_t v = Begin; v < End; ++v)
+        {
+            if (Covered[v]) bPrefixRanges = false;
+            Covered[v] = 1;
+        }
+    }
+
+    if (bPrefixRanges)
+    {
+        std::vector<uint32_t> Order;
+        for (const FGASSubMesh& Section : Sections)
+        {
+            const uint32_t Begin = std::min(Section.VertexStart, NumVertices);
+            const uint32_t End = std::min(Section.VertexStart + Section.VertexCount, NumVertices);
+            Order.resize(End - Begin);
+            for (uint32_t v = Begin; v < End; ++v) Order[v - Begin] = v;
+            std::stable_sort(Order.begin(), Order.end(), [&Level](uint32_t A, uint32_t B) { return Level[A] > Level[B]; });
+            for (uint32_t i = 0; i < (uint32_t)Order.size(); ++i) Remap[Order[i]] = Begin + i;
+        }
+
+        GASArray<FGASSkinVertex> Reordered;
+        Reordered.Resize(NumVertices);
+        std::vector<int32_t> ReorderedLevel(NumVertices);
+        for (uint32_t v = 0; v < NumVertices; ++v)
+        {
+            Reordered[Remap[v]] = Mesh->Vertices[v];
+            ReorderedLevel[Remap[v]] = Level[v];
+        }
+        Mesh->Vertices = std::move(Reordered);
+        Level.swap(ReorderedLevel);
+
+        for (uint32_t i = 0; i < NumTriangles * 3; ++i) Mesh->Indices[i] = Remap[Mesh->Indices[i]];
+        for (FGASLODSnapshot& Snapshot : Snapshots)
+        {
+            for (uint32_t& V : Snapshot.Indices) V = Remap[V];
+        }
+    }
+    else
+    {
+        GAS_LOG_WARN("Simplifier: overlapping section vertex ranges in %s, LOD vertex ranges are not compacted", Mesh->AssetName.c_str());
+    }
+
+    // 7. 输出 LOD：索引追加到 LOD0 之后，每级按 Section 分组
+    float ScreenSize = Settings.FirstScreenSize;
+    for (int32_t l = 0; l < (int32_t)Snapshots.size(); ++l)
+    {
+        const FGASLODSnapshot& Snapshot = Snapshots[l];
+        const int32_t LODLevel = l + 1;
+
+        FGASMeshLOD LOD;
+        LOD.ScreenSize = ScreenSize;
+        LOD.MaxError = Snapshot.MaxDistance;
+        LOD.FirstSection = (uint32_t)Mesh->LODSections.Num();
+        LOD.NumTriangles = (uint32_t)Snapshot.TriIds.size();
+
+        for (uint32_t s = 0; s < (uint32_t)Sections.size(); ++s)
+        {
+            FGASSubMesh Out;
+            Out.IndexStart = (uint32_t)Mesh->Indices.Num();
+            Out.MaterialIndex = Sections[s].MaterialIndex;
+            Out.VertexStart = Sections[s].VertexStart;
+
+            for (size_t i = 0; i < Snapshot.TriIds.size(); ++i)
+            {
+                if (TriSection[Snapshot.TriIds[i]] != s) continue;
+                for (int32_t k = 0; k < 3; ++k) Mesh->Indices.Add(Snapshot.Indices[i * 3 + k]);
+            }
+            Out.IndexCount = (uint32_t)Mesh->Indices.Num() - Out.IndexStart;
+            if (Out.IndexCount == 0) continue;
+
+            if (bPrefixRanges)
+            {
+                const uint32_t End = std::min(Sections[s].VertexStart + Sections[s].VertexCount, NumVertices);
+                uint32_t Count = 0;
+                while (Out.VertexStart + Count < End && Level[Out.VertexStart + Count] >= LODLevel) ++Count;
+                Out.VertexCount = Count;
+            }
+            else
+            {
+                Out.VertexCount = Sections[s].VertexCount;
+            }
+
+            LOD.NumVertices += Out.VertexCount;
+            Mesh->LODSections.Add(Out);
+        }
+
+        LOD.NumSections = (uint32_t)Mesh->LODSections.Num() - LOD.FirstSection;
+        Mesh->LODs.Add(LOD);
+        ScreenSize *= Settings.ScreenSizeRatio;
+
+        GAS_LOG("Simplifier: %s LOD%d %u triangles, %u vertices, error %.5f, screen size %.3f",
+            Mesh->AssetName.c_str(), LODLevel, LOD.NumTriangles, LOD.NumVertices, LOD.MaxError, LOD.ScreenSize);
+    }
+
+    // 8. 骨骼 LOD 表：某级仍有顶点受其影响的骨骼及其所有祖先都需要计算
+    if (Skeleton && Skeleton->GetNumBones() > 0)
+    {
+        const int32_t NumBones = Skeleton->GetNumBones();
+        const int32_t InfluenceCount = Mesh->GetInfluenceCount();
+        Mesh->BoneLODTable.Resize(NumBones);
+        std::memset(Mesh->BoneLODTable.GetData(), 0, NumBones);
+
+        for (uint32_t v = 0; v < NumVertices; ++v)
+        {
+            if (Level[v] < 0) continue;
+            const uint8_t Required = (uint8_t)std::min(255, Level[v] + 1);
+            const FGASSkinVertex& Vertex = Mesh->Vertices[v];
+            for (int32_t j = 0; j < InfluenceCount; ++j)
+            {
+                const uint32_t Bone = Vertex.BoneIndices.Indices[j];
+                if (Vertex.BoneWeights.Weights[j] > 0.0f && Bone < (uint32_t)NumBones)
+                {
+                    Mesh->BoneLODTable[Bone] = std::max(Mesh->BoneLODTable[Bone], Required);
+                }
+            }
+        }
+
+        for (int32_t b = 0; b < NumBones; ++b)
+        {
+            int32_t Parent = Skeleton->GetParentIndex(b);
+            while (Parent >= 0 && Mesh->BoneLODTable[Parent] < Mesh->BoneLODTable[b])
+            {
+                Mesh->BoneLODTable[Parent] = Mesh->BoneLODTable[b];
+                Parent = Skeleton->GetParentIndex(Parent);
+            }
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,30 @@
+﻿#pragma once
+#include <cstdint>
+#include "../Types/GASAsset.h"
+
+// LOD 生成参数
+struct FGASLODSettings
+{
+    int32_t NumLODs = 3;                // 额外生成的 LOD 数 (不含 LOD0)
+    float TriangleRatio = 0.5f;         // 每级相对上一级保留的三角形比例
+    int32_t MinTriangles = 32;          // 三角形数低于此值时停止生成
+
+    float FirstScreenSize = 0.5f;       // LOD1 的屏幕尺寸阈值
+    float ScreenSizeRatio = 0.5f;       // 之后每级阈值的衰减
+
+    float SkinWeightPenalty = 1.0f;     // 两端蒙皮权重差异的惩罚 (乘以边长平方)
+    float UVPenalty = 1.0f;             // 两端 UV 差异的惩罚 (乘以边长平方)
+    float BorderWeight = 10.0f;         // 开放边界约束平面的权重
+};
+
+// 基于二次误差度量 (QEM) 的半边折叠简化
+// - 只把顶点折叠到已有顶点上，各级 LOD 共享 LOD0 的顶点，顶点集合逐级嵌套
+// - 先焊接属性完全相同的顶点，焊接后位置仍相同的顶点 (UV 接缝 / 硬边 / 材质边界) 不会被移除
+// - 折叠保留目标顶点的蒙皮数据，影响数不会超过 Mesh 的 InfluenceCount
+class GASMeshSimplifier
+{
+public:
+    // 为 Mesh 生成 LOD 链与骨骼 LOD 表，须在 16 位索引转换与紧凑流生成之前调用
+    // 每个 SubMesh 顶点区间内的顶点会按存活的最远 LOD 重新排序，使各级只引用区间前缀
+    static bool GenerateLODs(GASMesh* Mesh, const GASSkeleton* Skeleton, const FGASLODSettings& Settings);
+};
@@ -0,0 +1,265 @@
+﻿#include "GASMeshletBuilder.h"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include "GASMath.h"
+#include "GASLogging.h"
+
+// 正在构建的 Meshlet
+struct FGASMeshletScratch
+{
+    std::vector<uint32_t> Vertices;     // 网格顶点序号
+    std::vector<uint8_t> Triangles;     // 局部索引
+    std::vector<uint16_t> Bones;        // 升序
+};
+
+// 把顶点的骨骼并入有序集合，返回新增数量
+static int32_t MergeVertexBones(const FGASSkinVertex& Vertex, int32_t InfluenceCount, std::vector<uint16_t>& Bones)
+{
+    int32_t Added = 0;
+    for (int32_t j = 0; j < InfluenceCount; ++j)
+    {
+        if (Vertex.BoneWeights.Weights[j] <= 0.0f) continue;
+
+        const uint16_t Bone = (uint16_t)Vertex.BoneIndices.Indices[j];
+        auto It = std::lower_bound(Bones.begin(), Bones.end(), Bone);
+        if (It != Bones.end() && *It == Bone) continue;
+
+        ++Added;
+        Bones.insert(It, Bone);
+    }
+    return Added;
+}
+
+// 计算包围球与法线锥并写入输出数组
+static void FinishMeshlet(GASMesh* Mesh, FGASMeshletScratch& Scratch, uint8_t LODIndex, uint16_t SectionIndex)
+{
+    FGASMeshlet Meshlet;
+    Meshlet.VertexOffset = (uint32_t)Mesh->MeshletVertices.Num();
+    Meshlet.TriangleOffset = (uint32_t)Mesh->MeshletTriangles.Num();
+    Meshlet.BoneOffset = (uint32_t)Mesh->MeshletBones.Num();
+    Meshlet.VertexCount = (uint8_t)Scratch.Vertices.size();
+    Meshlet.TriangleCount = (uint8_t)(Scratch.Triangles.size() / 3);
+    Meshlet.BoneCount = (uint8_t)Scratch.Bones.size();
+    Meshlet.LODIndex = LODIndex;
+    Meshlet.SectionIndex = SectionIndex;
+
+    // 包围球：AABB 中心 + 最远顶点距离
+    FGASVector3 Min = Mesh->Vertices[Scratch.Vertices[0]].Position;
+    FGASVector3 Max = Min;
+    for (uint32_t V : Scratch.Vertices)
+    {
+        const FGASVector3& P = Mesh->Vertices[V].Position;
+        Min = FGASVector3(std::min(Min.X, P.X), std::min(Min.Y, P.Y), std::min(Min.Z, P.Z));
+        Max = FGASVector3(std::max(Max.X, P.X), std::max(Max.Y, P.Y), std::max(Max.Z, P.Z));
+    }
+    Meshlet.Center = GASMath::Scale(GASMath::Add(Min, Max), 0.5f);
+    float RadiusSq = 0.0f;
+    for (uint32_t V : Scratch.Vertices)
+    {
+        RadiusSq = std::max(RadiusSq, GASMath::LengthSq(GASMath::Subtract(Mesh->Vertices[V].Position, Meshlet.Center)));
+    }
+    Meshlet.Radius = std::sqrt(RadiusSq);
+
+    // 法线锥：轴为面法线平均，张角由最偏离轴的面法线决定
+    const int32_t NumTriangles = Meshlet.TriangleCount;
+    std::vector<FGASVector3> Normals(NumTriangles);
+    std::vector<FGASVector3> Corners(NumTriangles);
+    FGASVector3 AxisSum;
+    for (int32_t t = 0; t < NumTriangles; ++t)
+    {
+        const FGASVector3& P0 = Mesh->Vertices[Scratch.Vertices[Scratch.Triangles[t * 3 + 0]]].Position;
+        const FGASVector3& P1 = Mesh->Vertices[Scratch.Vertices[Scratch.Triangles[t * 3 + 1]]].Position;
+        const FGASVector3& P2 = Mesh->Vertices[Scratch.Vertices[Scratch.Triangles[t * 3 + 2]]].Position;
+        Normals[t] = GASMath::Normalize(GASMath::Cross(GASMath::Subtract(P1, P0), GASMath::Subtract(P2, P0)));
+        Corners[t] = P0;
+        AxisSum = GASMath::Add(AxisSum, Normals[t]);
+    }
+
+    Meshlet.ConeAxis = GASMath::Normalize(AxisSum);
+    Meshlet.ConeApex = Meshlet.Center;
+    Meshlet.ConeCutoff = 1.0f;
+
+    float MinDot = 1.0f;
+    for (int32_t t = 0; t < NumTriangles; ++t)
+    {
+        if (GASMath::LengthSq(Normals[t]) > 0.0f) MinDot = std::min(MinDot, GASMath::Dot(Meshlet.ConeAxis, Normals[t]));
+    }
+
+    // 张角超过 90 度时锥无效，保持 Cutoff = 1 (永不剔除)
+    if (GASMath::LengthSq(Meshlet.ConeAxis) > 0.0f && MinDot > 0.0f)
+    {
+        // 锥顶后移到所有三角形平面之后
+        float MaxT = 0.0f;
+        for (int32_t t = 0; t < NumTriangles; ++t)
+        {
+            const float DN = GASMath::Dot(Meshlet.ConeAxis, Normals[t]);
+            if (DN <= 0.0f) continue;
+            const float DC = GASMath::Dot(GASMath::Subtract(Meshlet.Center, Corners[t]), Normals[t]);
+            MaxT = std::max(MaxT, DC / DN);
+        }
+        Meshlet.ConeApex = GASMath::Subtract(Meshlet.Center, GASMath::Scale(Meshlet.ConeAxis, MaxT));
+        Meshlet.ConeCutoff = std::sqrt(std::max(0.0f, 1.0f - MinDot * MinDot));
+    }
+
+    for (uint32_t V : Scratch.Vertices) Mesh->MeshletVertices.Add(V);
+    for (uint8_t Index : Scratch.Triangles) Mesh->MeshletTriangles.Add(Index);
+    while (Mesh->MeshletTriangles.Num() % 4 != 0) Mesh->MeshletTriangles.Add(0);
+    for (size_t i = 0; i < Meshlet.BoneCount; ++i) Mesh->MeshletBones.Add(Scratch.Bones[i]);
+    Mesh->Meshlets.Add(Meshlet);
+
+    Scratch.Vertices.clear();
+    Scratch.Triangles.clear();
+    Scratch.Bones.clear();
+}
+
+bool GASMeshletBuilder::BuildMeshlets(GASMesh* Mesh, const FGASMeshletSettings& Settings)
+{
+    if (!Mesh || Mesh->Vertices.Num() == 0 || Mesh->GetNumIndices() < 3) return false;
+
+    const int32_t InfluenceCount = Mesh->GetInfluenceCount();
+    const int32_t MaxVertices = std::max(3, std::min(Settings.MaxVertices, 255));
+    const int32_t MaxTriangles = std::max(1, std::min(Settings.MaxTriangles, 255));
+    // BoneCount 为 uint8：上限夹到 255，多出的骨骼拆到新簇而不是被截断
+    if (Settings.MaxBones > 255)
+    {
+        GAS_LOG_WARN("Meshlets: MaxBones %d exceeds the 255 bone limit per meshlet, clamped", Settings.MaxBones);
+    }
+    const int32_t MaxBones = std::max(std::min(Settings.MaxBones, 255), 3 * InfluenceCount);
+
+    Mesh->Meshlets.Empty();
+    Mesh->MeshletVertices.Empty();
+    Mesh->MeshletTriangles.Empty();
+    Mesh->MeshletBones.Empty();
+
+    const uint32_t NumVertices = (uint32_t)Mesh->Vertices.Num();
+
+    // 顶点在当前 Meshlet 中的局部索引，用 Stamp 区分不同 Meshlet
+    std::vector<uint32_t> LocalIndex(NumVertices, 0);
+    std::vector<uint32_t> LocalStamp(NumVertices, 0);
+    uint32_t Stamp = 1;
+
+    FGASMeshletScratch Scratch;
+    std::vector<std::vector<uint32_t>> VertTris(NumVertices);
+    std::vector<uint32_t> Candidates;
+    std::vector<uint16_t> TrialBones;
+
+    for (int32_t LODIndex = 0; LODIndex < Mesh->GetNumLODs(); ++LODIndex)
+    {
+        int32_t NumSections = 0;
+        const FGASSubMesh* Sections = Mesh->GetLODSections(LODIndex, NumSections);
+
+        for (int32_t SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+        {
+            const FGASSubMesh& Section = Sections[SectionIndex];
+            const uint32_t NumTriangles = Section.IndexCount / 3;
+            if (NumTriangles == 0) continue;
+
+            auto TriVertex = [Mesh, &Section](uint32_t Tri, int32_t k) { return Mesh->GetIndex((int32_t)(Section.IndexStart + Tri * 3 + k)); };
+
+            for (uint32_t t = 0; t < NumTriangles; ++t)
+            {
+                for (int32_t k = 0; k < 3; ++k) VertTris[TriVertex(t, k)].push_back(t);
+            }
+
+            std::vector<uint8_t> Emitted(NumTriangles, 0);
+            uint32_t NextSeed = 0;
+            uint32_t NumEmitted = 0;
+
+            while (NumEmitted < NumTriangles)
+            {
+                // 1. 从当前 Meshlet 顶点的相邻三角形中挑选新增顶点最少的
+                uint32_t Best = UINT32_MAX;
+                int32_t BestNewVertices = 4;
+                for (uint32_t Tri : Candidates)
+                {
+                    if (Emitted[Tri]) continue;
+
+                    int32_t NewVertices = 0;
+                    for (int32_t k = 0; k < 3; ++k) NewVertices += (LocalStamp[TriVertex(Tri, k)] != Stamp) ? 1 : 0;
+                    if (NewVertices < BestNewVertices)
+                    {
+                        Best = Tri;
+                        BestNewVertices = NewVertices;
+                        if (NewVertices == 0) break;
+                    }
+                }
+
+                // 2. 没有相邻候选时，从下一个未使用的三角形开始
+                if (Best == UINT32_MAX)
+                {
+                    while (Emitted[NextSeed]) ++NextSeed;
+                    Best = NextSeed;
+                    BestNewVertices = 0;
+                    for (int32_t k = 0; k < 3; ++k) BestNewVertices += (LocalStamp[TriVertex(Best, k)] != Stamp) ? 1 : 0;
+                }
+
+                // 3. 超出顶点/三角形/骨骼上限则先结束当前 Meshlet
+                TrialBones = Scratch.Bones;
+                int32_t NewBones = 0;
+                for (int32_t k = 0; k < 3; ++k) NewBones += MergeVertexBones(Mesh->Vertices[TriVertex(Best, k)], InfluenceCount, TrialBones);
+
+                const bool bFull = (int32_t)Scratch.Vertices.size() + BestNewVertices > MaxVertices
+                    || (int32_t)Scratch.Triangles.size() / 3 + 1 > MaxTriangles
+                    || (int32_t)Scratch.Bones.size() + NewBones > MaxBones;
+                if (bFull && !Scratch.Triangles.empty())
+                {
+                    FinishMeshlet(Mesh, Scratch, (uint8_t)LODIndex, (uint16_t)SectionIndex);
+                    ++Stamp;
+                    Candidates.clear();
+                    continue;
+                }
+
+                // 4. 加入三角形
+                for (int32_t k = 0; k < 3; ++k)
+                {
+                    const uint32_t V = TriVertex(Best, k);
+                    if (LocalStamp[V] != Stamp)
+                    {
+                        LocalStamp[V] = Stamp;
+                        LocalIndex[V] = (uint32_t)Scratch.Vertices.size();
+                        Scratch.Vertices.push_back(V);
+                        MergeVertexBones(Mesh->Vertices[V], InfluenceCount, Scratch.Bones);
+                        Candidates.insert(Candidates.end(), VertTris[V].begin(), VertTris[V].end());
+                    }
+                    Scratch.Triangles.push_back((uint8_t)LocalIndex[V]);
+                }
+                Emitted[Best] = 1;
+                ++NumEmitted;
+            }
+
+            if (!Scratch.Triangles.empty())
+            {
+                FinishMeshlet(Mesh, Scratch, (uint8_t)LODIndex, (uint16_t)SectionIndex);
+                ++Stamp;
+            }
+            Candidates.clear();
+
+            for (uint32_t t = 0; t < NumTriangles; ++t)
+            {
+                for (int32_t k = 0; k < 3; ++k) VertTris[TriVertex(t, k)].clear();
+            }
+        }
+    }
+
+    Mesh->MeshHeader.MeshFlags |= static_cast<uint32_t>(EGASMeshFlags::Meshlets);
+
+    GAS_LOG("Meshlets: %s -> %d meshlets (%d vertices, %d bones referenced)",
+        Mesh->AssetName.c_str(), Mesh->Meshlets.Num(), Mesh->MeshletVertices.Num(), Mesh->MeshletBones.Num());
+    return true;
+}
+
+bool GASMeshletBuilder::IsBackfacing(const FGASMeshlet& Meshlet, const FGASVector3& CameraPosition)
+{
+    FGASVector3 ViewDir = GASMath::Normalize(GASMath::Subtract(Meshlet.ConeApex, CameraPosition));
+    return GASMath::Dot(ViewDir, Meshlet.ConeAxis) > Meshlet.ConeCutoff;
+}
+
+void GASMeshletBuilder::GetTriangle(const GASMesh* Mesh, const FGASMeshlet& Meshlet, int32_t TriangleIndex, uint32_t OutIndices[3])
+{
+    const uint8_t* Local = Mesh->MeshletTriangles.GetData() + Meshlet.TriangleOffset + TriangleIndex * 3;
+    for (int32_t k = 0; k < 3; ++k)
+    {
+        OutIndices[k] = Mesh->MeshletVertices[Meshlet.VertexOffset + Local[k]];
+    }
+}
@@ -0,0 +1,25 @@
+﻿#pragma once
+#include <cstdint>
+#include "../Types/GASAsset.h"
+
+// Meshlet 划分参数
+struct FGASMeshletSettings
+{
+    int32_t MaxVertices = 64;       // 局部索引为 uint8，上限 255
+    int32_t MaxTriangles = 124;     // 上限 255
+    int32_t MaxBones = 64;          // 每簇骨骼调色板上限，上限 255 (至少容纳一个三角形：3 * InfluenceCount)
+};
+
+// 把 GASMesh 各级 LOD 的每个 Section 划分为 Meshlet，并计算包围球、法线锥与骨骼集合
+class GASMeshletBuilder
+{
+public:
+    // 生成 Meshlet 并设置 EGASMeshFlags::Meshlets，需要完整顶点 (在 StripFullVertices 之前调用)
+    static bool BuildMeshlets(GASMesh* Mesh, const FGASMeshletSettings& Settings);
+
+    // CPU 剔除测试：整簇背向相机
+    static bool IsBackfacing(const FGASMeshlet& Meshlet, const FGASVector3& CameraPosition);
+
+    // 读取 Meshlet 第 TriangleIndex 个三角形的网格顶点序号
+    static void GetTriangle(const GASMesh* Mesh, const FGASMeshlet& Meshlet, int32_t TriangleIndex, uint32_t OutIndices[3]);
+};
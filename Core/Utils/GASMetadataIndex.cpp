@@ -0,0 +1,222 @@
+﻿#include "GASMetadataIndex.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include "GASFileHelper.h"
+#include "GASLogging.h"
+
+// 辅助：按中序遍历把有序数组写入 Eytzinger (BFS 完全二叉树) 布局，K 从 1 开始
+static void FillEytzinger(const std::vector<uint32_t>& SortedOrder, std::vector<uint32_t>& OutOrder, size_t& Cursor, size_t K)
+{
+    if (K > SortedOrder.size()) return;
+
+    FillEytzinger(SortedOrder, OutOrder, Cursor, 2 * K);
+    OutOrder[K - 1] = SortedOrder[Cursor++];
+    FillEytzinger(SortedOrder, OutOrder, Cursor, 2 * K + 1);
+}
+
+// 辅助：向字符串表追加 '\0' 结尾字符串，返回偏移
+static uint32_t AppendString(std::vector<char>& Table, const std::string& Str)
+{
+    uint32_t Offset = (uint32_t)Table.size();
+    Table.insert(Table.end(), Str.begin(), Str.end());
+    Table.push_back('\0');
+    return Offset;
+}
+
+static uint32_t AlignUp(uint32_t Value, uint32_t Alignment)
+{
+    return (Value + Alignment - 1) & ~(Alignment - 1);
+}
+
+bool GASMetadataIndex::BuildFromStorage(const GASMetadataStorage& Storage, const std::string& OutFilePath)
+{
+    return BuildFromList(Storage.QueryAllAssets(), OutFilePath);
+}
+
+bool GASMetadataIndex::BuildFromList(const std::vector<FGASAssetMetadata>& MetadataList, const std::string& OutFilePath)
+{
+    const uint32_t Count = (uint32_t)MetadataList.size();
+
+    // 按 GUID 排序后转换为 Eytzinger 顺序
+    std::vector<uint32_t> SortedOrder(Count);
+    for (uint32_t i = 0; i < Count; ++i) SortedOrder[i] = i;
+    std::sort(SortedOrder.begin(), SortedOrder.end(),
+        [&MetadataList](uint32_t A, uint32_t B) { return MetadataList[A].GUID < MetadataList[B].GUID; });
+
+    for (uint32_t i = 1; i < Count; ++i)
+    {
+        if (MetadataList[SortedOrder[i]].GUID == MetadataList[SortedOrder[i - 1]].GUID)
+        {
+            GAS_LOG_ERROR("MetadataIndex: duplicate GUID %llu", MetadataList[SortedOrder[i]].GUID);
+            return false;
+        }
+    }
+
+    std::vector<uint32_t> LayoutOrder(Count);
+    size_t Cursor = 0;
+    FillEytzinger(SortedOrder, LayoutOrder, Cursor, 1);
+
+    std::vector<uint64_t> Keys(Count);
+    std::vector<FGASMetadataIndexEntry> Entries(Count);
+    std::vector<char> StringTable;
+
+    for (uint32_t i = 0; i < Count; ++i)
+    {
+        const FGASAssetMetadata& Meta = MetadataList[LayoutOrder[i]];
+        FGASMetadataIndexEntry& Entry = Entries[i];
+        std::memset(&Entry, 0, sizeof(Entry));
+
+        Keys[i] = Meta.GUID;
+        Entry.FileHash = Meta.FileHash;
+        Entry.PathOffset = AppendString(StringTable, Meta.BinaryFilePath);
+        Entry.NameOffset = AppendString(StringTable, Meta.Name);
+        Entry.Type = Meta.Type;
+        Entry.FrameCount = Meta.FrameCount;
+        Entry.Duration = Meta.Duration;
+        Entry.BoneCount = Meta.BoneCount;
+        Entry.VerticeCount = Meta.VerticeCount;
+        Entry.MeshCount = Meta.MeshCount;
+    }
+
+    FGASMetadataIndexHeader OutHeader;
+    std::memset(&OutHeader, 0, sizeof(OutHeader));
+    OutHeader.Magic = GAS_METADATA_INDEX_MAGIC;
+    OutHeader.Version = GAS_METADATA_INDEX_VERSION;
+    OutHeader.EntryCount = Count;
+    OutHeader.StringTableSize = (uint32_t)StringTable.size();
+    OutHeader.KeysOffset = AlignUp(sizeof(FGASMetadataIndexHeader), 64);
+    OutHeader.EntriesOffset = AlignUp(OutHeader.KeysOffset + Count * (uint32_t)sizeof(uint64_t), 8);
+    OutHeader.StringTableOffset = OutHeader.EntriesOffset + Count * (uint32_t)sizeof(FGASMetadataIndexEntry);
+
+    std::vector<uint8_t> Buffer(OutHeader.StringTableOffset + StringTable.size(), 0);
+    std::memcpy(Buffer.data(), &OutHeader, sizeof(OutHeader));
+    if (Count > 0)
+    {
+        std::memcpy(Buffer.data() + OutHeader.KeysOffset, Keys.data(), Keys.size() * sizeof(uint64_t));
+        std::memcpy(Buffer.data() + OutHeader.EntriesOffset, Entries.data(), Entries.size() * sizeof(FGASMetadataIndexEntry));
+        std::memcpy(Buffer.data() + OutHeader.StringTableOffset, StringTable.data(), StringTable.size());
+    }
+
+    // 直接覆盖会截断仍被映射的旧文件 (POSIX 下读取方 SIGBUS)，改为写临时文件后整体替换
+    const std::string TempFilePath = OutFilePath + ".tmp";
+    if (!GASFileHelper::SaveBufferToFile(TempFilePath, Buffer.data(), Buffer.size()))
+    {
+        GAS_LOG_ERROR("MetadataIndex: failed to write %s", TempFilePath.c_str());
+        std::error_code RemoveError;
+        std::filesystem::remove(TempFilePath, RemoveError);
+        return false;
+    }
+
+    std::error_code RenameError;
+    std::filesystem::rename(TempFilePath, OutFilePath, RenameError);
+    if (RenameError)
+    {
+        GAS_LOG_ERROR("MetadataIndex: failed to replace %s (%s)", OutFilePath.c_str(), RenameError.message().c_str());
+        std::error_code RemoveError;
+        std::filesystem::remove(TempFilePath, RemoveError);
+        return false;
+    }
+
+    GAS_LOG("MetadataIndex: wrote %u entries to %s", Count, OutFilePath.c_str());
+    return true;
+}
+
+bool GASMetadataIndex::Load(const std::string& FilePath)
+{
+    Unload();
+
+    if (!MappedFile.Open(FilePath))
+    {
+        return false;
+    }
+
+    const uint8_t* Base = MappedFile.GetData();
+    const size_t FileSize = MappedFile.GetSize();
+    const FGASMetadataIndexHeader* FileHeader = reinterpret_cast<const FGASMetadataIndexHeader*>(Base);
+
+    bool bValid = FileSize >= sizeof(FGASMetadataIndexHeader)
+        && FileHeader->Magic == GAS_METADATA_INDEX_MAGIC
+        && FileHeader->Version == GAS_METADATA_INDEX_VERSION
+        && (uint64_t)FileHeader->KeysOffset + (uint64_t)FileHeader->EntryCount * sizeof(uint64_t) <= FileSize
+        && (uint64_t)FileHeader->EntriesOffset + (uint64_t)FileHeader->EntryCount * sizeof(FGASMetadataIndexEntry) <= FileSize
+        && (uint64_t)FileHeader->StringTableOffset + FileHeader->StringTableSize <= FileSize;
+
+    // 字符串表须以 '\0' 结尾，且每条记录的偏移都落在表内，之后 GetPath/GetName 无需再检查
+    if (bValid && FileHeader->EntryCount > 0)
+    {
+        const char* FileStrings = reinterpret_cast<const char*>(Base + FileHeader->StringTableOffset);
+        const FGASMetadataIndexEntry* FileEntries = reinterpret_cast<const FGASMetadataIndexEntry*>(Base + FileHeader->EntriesOffset);
+        bValid = FileHeader->StringTableSize > 0 && FileStrings[FileHeader->StringTableSize - 1] == '\0';
+        for (uint32_t i = 0; bValid && i < FileHeader->EntryCount; ++i)
+        {
+            bValid = FileEntries[i].PathOffset < FileHeader->StringTableSize && FileEntries[i].NameOffset < FileHeader->StringTableSize;
+        }
+    }
+
+    if (!bValid)
+    {
+        GAS_LOG_ERROR("MetadataIndex: invalid or outdated index file %s", FilePath.c_str());
+        MappedFile.Close();
+        return false;
+    }
+
+    Header = FileHeader;
+    Keys = reinterpret_cast<const uint64_t*>(Base + Header->KeysOffset);
+    Entries = reinterpret_cast<const FGASMetadataIndexEntry*>(Base + Header->EntriesOffset);
+    StringTable = reinterpret_cast<const char*>(Base + Header->StringTableOffset);
+    LoadedPath = FilePath;
+
+    GAS_LOG("MetadataIndex: mapped %u entries from %s", Header->EntryCount, FilePath.c_str());
+    return true;
+}
+
+void GASMetadataIndex::Unload()
+{
+    Header = nullptr;
+    Keys = nullptr;
+    Entries = nullptr;
+    StringTable = nullptr;
+    LoadedPath.clear();
+    MappedFile.Close();
+}
+
+const FGASMetadataIndexEntry* GASMetadataIndex::Find(uint64_t GUID) const
+{
+    if (!Header) return nullptr;
+
+    // Eytzinger 搜索：K 从 1 开始，记录最后一个 >= GUID 的节点
+    const size_t Count = Header->EntryCount;
+    size_t K = 1;
+    size_t Candidate = 0;
+    while (K <= Count)
+    {
+        const bool bGoRight = Keys[K - 1] < GUID;
+        Candidate = bGoRight ? Candidate : K;
+        K = 2 * K + (bGoRight ? 1 : 0);
+    }
+
+    if (Candidate != 0 && Keys[Candidate - 1] == GUID)
+    {
+        return &Entries[Candidate - 1];
+    }
+    return nullptr;
+}
+
+bool GASMetadataIndex::QueryAssetByGUID(uint64_t GUID, FGASAssetMetadata& OutMetadata) const
+{
+    const FGASMetadataIndexEntry* Entry = Find(GUID);
+    if (!Entry) return false;
+
+    OutMetadata.GUID = GUID;
+    OutMetadata.Name = GetName(*Entry);
+    OutMetadata.Type = Entry->Type;
+    OutMetadata.BinaryFilePath = GetPath(*Entry);
+    OutMetadata.FileHash = Entry->FileHash;
+    OutMetadata.FrameCount = Entry->FrameCount;
+    OutMetadata.Duration = Entry->Duration;
+    OutMetadata.BoneCount = Entry->BoneCount;
+    OutMetadata.VerticeCount = Entry->VerticeCount;
+    OutMetadata.MeshCount = Entry->MeshCount;
+    return true;
+}
@@ -0,0 +1,83 @@
+﻿#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "GASMappedFile.h"
+#include "GASMetadataStorage.h"
+
+// 索引文件标识 "GASI"
+const uint32_t GAS_METADATA_INDEX_MAGIC = 0x49534147;
+static const uint32_t GAS_METADATA_INDEX_VERSION = 1;
+
+// 索引文件头 32 字节
+struct FGASMetadataIndexHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t EntryCount;
+    uint32_t StringTableSize;
+
+    // 以下偏移均相对文件起始位置
+    uint32_t KeysOffset;        // uint64_t GUID[EntryCount]，Eytzinger 顺序
+    uint32_t EntriesOffset;     // FGASMetadataIndexEntry[EntryCount]，与 Keys 同序
+    uint32_t StringTableOffset; // '\0' 结尾字符串 (路径与名称)
+    uint32_t Reserved;
+};
+
+// 单条资产记录 40 字节，不含指针，可直接映射使用
+struct FGASMetadataIndexEntry
+{
+    uint64_t FileHash;
+    uint32_t PathOffset;    // BinaryFilePath 在字符串表中的偏移
+    uint32_t NameOffset;    // Name 在字符串表中的偏移
+    EGASAssetType Type;
+    int32_t FrameCount;
+    float Duration;
+    int32_t BoneCount;
+    int32_t VerticeCount;
+    int32_t MeshCount;
+};
+// 索引文件布局：[Header][Keys][Entries][StringTable]
+
+// 运行时元数据快速索引：由 GASMetadataStorage 离线生成的紧凑 GUID 查找表，
+// 运行时直接内存映射，不需要打开 SQLite。
+class GASMetadataIndex
+{
+public:
+    // 从数据库生成索引文件
+    static bool BuildFromStorage(const GASMetadataStorage& Storage, const std::string& OutFilePath);
+
+    // 从元数据列表生成索引文件 (先写临时文件再替换，失败时原文件不受影响；Windows 下目标不能处于映射中)
+    static bool BuildFromList(const std::vector<FGASAssetMetadata>& MetadataList, const std::string& OutFilePath);
+
+    // 映射索引文件
+    bool Load(const std::string& FilePath);
+
+    void Unload();
+
+    bool IsLoaded() const { return Header != nullptr; }
+
+    uint32_t GetNumEntries() const { return Header ? Header->EntryCount : 0; }
+
+    // 当前映射的索引文件路径 (未加载时为空)
+    const std::string& GetFilePath() const { return LoadedPath; }
+
+    // 按 GUID 查找 (Eytzinger 布局，无分配)，找不到返回 nullptr
+    const FGASMetadataIndexEntry* Find(uint64_t GUID) const;
+
+    // 获取条目字符串 (指向映射内存，生命周期同索引；偏移与结尾 '\0' 已在 Load 时校验)
+    const char* GetPath(const FGASMetadataIndexEntry& Entry) const { return StringTable + Entry.PathOffset; }
+    const char* GetName(const FGASMetadataIndexEntry& Entry) const { return StringTable + Entry.NameOffset; }
+
+    // 转换为通用元数据结构 (会分配字符串)
+    bool QueryAssetByGUID(uint64_t GUID, FGASAssetMetadata& OutMetadata) const;
+
+private:
+    GASMappedFile MappedFile;
+    std::string LoadedPath;
+
+    const FGASMetadataIndexHeader* Header = nullptr;
+    const uint64_t* Keys = nullptr;
+    const FGASMetadataIndexEntry* Entries = nullptr;
+    const char* StringTable = nullptr;
+};
@@ -19,10 +19,69 @@ const char* SQL_CREATE_TABLE = R"(
     );
 )";
 
+const char* SQL_INSERT_ASSET = "INSERT OR REPLACE INTO Assets (GUID, Name, Type, BinaryFilePath, FileHash, FrameCount, Duration, BoneCount, VerticeCount, MeshCount) "
+    "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
+
+// 查询语句统一列顺序，由 ReadMetadataRow 解析
+#define GAS_ASSET_COLUMNS "GUID, Name, Type, BinaryFilePath, FileHash, FrameCount, Duration, BoneCount, VerticeCount, MeshCount"
+const char* SQL_QUERY_BY_GUID = "SELECT " GAS_ASSET_COLUMNS " FROM Assets WHERE GUID = ?;";
+const char* SQL_QUERY_BY_HASH = "SELECT " GAS_ASSET_COLUMNS " FROM Assets WHERE FileHash = ?;";
+const char* SQL_QUERY_ALL = "SELECT " GAS_ASSET_COLUMNS " FROM Assets ORDER BY Name ASC;";
+
+// 数据库结构版本 (PRAGMA user_version)，每次修改表结构时 +1 并在 SCHEMA_MIGRATIONS 末尾追加迁移语句
+// 迁移步骤：MIGRATIONS[i] 把数据库从版本 i+1 升级到 i+2 (版本 1 = 初始建表)
+const char* SCHEMA_MIGRATIONS[] =
+{
+    // 1 -> 2：为常用查询字段建立索引
+    "CREATE INDEX IF NOT EXISTS IDX_Assets_FileHash ON Assets(FileHash);"
+    "CREATE INDEX IF NOT EXISTS IDX_Assets_Type ON Assets(Type);"
+    "CREATE INDEX IF NOT EXISTS IDX_Assets_Name ON Assets(Name);",
+};
+const int32_t GAS_DB_SCHEMA_VERSION = 1 + (int32_t)(sizeof(SCHEMA_MIGRATIONS) / sizeof(SCHEMA_MIGRATIONS[0]));
+
+// 辅助：按 GAS_ASSET_COLUMNS 的列顺序读取一行
+static void ReadMetadataRow(sqlite3_stmt* stmt, FGASAssetMetadata& Meta)
+{
+    const unsigned char* NameText = sqlite3_column_text(stmt, 1);
+    const unsigned char* PathText = sqlite3_column_text(stmt, 3);
+
+    Meta.GUID = (uint64_t)sqlite3_column_int64(stmt, 0);
+    Meta.Name = NameText ? reinterpret_cast<const char*>(NameText) : "";
+    Meta.Type = static_cast<EGASAssetType>(sqlite3_column_int(stmt, 2));
+    Meta.BinaryFilePath = PathText ? reinterpret_cast<const char*>(PathText) : "";
+    Meta.FileHash = (uint64_t)sqlite3_column_int64(stmt, 4);
+    Meta.FrameCount = sqlite3_column_int(stmt, 5);
+    Meta.Duration = (float)sqlite3_column_double(stmt, 6);
+    Meta.BoneCount = sqlite3_column_int(stmt, 7);
+    Meta.VerticeCount = sqlite3_column_int(stmt, 8);
+    Meta.MeshCount = sqlite3_column_int(stmt, 9);
+}
+
 GASMetadataStorage::GASMetadataStorage() : DB(nullptr) {}
 
 GASMetadataStorage::~GASMetadataStorage()
 {
+    Close();
+}
+
+void GASMetadataStorage::Close()
+{
+    std::lock_guard<std::recursive_mutex> Lock(DBMutex);
+    if (BatchDepth > 0)
+    {
+        GAS_LOG_WARN("Metadata DB closed inside an open batch, committing pending writes.");
+        BatchDepth = 1;
+        CommitBatch();
+    }
+    sqlite3_stmt** Statements[] = { &InsertStmt, &QueryByGUIDStmt, &QueryByHashStmt, &QueryAllStmt };
+    for (sqlite3_stmt** Stmt : Statements)
+    {
+        if (*Stmt)
+        {
+            sqlite3_finalize(*Stmt);
+            *Stmt = nullptr;
+        }
+    }
     if (DB)
     {
         sqlite3_close(DB);
@@ -30,9 +89,27 @@ GASMetadataStorage::~GASMetadataStorage()
     }
 }
 
+bool GASMetadataStorage::ExecuteSQL(const char* SQL)
+{
+    char* zErrMsg = 0;
+    int rc = sqlite3_exec(DB, SQL, 0, 0, &zErrMsg);
+    if (rc != SQLITE_OK)
+    {
+        GAS_LOG_ERROR("SQL error: %s (%s)", zErrMsg ? zErrMsg : "unknown", SQL);
+        sqlite3_free(zErrMsg);
+        return false;
+    }
+    return true;
+}
+
 // 初始化数据库，创建表结构
-bool GASMetadataStorage::Initialize(const std::string& DBPath)
+bool GASMetadataStorage::Initialize(const std::string& DBPath, EGASDBSyncMode SyncMode)
 {
+    std::lock_guard<std::recursive_mutex> Lock(DBMutex);
+
+    // 允许重复初始化 (例如切换数据库)
+    Close();
+
     //打开或创建数据库文件
     int rc = sqlite3_open(DBPath.c_str(), &DB);
     if (rc != SQLITE_OK)
@@ -40,30 +117,188 @@ bool GASMetadataStorage::Initialize(const std::string& DBPath)
         GAS_LOG_ERROR("Cannot open database: %s (Path: %s)", sqlite3_errmsg(DB), DBPath.c_str());
         return false;
     }
+
+    // 其他进程 (编辑器/命令行工具) 持有写锁时等待一段时间，而不是立即返回 SQLITE_BUSY
+    sqlite3_busy_timeout(DB, METADATA_DB_BUSY_TIMEOUT_MS);
+
+    // WAL：写入不阻塞读取，提交时只追加日志，不再每次重写数据库页
+    if (!ExecuteSQL("PRAGMA journal_mode=WAL;"))
+    {
+        GAS_LOG_WARN("Failed to enable WAL mode, falling back to default journal.");
+    }
+    SetSyncMode(SyncMode);
+
     //执行建表语句 (SQL_CREATE_TABLE)
-    char* zErrMsg = 0;
-    rc = sqlite3_exec(DB, SQL_CREATE_TABLE, 0, 0, &zErrMsg);
-    if (rc != SQLITE_OK)
+    if (!ExecuteSQL(SQL_CREATE_TABLE))
+    {
+        return false;
+    }
+
+    // 升级旧数据库
+    if (!MigrateSchema())
     {
-        GAS_LOG_ERROR("SQL error during table creation: %s", zErrMsg);
-        sqlite3_free(zErrMsg);
         return false;
     }
+
+    // 预编译常用语句，整个生命周期复用
+    struct FStatementDesc { const char* SQL; sqlite3_stmt** Target; };
+    const FStatementDesc Statements[] =
+    {
+        { SQL_INSERT_ASSET, &InsertStmt },
+        { SQL_QUERY_BY_GUID, &QueryByGUIDStmt },
+        { SQL_QUERY_BY_HASH, &QueryByHashStmt },
+        { SQL_QUERY_ALL, &QueryAllStmt },
+    };
+    for (const FStatementDesc& Desc : Statements)
+    {
+        rc = sqlite3_prepare_v2(DB, Desc.SQL, -1, Desc.Target, NULL);
+        if (rc != SQLITE_OK)
+        {
+            GAS_LOG_ERROR("Failed to prepare statement: %s (%s)", sqlite3_errmsg(DB), Desc.SQL);
+            return false;
+        }
+    }
     return true;
 }
 
-// 注册资产元数据
-bool GASMetadataStorage::RegisterAsset(const FGASAssetMetadata& Metadata)
+int32_t GASMetadataStorage::GetSchemaVersion() const
+{
+    std::lock_guard<std::recursive_mutex> Lock(DBMutex);
+    if (!DB) return 0;
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(DB, "PRAGMA user_version;", -1, &stmt, NULL) != SQLITE_OK) return 0;
+
+    int32_t Version = 0;
+    if (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        Version = sqlite3_column_int(stmt, 0);
+    }
+    sqlite3_finalize(stmt);
+    return Version;
+}
+
+bool GASMetadataStorage::MigrateSchema()
+{
+    int32_t StoredVersion = GetSchemaVersion();
+    if (StoredVersion == GAS_DB_SCHEMA_VERSION) return true;
+
+    if (StoredVersion > GAS_DB_SCHEMA_VERSION)
+    {
+        GAS_LOG_ERROR("Metadata DB schema version %d is newer than supported version %d.", StoredVersion, GAS_DB_SCHEMA_VERSION);
+        return false;
+    }
+
+    // 旧数据库未设置 user_version (=0)，此时表已由 SQL_CREATE_TABLE 建好，视为版本 1
+    int32_t Version = (StoredVersion < 1) ? 1 : StoredVersion;
+
+    if (!ExecuteSQL("BEGIN IMMEDIATE TRANSACTION;")) return false;
+
+    for (int32_t Step = Version; Step < GAS_DB_SCHEMA_VERSION; ++Step)
+    {
+        if (!ExecuteSQL(SCHEMA_MIGRATIONS[Step - 1]))
+        {
+            GAS_LOG_ERROR("Metadata DB migration %d -> %d failed.", Step, Step + 1);
+            ExecuteSQL("ROLLBACK;");
+            return false;
+        }
+    }
+
+    std::string SetVersion = "PRAGMA user_version = " + std::to_string(GAS_DB_SCHEMA_VERSION) + ";";
+    if (!ExecuteSQL(SetVersion.c_str()) || !ExecuteSQL("COMMIT;"))
+    {
+        ExecuteSQL("ROLLBACK;");
+        return false;
+    }
+
+    GAS_LOG("Metadata DB schema migrated from version %d to %d.", Version, GAS_DB_SCHEMA_VERSION);
+    return true;
+}
+
+bool GASMetadataStorage::SetSyncMode(EGASDBSyncMode SyncMode)
 {
+    std::lock_guard<std::recursive_mutex> Lock(DBMutex);
     if (!DB) return false;
 
-    // 增加了 FileHash 字段的插入逻辑
-    const char* sql = "INSERT OR REPLACE INTO Assets (GUID, Name, Type, BinaryFilePath, FileHash, FrameCount, Duration, BoneCount, VerticeCount, MeshCount) "
-        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?);";
+    switch (SyncMode)
+    {
+    case EGASDBSyncMode::Off:    return ExecuteSQL("PRAGMA synchronous=OFF;");
+    case EGASDBSyncMode::Normal: return ExecuteSQL("PRAGMA synchronous=NORMAL;");
+    case EGASDBSyncMode::Full:   return ExecuteSQL("PRAGMA synchronous=FULL;");
+    }
+    return false;
+}
+
+// 批处理
+bool GASMetadataStorage::BeginBatch()
+{
+    std::lock_guard<std::recursive_mutex> Lock(DBMutex);
+    if (!DB) return false;
+
+    if (BatchDepth == 0)
+    {
+        if (!ExecuteSQL("BEGIN IMMEDIATE TRANSACTION;")) return false;
+    }
+    else if (bBatchRolledBack)
+    {
+        GAS_LOG_ERROR("Metadata batch: cannot begin a nested batch after the enclosing transaction was rolled back.");
+        return false;
+    }
+    ++BatchDepth;
+    return true;
+}
+
+bool GASMetadataStorage::CommitBatch()
+{
+    std::lock_guard<std::recursive_mutex> Lock(DBMutex);
+    if (!DB || BatchDepth <= 0) return false;
+
+    if (--BatchDepth > 0) return !bBatchRolledBack;
+
+    if (bBatchRolledBack)
+    {
+        bBatchRolledBack = false;
+        GAS_LOG_WARN("Metadata batch: nothing committed, the transaction was rolled back by a nested batch.");
+        return false;
+    }
+
+    if (!ExecuteSQL("COMMIT;"))
+    {
+        ExecuteSQL("ROLLBACK;");
+        return false;
+    }
+    return true;
+}
+
+void GASMetadataStorage::RollbackBatch()
+{
+    std::lock_guard<std::recursive_mutex> Lock(DBMutex);
+    if (!DB || BatchDepth <= 0) return;
+
+    // 只结束本层；外层仍须配对调用 CommitBatch/RollbackBatch，并由其得知事务已回滚
+    if (!bBatchRolledBack)
+    {
+        ExecuteSQL("ROLLBACK;");
+        bBatchRolledBack = BatchDepth > 1;
+    }
+    if (--BatchDepth == 0) bBatchRolledBack = false;
+}
+
+// 注册资产元数据
+bool GASMetadataStorage::RegisterAsset(const FGASAssetMetadata& Metadata)
+{
+    std::lock_guard<std::recursive_mutex> Lock(DBMutex);
+    if (!DB || !InsertStmt) return false;
+    if (bBatchRolledBack)
+    {
+        // 事务已回滚，此时写入会在事务外自动提交
+        GAS_LOG_ERROR("Failed to register asset %llu: enclosing metadata batch was rolled back", Metadata.GUID);
+        return false;
+    }
 
-    sqlite3_stmt* stmt;
-    int rc = sqlite3_prepare_v2(DB, sql, -1, &stmt, NULL);
-    if (rc != SQLITE_OK) return false;
+    sqlite3_stmt* stmt = InsertStmt;
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
 
     // 绑定参数
     sqlite3_bind_int64(stmt, 1, Metadata.GUID);
@@ -77,78 +312,76 @@ bool GASMetadataStorage::RegisterAsset(const FGASAssetMetadata& Metadata)
     sqlite3_bind_int(stmt, 9, Metadata.VerticeCount);
     sqlite3_bind_int(stmt, 10, Metadata.MeshCount);
 
-    rc = sqlite3_step(stmt);
-    sqlite3_finalize(stmt);
+    int rc = sqlite3_step(stmt);
+
+    // 立即重置，释放对绑定字符串的引用
+    sqlite3_reset(stmt);
 
-    return rc == SQLITE_DONE;
+    if (rc != SQLITE_DONE)
+    {
+        GAS_LOG_ERROR("Failed to register asset %llu: %s", Metadata.GUID, sqlite3_errmsg(DB));
+        return false;
+    }
+    return true;
 }
 
-// 通过 GUID 查找元数据
-bool GASMetadataStorage::QueryAssetByGUID(uint64_t GUID, FGASAssetMetadata& OutMetadata) const
+bool GASMetadataStorage::RegisterAssets(const std::vector<FGASAssetMetadata>& MetadataList)
 {
-    if (!DB) return false;
+    std::lock_guard<std::recursive_mutex> Lock(DBMutex);
+    if (MetadataList.empty()) return true;
+    if (!BeginBatch()) return false;
 
-    const char* sql = "SELECT Name, Type, BinaryFilePath, FileHash, FrameCount, Duration, BoneCount, VerticeCount, MeshCount FROM Assets WHERE GUID = ?;";
-    sqlite3_stmt* stmt;
+    for (const FGASAssetMetadata& Metadata : MetadataList)
+    {
+        if (!RegisterAsset(Metadata))
+        {
+            RollbackBatch();
+            return false;
+        }
+    }
+    return CommitBatch();
+}
 
-    int rc = sqlite3_prepare_v2(DB, sql, -1, &stmt, NULL);
-    if (rc != SQLITE_OK) return false;
+// 通过 GUID 查找元数据
+bool GASMetadataStorage::QueryAssetByGUID(uint64_t GUID, FGASAssetMetadata& OutMetadata) const
+{
+    std::lock_guard<std::recursive_mutex> Lock(DBMutex);
+    if (!DB || !QueryByGUIDStmt) return false;
 
+    sqlite3_stmt* stmt = QueryByGUIDStmt;
+    sqlite3_reset(stmt);
     sqlite3_bind_int64(stmt, 1, GUID);
 
-    rc = sqlite3_step(stmt);
-
-    if (rc == SQLITE_ROW)
+    bool bFound = false;
+    if (sqlite3_step(stmt) == SQLITE_ROW)
     {
-        OutMetadata.GUID = GUID;
-        OutMetadata.Name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
-        OutMetadata.Type = static_cast<EGASAssetType>(sqlite3_column_int(stmt, 1));
-        OutMetadata.BinaryFilePath = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 2));
-        OutMetadata.FileHash = (uint64_t)sqlite3_column_int64(stmt, 3); // 读取哈希值
-        OutMetadata.FrameCount = sqlite3_column_int(stmt, 4);
-        OutMetadata.Duration = (float)sqlite3_column_double(stmt, 5);
-        OutMetadata.BoneCount = sqlite3_column_int(stmt, 6);
-        OutMetadata.VerticeCount = sqlite3_column_int(stmt, 7);
-        OutMetadata.MeshCount = sqlite3_column_int(stmt, 8);
-
-        sqlite3_finalize(stmt);
-        return true;
+        ReadMetadataRow(stmt, OutMetadata);
+        bFound = true;
     }
 
-    sqlite3_finalize(stmt);
-    return false;
+    sqlite3_reset(stmt);
+    return bFound;
 }
 
 //通过文件hash寻找到对应的所有资产
 bool GASMetadataStorage::QueryAssetsByFileHash(uint64_t FileHash, std::vector<FGASAssetMetadata>& OutList)
 {
-    if (!DB) return false;
-
-    const char* sql = "SELECT GUID, Name, Type, BinaryFilePath, FrameCount, Duration, BoneCount, VerticeCount, MeshCount FROM Assets WHERE FileHash = ?;";
+    std::lock_guard<std::recursive_mutex> Lock(DBMutex);
+    if (!DB || !QueryByHashStmt) return false;
 
-    sqlite3_stmt* stmt;
-    if (sqlite3_prepare_v2(DB, sql, -1, &stmt, NULL) != SQLITE_OK) return false;
-
-    sqlite3_bind_int64(stmt, 1, FileHash);
+    sqlite3_stmt* stmt = QueryByHashStmt;
+    sqlite3_reset(stmt);
+    sqlite3_bind_int64(stmt, 1, (sqlite3_int64)FileHash);
 
     OutList.clear();
     while (sqlite3_step(stmt) == SQLITE_ROW)
     {
         FGASAssetMetadata Meta;
-        Meta.GUID = (uint64_t)sqlite3_column_int64(stmt, 0);
-        Meta.Name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-        Meta.Type = static_cast<EGASAssetType>(sqlite3_column_int(stmt, 2));
-        Meta.BinaryFilePath = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
-        Meta.FrameCount = sqlite3_column_int(stmt, 4);
-        Meta.Duration = (float)sqlite3_column_double(stmt, 5);
-        Meta.BoneCount = sqlite3_column_int(stmt, 6);
-        Meta.VerticeCount = sqlite3_column_int(stmt, 7);
-        Meta.MeshCount = sqlite3_column_int(stmt, 8);
-
+        ReadMetadataRow(stmt, Meta);
         OutList.push_back(Meta);
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
     return !OutList.empty();
 }
 
@@ -156,32 +389,20 @@ bool GASMetadataStorage::QueryAssetsByFileHash(uint64_t FileHash, std::vector<FG
 std::vector<FGASAssetMetadata> GASMetadataStorage::QueryAllAssets() const
 {
     std::vector<FGASAssetMetadata> Results;
-    if (!DB) return Results;
 
-    const char* sql = "SELECT GUID, Name, Type, BinaryFilePath, FileHash, FrameCount, Duration, BoneCount, VerticeCount, MeshCount FROM Assets ORDER BY Name ASC;";
-    sqlite3_stmt* stmt;
+    std::lock_guard<std::recursive_mutex> Lock(DBMutex);
+    if (!DB || !QueryAllStmt) return Results;
 
-    int rc = sqlite3_prepare_v2(DB, sql, -1, &stmt, NULL);
-    if (rc != SQLITE_OK) return Results;
+    sqlite3_stmt* stmt = QueryAllStmt;
+    sqlite3_reset(stmt);
 
-    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    while (sqlite3_step(stmt) == SQLITE_ROW)
     {
         FGASAssetMetadata Meta;
-        Meta.GUID = sqlite3_column_int64(stmt, 0);
-        Meta.Name = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1));
-        Meta.Type = static_cast<EGASAssetType>(sqlite3_column_int(stmt, 2));
-        Meta.BinaryFilePath = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 3));
-        Meta.FileHash = (uint64_t)sqlite3_column_int64(stmt, 4); // 读取哈希值
-        Meta.FrameCount = sqlite3_column_int(stmt, 5);
-        Meta.Duration = (float)sqlite3_column_double(stmt, 6);
-        Meta.BoneCount = sqlite3_column_int(stmt, 7);
-        Meta.VerticeCount = sqlite3_column_int(stmt, 8);
-        Meta.MeshCount = sqlite3_column_int(stmt, 9);
-
+        ReadMetadataRow(stmt, Meta);
         Results.push_back(Meta);
     }
 
-    sqlite3_finalize(stmt);
+    sqlite3_reset(stmt);
     return Results;
-}
-
+}
\ No newline at end of file
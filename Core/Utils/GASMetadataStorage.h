@@ -3,8 +3,10 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <sqlite/sqlite3.h>
 #include "../Types/GASCoreTypes.h"
+#include "../Types/GASConfig.h"
 
 // 用于数据库查询结果的轻量级结构体
 struct FGASAssetMetadata
@@ -30,12 +32,25 @@ public:
     GASMetadataStorage();
     ~GASMetadataStorage();
 
-    // 初始化数据库，创建表结构 
-    bool Initialize(const std::string& DBPath);
+    // 初始化数据库，创建表结构 (开启 WAL 日志并设置同步级别)
+    bool Initialize(const std::string& DBPath, EGASDBSyncMode SyncMode = EGASDBSyncMode::Normal);
 
-    //导入成功后，向数据库注册资产的元数据 
+    // 修改同步级别 
+    bool SetSyncMode(EGASDBSyncMode SyncMode);
+
+    //导入成功后，向数据库注册资产的元数据 (在批处理中时不会单独提交)
     bool RegisterAsset(const FGASAssetMetadata& Metadata);
 
+    // 批量注册：单个事务内复用同一条预编译语句
+    bool RegisterAssets(const std::vector<FGASAssetMetadata>& MetadataList);
+
+    // 批处理：BeginBatch/CommitBatch 之间的所有写入合并为一个事务，可嵌套 (只有最外层真正提交)
+    // 任一层 RollbackBatch 会回滚整个事务，之后各层 CommitBatch 均返回 false，直到最外层结束
+    bool BeginBatch();
+    bool CommitBatch();
+    void RollbackBatch();
+    bool IsInBatch() const { return BatchDepth > 0; }
+
     //通过 GUID 查找元数据
     bool QueryAssetByGUID(uint64_t GUID, FGASAssetMetadata& OutMetadata) const;
 
@@ -47,6 +62,34 @@ public:
     // 查找所有资产元数据
     std::vector<FGASAssetMetadata> QueryAllAssets() const;
 
+    // 当前数据库结构版本 (PRAGMA user_version)
+    int32_t GetSchemaVersion() const;
+
+private:
+    // 执行不返回结果的 SQL 语句
+    bool ExecuteSQL(const char* SQL);
+
+    // 关闭数据库并释放预编译语句
+    void Close();
+
+    // 按 user_version 逐步升级旧数据库结构 (建索引等)
+    bool MigrateSchema();
+
 private:
     sqlite3* DB = nullptr;
+
+    // 预编译语句，Initialize 时创建，整个生命周期复用 (查询接口是 const，故为 mutable)
+    sqlite3_stmt* InsertStmt = nullptr;
+    mutable sqlite3_stmt* QueryByGUIDStmt = nullptr;
+    mutable sqlite3_stmt* QueryByHashStmt = nullptr;
+    mutable sqlite3_stmt* QueryAllStmt = nullptr;
+
+    // 保护连接与预编译语句，允许多线程查询 (递归锁：批处理内部会再次加锁)
+    mutable std::recursive_mutex DBMutex;
+
+    // 批处理嵌套深度
+    int32_t BatchDepth = 0;
+
+    // 事务已被内层回滚，外层尚未结束
+    bool bBatchRolledBack = false;
 };
\ No newline at end of file
@@ -0,0 +1,215 @@
+﻿#include "GASPakFile.h"
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+#include "GASBinarySerializer.h"
+#include "GASFileHelper.h"
+#include "GASLogging.h"
+
+static uint64_t AlignUp64(uint64_t Value, uint64_t Alignment)
+{
+    return (Value + Alignment - 1) / Alignment * Alignment;
+}
+
+// 辅助：用 0 填充到指定偏移
+static bool PadTo(std::ofstream& Stream, uint64_t CurrentOffset, uint64_t TargetOffset)
+{
+    static const char Zeros[256] = { 0 };
+    uint64_t Remaining = TargetOffset - CurrentOffset;
+    while (Remaining > 0)
+    {
+        uint64_t Chunk = std::min<uint64_t>(Remaining, sizeof(Zeros));
+        if (!Stream.write(Zeros, (std::streamsize)Chunk)) return false;
+        Remaining -= Chunk;
+    }
+    return true;
+}
+
+bool GASPakFile::WritePak(const std::vector<FGASPakSource>& Sources, const std::string& OutFilePath, uint32_t Alignment)
+{
+    if (Alignment == 0 || (Alignment & (Alignment - 1)) != 0)
+    {
+        GAS_LOG_ERROR("Pak: alignment must be a power of two (got %u)", Alignment);
+        return false;
+    }
+
+    std::ofstream Stream(OutFilePath, std::ios::binary | std::ios::trunc);
+    if (!Stream.is_open())
+    {
+        GAS_LOG_ERROR("Pak: failed to open %s for writing", OutFilePath.c_str());
+        return false;
+    }
+
+    FGASPakHeader OutHeader;
+    std::memset(&OutHeader, 0, sizeof(OutHeader));
+    OutHeader.Magic = GAS_PAK_MAGIC;
+    OutHeader.Version = GAS_PAK_VERSION;
+    OutHeader.Alignment = Alignment;
+
+    // 先占位写头，数据写完后回填
+    if (!Stream.write(reinterpret_cast<const char*>(&OutHeader), sizeof(OutHeader))) return false;
+    uint64_t Offset = sizeof(OutHeader);
+
+    std::vector<FGASPakEntry> Toc;
+    std::vector<char> StringTable;
+    Toc.reserve(Sources.size());
+
+    for (const FGASPakSource& Source : Sources)
+    {
+        std::vector<uint8_t> FileData;
+        if (!GASFileHelper::LoadFileToBuffer(Source.FilePath, FileData) || FileData.size() < sizeof(FGASAssetHeader))
+        {
+            GAS_LOG_ERROR("Pak: failed to read asset %s", Source.FilePath.c_str());
+            return false;
+        }
+
+        const FGASAssetHeader* AssetHeader = reinterpret_cast<const FGASAssetHeader*>(FileData.data());
+        if (AssetHeader->Magic != GAS_ASSET_MAGIC)
+        {
+            GAS_LOG_ERROR("Pak: not a .gas file: %s", Source.FilePath.c_str());
+            return false;
+        }
+
+        uint64_t DataOffset = AlignUp64(Offset, Alignment);
+        if (!PadTo(Stream, Offset, DataOffset)) return false;
+        if (!Stream.write(reinterpret_cast<const char*>(FileData.data()), (std::streamsize)FileData.size())) return false;
+        Offset = DataOffset + FileData.size();
+
+        FGASPakEntry Entry;
+        std::memset(&Entry, 0, sizeof(Entry));
+        Entry.GUID = Source.GUID;
+        Entry.Offset = DataOffset;
+        Entry.Size = FileData.size();
+        Entry.Type = AssetHeader->AssetType;
+        Entry.NameOffset = (uint32_t)StringTable.size();
+        StringTable.insert(StringTable.end(), Source.Name.begin(), Source.Name.end());
+        StringTable.push_back('\0');
+        Toc.push_back(Entry);
+    }
+
+    std::sort(Toc.begin(), Toc.end(), [](const FGASPakEntry& A, const FGASPakEntry& B) { return A.GUID < B.GUID; });
+    for (size_t i = 1; i < Toc.size(); ++i)
+    {
+        if (Toc[i].GUID == Toc[i - 1].GUID)
+        {
+            GAS_LOG_ERROR("Pak: duplicate GUID %llu", Toc[i].GUID);
+            return false;
+        }
+    }
+
+    // 目录
+    OutHeader.TocOffset = AlignUp64(Offset, 8);
+    if (!PadTo(Stream, Offset, OutHeader.TocOffset)) return false;
+    if (!Toc.empty() && !Stream.write(reinterpret_cast<const char*>(Toc.data()), (std::streamsize)(Toc.size() * sizeof(FGASPakEntry)))) return false;
+    Offset = OutHeader.TocOffset + Toc.size() * sizeof(FGASPakEntry);
+
+    // 字符串表
+    OutHeader.StringTableOffset = Offset;
+    OutHeader.StringTableSize = (uint32_t)StringTable.size();
+    if (!StringTable.empty() && !Stream.write(StringTable.data(), (std::streamsize)StringTable.size())) return false;
+
+    // 回填头
+    OutHeader.EntryCount = (uint32_t)Toc.size();
+    Stream.seekp(0);
+    if (!Stream.write(reinterpret_cast<const char*>(&OutHeader), sizeof(OutHeader))) return false;
+
+    GAS_LOG("Pak: wrote %u assets to %s", OutHeader.EntryCount, OutFilePath.c_str());
+    return Stream.good();
+}
+
+bool GASPakFile::Open(const std::string& FilePath)
+{
+    Close();
+
+    if (!MappedFile.Open(FilePath))
+    {
+        return false;
+    }
+
+    const uint8_t* Base = MappedFile.GetData();
+    const size_t FileSize = MappedFile.GetSize();
+    const FGASPakHeader* FileHeader = reinterpret_cast<const FGASPakHeader*>(Base);
+
+    // 区间按 Size <= FileSize - Offset 比较，偏移取任意值都不会回绕
+    bool bValid = FileSize >= sizeof(FGASPakHeader)
+        && FileHeader->Magic == GAS_PAK_MAGIC
+        && FileHeader->Version == GAS_PAK_VERSION
+        && FileHeader->TocOffset <= FileSize
+        && (uint64_t)FileHeader->EntryCount * sizeof(FGASPakEntry) <= FileSize - FileHeader->TocOffset
+        && FileHeader->StringTableOffset <= FileSize
+        && FileHeader->StringTableSize <= FileSize - FileHeader->StringTableOffset;
+
+    // 字符串表须以 '\0' 结尾，之后 GetEntryName 只需检查偏移
+    if (bValid && FileHeader->EntryCount > 0)
+    {
+        const char* FileStrings = reinterpret_cast<const char*>(Base + FileHeader->StringTableOffset);
+        bValid = FileHeader->StringTableSize > 0 && FileStrings[FileHeader->StringTableSize - 1] == '\0';
+    }
+
+    if (!bValid)
+    {
+        GAS_LOG_ERROR("Pak: invalid pak file %s", FilePath.c_str());
+        MappedFile.Close();
+        return false;
+    }
+
+    Header = FileHeader;
+    Toc = reinterpret_cast<const FGASPakEntry*>(Base + Header->TocOffset);
+    StringTable = reinterpret_cast<const char*>(Base + Header->StringTableOffset);
+
+    // 校验每个区间都在文件内、名称偏移在字符串表内，且 GUID 严格升序 (Find 依赖二分查找)
+    for (uint32_t i = 0; i < Header->EntryCount; ++i)
+    {
+        if (Toc[i].Offset > FileSize || Toc[i].Size > FileSize - Toc[i].Offset || Toc[i].NameOffset >= Header->StringTableSize)
+        {
+            GAS_LOG_ERROR("Pak: entry %llu out of range in %s", Toc[i].GUID, FilePath.c_str());
+            Close();
+            return false;
+        }
+        if (i > 0 && Toc[i].GUID <= Toc[i - 1].GUID)
+        {
+            GAS_LOG_ERROR("Pak: table of contents is not sorted by GUID at entry %u in %s", i, FilePath.c_str());
+            Close();
+            return false;
+        }
+    }
+
+    PakPath = FilePath;
+    GAS_LOG("Pak: mounted %s (%u assets)", FilePath.c_str(), Header->EntryCount);
+    return true;
+}
+
+void GASPakFile::Close()
+{
+    Header = nullptr;
+    Toc = nullptr;
+    StringTable = nullptr;
+    PakPath.clear();
+    MappedFile.Close();
+}
+
+const FGASPakEntry* GASPakFile::Find(uint64_t GUID) const
+{
+    if (!Header) return nullptr;
+
+    const FGASPakEntry* Begin = Toc;
+    const FGASPakEntry* End = Toc + Header->EntryCount;
+    const FGASPakEntry* It = std::lower_bound(Begin, End, GUID,
+        [](const FGASPakEntry& Entry, uint64_t Key) { return Entry.GUID < Key; });
+
+    return (It != End && It->GUID == GUID) ? It : nullptr;
+}
+
+std::shared_ptr<GASAsset> GASPakFile::LoadAsset(uint64_t GUID) const
+{
+    const FGASPakEntry* Entry = Find(GUID);
+    if (!Entry) return nullptr;
+
+    std::shared_ptr<GASAsset> Asset = GASBinarySerializer::LoadAssetFromMemory(GetEntryData(*Entry), (size_t)Entry->Size, PakPath);
+    if (Asset)
+    {
+        Asset->BaseHeader.AssetGUID = GUID;
+        Asset->AssetName = GetEntryName(*Entry);
+    }
+    return Asset;
+}
@@ -0,0 +1,88 @@
+﻿#pragma once
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include "../Types/GASAsset.h"
+#include "GASMappedFile.h"
+
+// 包文件标识 "GASP"
+const uint32_t GAS_PAK_MAGIC = 0x50534147;
+static const uint32_t GAS_PAK_VERSION = 1;
+
+// 默认数据对齐：4KB，对齐到页便于映射与直接 I/O
+static const uint32_t GAS_PAK_DEFAULT_ALIGNMENT = 4096;
+
+// 包文件头 48 字节
+struct FGASPakHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t EntryCount;
+    uint32_t Alignment;
+
+    uint64_t TocOffset;         // FGASPakEntry[EntryCount]，按 GUID 升序
+    uint64_t StringTableOffset; // 资产名称
+    uint32_t StringTableSize;
+    uint32_t Reserved[3];
+};
+
+// 目录项 32 字节
+struct FGASPakEntry
+{
+    uint64_t GUID;
+    uint64_t Offset;        // 相对包文件起始位置
+    uint64_t Size;          // 原 .gas 文件字节数
+    EGASAssetType Type;
+    uint32_t NameOffset;    // 名称在字符串表中的偏移
+};
+// 包文件布局：[Header][Asset0 (对齐)][Asset1 (对齐)]...[TOC][StringTable]
+
+// 打包输入：一个已存在的 .gas 文件
+struct FGASPakSource
+{
+    uint64_t GUID = 0;
+    std::string Name;
+    std::string FilePath;
+};
+
+// .gas 资产包：把多个资产合并为一个文件，只需一次打开，通过映射区间读取
+class GASPakFile
+{
+public:
+    // 打包：按 Alignment 对齐写入每个资产，末尾写入 GUID 目录
+    static bool WritePak(const std::vector<FGASPakSource>& Sources, const std::string& OutFilePath, uint32_t Alignment = GAS_PAK_DEFAULT_ALIGNMENT);
+
+    // 映射包文件
+    bool Open(const std::string& FilePath);
+
+    void Close();
+
+    bool IsOpen() const { return Header != nullptr; }
+
+    const std::string& GetPath() const { return PakPath; }
+
+    uint32_t GetNumEntries() const { return Header ? Header->EntryCount : 0; }
+
+    // 二分查找目录项
+    const FGASPakEntry* Find(uint64_t GUID) const;
+
+    bool Contains(uint64_t GUID) const { return Find(GUID) != nullptr; }
+
+    // 资产在映射内存中的起始地址 (生命周期同包文件)
+    const uint8_t* GetEntryData(const FGASPakEntry& Entry) const { return MappedFile.GetData() + Entry.Offset; }
+
+    // 偏移与字符串表结尾 '\0' 已在 Open 时校验
+    const char* GetEntryName(const FGASPakEntry& Entry) const { return StringTable + Entry.NameOffset; }
+
+    // 直接从映射区间反序列化资产
+    std::shared_ptr<GASAsset> LoadAsset(uint64_t GUID) const;
+
+private:
+    std::string PakPath;
+    GASMappedFile MappedFile;
+
+    const FGASPakHeader* Header = nullptr;
+    const FGASPakEntry* Toc = nullptr;
+    const char* StringTable = nullptr;
+};
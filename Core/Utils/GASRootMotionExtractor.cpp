@@ -0,0 +1,89 @@
+﻿#include "GASRootMotionExtractor.h"
+#include <vector>
+#include <cmath>
+#include "GASMath.h"
+#include "GASLogging.h"
+
+// 旋转绕 Y 轴的分量 (swing-twist 分解的 twist 角)
+static float ExtractYaw(const FGASQuaternion& Q)
+{
+    return 2.0f * std::atan2(Q.Y, Q.W);
+}
+
+static FGASQuaternion YawQuat(float Yaw)
+{
+    return FGASQuaternion(0.0f, std::sin(Yaw * 0.5f), 0.0f, std::cos(Yaw * 0.5f));
+}
+
+bool GASRootMotionExtractor::Extract(GASAnimation* Animation, const GASSkeleton* Skeleton, const FGASRootMotionSettings& Settings)
+{
+    if (!Animation || !Skeleton || Animation->GetNumFrames() == 0) return false;
+    if (Animation->IsAdditive())
+    {
+        GAS_LOG_WARN("RootMotion: %s is additive, root motion not extracted", Animation->AssetName.c_str());
+        return false;
+    }
+
+    const int32_t NumTracks = (int32_t)Animation->AnimHeader.TrackCount;
+    if (NumTracks != Skeleton->GetNumBones())
+    {
+        GAS_LOG_ERROR("RootMotion: %s has %d tracks, skeleton has %d bones", Animation->AssetName.c_str(), NumTracks, Skeleton->GetNumBones());
+        return false;
+    }
+
+    int32_t RootBone = -1;
+    if (!Settings.RootBoneName.empty())
+    {
+        RootBone = Skeleton->FindBoneIndex(Settings.RootBoneName);
+    }
+    else
+    {
+        for (int32_t b = 0; b < NumTracks && RootBone < 0; ++b)
+        {
+            if (Skeleton->GetParentIndex(b) < 0) RootBone = b;
+        }
+    }
+    if (RootBone < 0)
+    {
+        GAS_LOG_ERROR("RootMotion: Root bone %s not found in %s", Settings.RootBoneName.c_str(), Skeleton->AssetName.c_str());
+        return false;
+    }
+
+    // 每帧根骨骼的水平位置与朝向 (朝向逐帧展开，避免 ±PI 处跳变)
+    const int32_t NumFrames = Animation->GetNumFrames();
+    std::vector<FGASRootMotionKey> Motion(NumFrames);
+    for (int32_t f = 0; f < NumFrames; ++f)
+    {
+        const FGASTransform& Root = Animation->Tracks[f * NumTracks + RootBone].LocalTransform;
+        Motion[f].Translation = FGASVector3(Root.Translation.X, 0.0f, Root.Translation.Z);
+        Motion[f].Yaw = Settings.bExtractYaw ? ExtractYaw(Root.Rotation) : 0.0f;
+        if (f > 0)
+        {
+            while (Motion[f].Yaw - Motion[f - 1].Yaw > GASMath::PI) Motion[f].Yaw -= 2.0f * GASMath::PI;
+            while (Motion[f].Yaw - Motion[f - 1].Yaw < -GASMath::PI) Motion[f].Yaw += 2.0f * GASMath::PI;
+        }
+    }
+
+    // Key = Mf * Inverse(M0)，根骨骼轨道改为 Inverse(Key) * Root：水平部分恒为 M0，播放时 Key * 新轨道 = 原轨道
+    // 循环点处 Key(末帧) * 新轨道(第 0 帧) = 原轨道末帧，跨圈衔接无跳变
+    const FGASRootMotionKey InvStart = GASAnimation::InverseRootMotion(Motion[0]);
+    Animation->RootMotion.Resize(NumFrames);
+    for (int32_t f = 0; f < NumFrames; ++f)
+    {
+        FGASRootMotionKey Key = GASAnimation::ComposeRootMotion(Motion[f], InvStart);
+        if (f == 0) Key = FGASRootMotionKey();
+        Animation->RootMotion[f] = Key;
+
+        const FGASQuaternion InvYaw = YawQuat(-Key.Yaw);
+        FGASTransform& Root = Animation->Tracks[f * NumTracks + RootBone].LocalTransform;
+        Root.Translation = GASMath::RotateVector(InvYaw, GASMath::Subtract(Root.Translation, Key.Translation));
+        Root.Rotation = GASMath::Normalize(GASMath::Multiply(InvYaw, Root.Rotation));
+    }
+    Animation->AnimHeader.NumRootMotionKeys = (uint32_t)NumFrames;
+
+    // 日志报告根骨骼自身的位移 (Key 的平移还包含绕模型原点转动带来的部分)
+    const FGASRootMotionKey& Total = Animation->RootMotion[NumFrames - 1];
+    GAS_LOG("RootMotion: %s extracted from bone %s, total distance %.3f, turn %.1f deg", Animation->AssetName.c_str(),
+        Skeleton->Bones[RootBone].Name, GASMath::Length(GASMath::Subtract(Motion[NumFrames - 1].Translation, Motion[0].Translation)), Total.Yaw * 180.0f / GASMath::PI);
+    return true;
+}
@@ -0,0 +1,25 @@
+﻿#pragma once
+#include <cstdint>
+#include <string>
+#include "../Types/GASAsset.h"
+
+// 根运动提取参数
+struct FGASRootMotionSettings
+{
+    // 提供根运动的骨骼名，为空时取第一根根骨骼
+    std::string RootBoneName;
+
+    // 是否提取绕 Y 轴的转向 (否则只提取水平位移，朝向保留在骨骼轨道中)
+    bool bExtractYaw = true;
+};
+
+// 导入时把根骨骼的水平位移与转向提取为 GASAnimation::RootMotion 曲线，并从根骨骼轨道中扣除
+// 扣除后第 0 帧不变，之后每帧的水平位置与朝向都与第 0 帧相同；运行时由角色自身按 GetRootMotion 的位移移动
+// 约定 Y 轴向上 (Assimp 导入坐标系)
+class GASRootMotionExtractor
+{
+public:
+    // 原地提取并写入 AnimHeader.NumRootMotionKeys；叠加动画不提取 (其根骨骼轨道已是差值)
+    // 调用方负责之后重新计算 XXHash
+    static bool Extract(GASAnimation* Animation, const GASSkeleton* Skeleton, const FGASRootMotionSettings& Settings);
+};
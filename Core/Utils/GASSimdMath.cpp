@@ -0,0 +1,102 @@
+﻿#include "GASSimdMath.h"
+
+namespace GASSimd
+{
+    // 4 个四元数 AoS -> SoA：X/Y/Z/W 各占一个寄存器
+    static inline void LoadQuat4(const FGASQuaternion* Q, FGASVectorRegister& X, FGASVectorRegister& Y, FGASVectorRegister& Z, FGASVectorRegister& W)
+    {
+        X = LoadQuat(Q[0]); Y = LoadQuat(Q[1]); Z = LoadQuat(Q[2]); W = LoadQuat(Q[3]);
+        VectorTranspose4(X, Y, Z, W);
+    }
+
+    static inline void StoreQuat4(FGASQuaternion* Out, FGASVectorRegister X, FGASVectorRegister Y, FGASVectorRegister Z, FGASVectorRegister W)
+    {
+        VectorTranspose4(X, Y, Z, W);
+        StoreQuat(Out[0], X); StoreQuat(Out[1], Y); StoreQuat(Out[2], Z); StoreQuat(Out[3], W);
+    }
+
+    void QuatMultiplyBatch(const FGASQuaternion* A, const FGASQuaternion* B, int32_t Count, FGASQuaternion* Out)
+    {
+        int32_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            FGASVectorRegister AX, AY, AZ, AW, BX, BY, BZ, BW;
+            LoadQuat4(A + i, AX, AY, AZ, AW);
+            LoadQuat4(B + i, BX, BY, BZ, BW);
+
+            // SoA 下无需洗牌，每条指令同时算 4 个实例
+            const FGASVectorRegister RX = VectorSubtract(VectorAdd(VectorAdd(VectorMultiply(AW, BX), VectorMultiply(AX, BW)), VectorMultiply(AY, BZ)), VectorMultiply(AZ, BY));
+            const FGASVectorRegister RY = VectorAdd(VectorAdd(VectorSubtract(VectorMultiply(AW, BY), VectorMultiply(AX, BZ)), VectorMultiply(AY, BW)), VectorMultiply(AZ, BX));
+            const FGASVectorRegister RZ = VectorAdd(VectorSubtract(VectorAdd(VectorMultiply(AW, BZ), VectorMultiply(AX, BY)), VectorMultiply(AY, BX)), VectorMultiply(AZ, BW));
+            const FGASVectorRegister RW = VectorSubtract(VectorSubtract(VectorSubtract(VectorMultiply(AW, BW), VectorMultiply(AX, BX)), VectorMultiply(AY, BY)), VectorMultiply(AZ, BZ));
+            StoreQuat4(Out + i, RX, RY, RZ, RW);
+        }
+        for (; i < Count; ++i) StoreQuat(Out[i], QuatMultiply(LoadQuat(A[i]), LoadQuat(B[i])));
+    }
+
+    void QuatNlerpBatch(const FGASQuaternion* A, const FGASQuaternion* B, float Alpha, int32_t Count, FGASQuaternion* Out)
+    {
+        const FGASVectorRegister WeightA = VectorSplat(1.0f - Alpha);
+        const FGASVectorRegister WeightB = VectorSplat(Alpha);
+
+        int32_t i = 0;
+        for (; i + 4 <= Count; i += 4)
+        {
+            FGASVectorRegister AX, AY, AZ, AW, BX, BY, BZ, BW;
+            LoadQuat4(A + i, AX, AY, AZ, AW);
+            LoadQuat4(B + i, BX, BY, BZ, BW);
+
+            const FGASVectorRegister Dot = VectorMultiplyAdd(AW, BW, VectorMultiplyAdd(AZ, BZ, VectorMultiplyAdd(AY, BY, VectorMultiply(AX, BX))));
+            const FGASVectorRegister SignedB = VectorMultiplySign(WeightB, Dot);
+            const FGASVectorRegister RX = VectorMultiplyAdd(AX, WeightA, VectorMultiply(BX, SignedB));
+            const FGASVectorRegister RY = VectorMultiplyAdd(AY, WeightA, VectorMultiply(BY, SignedB));
+            const FGASVectorRegister RZ = VectorMultiplyAdd(AZ, WeightA, VectorMultiply(BZ, SignedB));
+            const FGASVectorRegister RW = VectorMultiplyAdd(AW, WeightA, VectorMultiply(BW, SignedB));
+
+            const FGASVectorRegister LengthSq = VectorMultiplyAdd(RW, RW, VectorMultiplyAdd(RZ, RZ, VectorMultiplyAdd(RY, RY, VectorMultiply(RX, RX))));
+            const FGASVectorRegister InvLength = VectorDivide(VectorSplat(1.0f), VectorSqrt(LengthSq));
+            StoreQuat4(Out + i, VectorMultiply(RX, InvLength), VectorMultiply(RY, InvLength), VectorMultiply(RZ, InvLength), VectorMultiply(RW, InvLength));
+        }
+        for (; i < Count; ++i) StoreQuat(Out[i], QuatNlerp(LoadQuat(A[i]), LoadQuat(B[i]), Alpha));
+    }
+
+    void ComposeTransformBatch(const FGASTransform* Transforms, int32_t Count, FGASMatrix4x4* Out)
+    {
+        for (int32_t i = 0; i < Count; ++i) StoreAffine(Out[i], AffineCompose(Transforms[i]));
+    }
+
+    void AffineMultiplyBatch(const FGASMatrix4x4* A, const FGASMatrix4x4* B, int32_t Count, FGASMatrix4x4* Out)
+    {
+        // 存储格式按行存放：R 的第 r 行 = Σ A[r][k] * B 的第 k 行，直接按行计算，免去载入/写回时的转置
+        for (int32_t i = 0; i < Count; ++i)
+        {
+            const FGASVectorRegister B0 = VectorLoad(B[i].M[0]);
+            const FGASVectorRegister B1 = VectorLoad(B[i].M[1]);
+            const FGASVectorRegister B2 = VectorLoad(B[i].M[2]);
+            const FGASVectorRegister B3 = VectorSet(0.0f, 0.0f, 0.0f, 1.0f);
+            FGASVectorRegister Rows[3];
+            for (int r = 0; r < 3; ++r)
+            {
+                const FGASVectorRegister Row = VectorLoad(A[i].M[r]);
+                FGASVectorRegister Sum = VectorMultiply(VectorReplicate<0>(Row), B0);
+                Sum = VectorMultiplyAdd(VectorReplicate<1>(Row), B1, Sum);
+                Sum = VectorMultiplyAdd(VectorReplicate<2>(Row), B2, Sum);
+                Rows[r] = VectorMultiplyAdd(VectorReplicate<3>(Row), B3, Sum);
+            }
+            VectorStore(Out[i].M[0], Rows[0]);
+            VectorStore(Out[i].M[1], Rows[1]);
+            VectorStore(Out[i].M[2], Rows[2]);
+            VectorStore(Out[i].M[3], B3);
+        }
+    }
+
+    void AffineInverseBatch(const FGASMatrix4x4* Matrices, int32_t Count, FGASMatrix4x4* Out)
+    {
+        for (int32_t i = 0; i < Count; ++i) StoreAffine(Out[i], AffineInverse(LoadAffine(Matrices[i])));
+    }
+
+    void ToQuaternionBatch(const FGASMatrix4x4* Matrices, int32_t Count, FGASQuaternion* Out)
+    {
+        for (int32_t i = 0; i < Count; ++i) StoreQuat(Out[i], AffineToQuat(LoadAffine(Matrices[i])));
+    }
+}
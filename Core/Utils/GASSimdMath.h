@@ -0,0 +1,357 @@
+﻿#pragma once
+#include <cstdint>
+#include <cmath>
+#include "GASMath.h"
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define GAS_SIMD_SSE 1
+#include <emmintrin.h>
+#else
+#define GAS_SIMD_SSE 0
+#endif
+
+// 4 通道寄存器：FGASVector3 / FGASQuaternion / FGASMatrix4x4 / FGASMatrix3x4 仍是存储格式，计算前用 Load 系列载入，算完 Store 回去
+#if GAS_SIMD_SSE
+typedef __m128 FGASVectorRegister;
+#else
+struct alignas(16) FGASVectorRegister
+{
+    float V[4];
+};
+#endif
+
+// 仿射矩阵 (列向量布局)：Columns[3] 为平移，各列第 4 个分量为 0，隐含最后一行 (0, 0, 0, 1)
+struct FGASAffineRegister
+{
+    FGASVectorRegister Columns[4];
+};
+
+// SIMD 数学层：底层为少量寄存器原语 (SSE2 或标量回退)，四元数/仿射矩阵内核只写一遍，建立在原语之上
+// 与 GASMath 的约定一致：四元数 A * B，矩阵列向量布局 (Global = Parent * Local)
+namespace GASSimd
+{
+    // 1. 寄存器原语
+
+#if GAS_SIMD_SSE
+    inline FGASVectorRegister VectorZero() { return _mm_setzero_ps(); }
+    inline FGASVectorRegister VectorSet(float X, float Y, float Z, float W) { return _mm_set_ps(W, Z, Y, X); }
+    inline FGASVectorRegister VectorSplat(float S) { return _mm_set1_ps(S); }
+
+    inline FGASVectorRegister VectorLoad(const float* Ptr) { return _mm_loadu_ps(Ptr); }
+    inline FGASVectorRegister VectorLoadAligned(const float* Ptr) { return _mm_load_ps(Ptr); }
+    inline FGASVectorRegister VectorLoadFloat3(const float* Ptr) { return _mm_set_ps(0.0f, Ptr[2], Ptr[1], Ptr[0]); }
+    inline void VectorStore(float* Ptr, FGASVectorRegister V) { _mm_storeu_ps(Ptr, V); }
+    inline void VectorStoreAligned(float* Ptr, FGASVectorRegister V) { _mm_store_ps(Ptr, V); }
+
+    inline void VectorStoreFloat3(float* Ptr, FGASVectorRegister V)
+    {
+        alignas(16) float Temp[4];
+        _mm_store_ps(Temp, V);
+        Ptr[0] = Temp[0]; Ptr[1] = Temp[1]; Ptr[2] = Temp[2];
+    }
+
+    inline FGASVectorRegister VectorAdd(FGASVectorRegister A, FGASVectorRegister B) { return _mm_add_ps(A, B); }
+    inline FGASVectorRegister VectorSubtract(FGASVectorRegister A, FGASVectorRegister B) { return _mm_sub_ps(A, B); }
+    inline FGASVectorRegister VectorMultiply(FGASVectorRegister A, FGASVectorRegister B) { return _mm_mul_ps(A, B); }
+    inline FGASVectorRegister VectorMultiplyAdd(FGASVectorRegister A, FGASVectorRegister B, FGASVectorRegister C) { return _mm_add_ps(_mm_mul_ps(A, B), C); }
+    inline FGASVectorRegister VectorDivide(FGASVectorRegister A, FGASVectorRegister B) { return _mm_div_ps(A, B); }
+    inline FGASVectorRegister VectorSqrt(FGASVectorRegister V) { return _mm_sqrt_ps(V); }
+    inline FGASVectorRegister VectorMax(FGASVectorRegister A, FGASVectorRegister B) { return _mm_max_ps(A, B); }
+
+    // S 为负的通道翻转 V 的符号
+    inline FGASVectorRegister VectorMultiplySign(FGASVectorRegister V, FGASVectorRegister S) { return _mm_xor_ps(V, _mm_and_ps(S, _mm_set1_ps(-0.0f))); }
+
+    inline FGASVectorRegister VectorClearW(FGASVectorRegister V) { return _mm_and_ps(V, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1))); }
+
+    // (V[X], V[Y], V[Z], V[W])
+    template<int X, int Y, int Z, int W>
+    inline FGASVectorRegister VectorSwizzle(FGASVectorRegister V) { return _mm_shuffle_ps(V, V, _MM_SHUFFLE(W, Z, Y, X)); }
+
+    // (A[X], A[Y], B[Z], B[W])
+    template<int X, int Y, int Z, int W>
+    inline FGASVectorRegister VectorShuffle(FGASVectorRegister A, FGASVectorRegister B) { return _mm_shuffle_ps(A, B, _MM_SHUFFLE(W, Z, Y, X)); }
+
+    template<int Lane>
+    inline float VectorGetComponent(FGASVectorRegister V) { return _mm_cvtss_f32(_mm_shuffle_ps(V, V, _MM_SHUFFLE(Lane, Lane, Lane, Lane))); }
+
+    inline void VectorTranspose4(FGASVectorRegister& A, FGASVectorRegister& B, FGASVectorRegister& C, FGASVectorRegister& D) { _MM_TRANSPOSE4_PS(A, B, C, D); }
+#else
+    inline FGASVectorRegister VectorSet(float X, float Y, float Z, float W) { return { { X, Y, Z, W } }; }
+    inline FGASVectorRegister VectorZero() { return VectorSet(0.0f, 0.0f, 0.0f, 0.0f); }
+    inline FGASVectorRegister VectorSplat(float S) { return VectorSet(S, S, S, S); }
+
+    inline FGASVectorRegister VectorLoad(const float* Ptr) { return VectorSet(Ptr[0], Ptr[1], Ptr[2], Ptr[3]); }
+    inline FGASVectorRegister VectorLoadAligned(const float* Ptr) { return VectorLoad(Ptr); }
+    inline FGASVectorRegister VectorLoadFloat3(const float* Ptr) { return VectorSet(Ptr[0], Ptr[1], Ptr[2], 0.0f); }
+    inline void VectorStore(float* Ptr, FGASVectorRegister V) { for (int i = 0; i < 4; ++i) Ptr[i] = V.V[i]; }
+    inline void VectorStoreAligned(float* Ptr, FGASVectorRegister V) { VectorStore(Ptr, V); }
+    inline void VectorStoreFloat3(float* Ptr, FGASVectorRegister V) { for (int i = 0; i < 3; ++i) Ptr[i] = V.V[i]; }
+
+    template<typename FuncType>
+    inline FGASVectorRegister VectorMap(FGASVectorRegister A, FGASVectorRegister B, FuncType&& Func)
+    {
+        FGASVectorRegister R;
+        for (int i = 0; i < 4; ++i) R.V[i] = Func(A.V[i], B.V[i]);
+        return R;
+    }
+
+    inline FGASVectorRegister VectorAdd(FGASVectorRegister A, FGASVectorRegister B) { return VectorMap(A, B, [](float a, float b) { return a + b; }); }
+    inline FGASVectorRegister VectorSubtract(FGASVectorRegister A, FGASVectorRegister B) { return VectorMap(A, B, [](float a, float b) { return a - b; }); }
+    inline FGASVectorRegister VectorMultiply(FGASVectorRegister A, FGASVectorRegister B) { return VectorMap(A, B, [](float a, float b) { return a * b; }); }
+    inline FGASVectorRegister VectorMultiplyAdd(FGASVectorRegister A, FGASVectorRegister B, FGASVectorRegister C) { return VectorAdd(VectorMultiply(A, B), C); }
+    inline FGASVectorRegister VectorDivide(FGASVectorRegister A, FGASVectorRegister B) { return VectorMap(A, B, [](float a, float b) { return a / b; }); }
+    inline FGASVectorRegister VectorSqrt(FGASVectorRegister V) { return VectorMap(V, V, [](float a, float) { return std::sqrt(a); }); }
+    inline FGASVectorRegister VectorMax(FGASVectorRegister A, FGASVectorRegister B) { return VectorMap(A, B, [](float a, float b) { return a > b ? a : b; }); }
+    inline FGASVectorRegister VectorMultiplySign(FGASVectorRegister V, FGASVectorRegister S) { return VectorMap(V, S, [](float a, float b) { return std::signbit(b) ? -a : a; }); }
+    inline FGASVectorRegister VectorClearW(FGASVectorRegister V) { V.V[3] = 0.0f; return V; }
+
+    template<int X, int Y, int Z, int W>
+    inline FGASVectorRegister VectorSwizzle(FGASVectorRegister V) { return VectorSet(V.V[X], V.V[Y], V.V[Z], V.V[W]); }
+
+    template<int X, int Y, int Z, int W>
+    inline FGASVectorRegister VectorShuffle(FGASVectorRegister A, FGASVectorRegister B) { return VectorSet(A.V[X], A.V[Y], B.V[Z], B.V[W]); }
+
+    template<int Lane>
+    inline float VectorGetComponent(FGASVectorRegister V) { return V.V[Lane]; }
+
+    inline void VectorTranspose4(FGASVectorRegister& A, FGASVectorRegister& B, FGASVectorRegister& C, FGASVectorRegister& D)
+    {
+        FGASVectorRegister* Rows[4] = { &A, &B, &C, &D };
+        for (int r = 0; r < 4; ++r) for (int c = r + 1; c < 4; ++c) std::swap(Rows[r]->V[c], Rows[c]->V[r]);
+    }
+#endif
+
+    template<int Lane>
+    inline FGASVectorRegister VectorReplicate(FGASVectorRegister V) { return VectorSwizzle<Lane, Lane, Lane, Lane>(V); }
+
+    // 四个通道都得到点积
+    inline FGASVectorRegister VectorDot4(FGASVectorRegister A, FGASVectorRegister B)
+    {
+        FGASVectorRegister M = VectorMultiply(A, B);
+        M = VectorAdd(M, VectorSwizzle<1, 0, 3, 2>(M));
+        return VectorAdd(M, VectorSwizzle<2, 3, 0, 1>(M));
+    }
+
+    inline FGASVectorRegister VectorDot3(FGASVectorRegister A, FGASVectorRegister B) { return VectorDot4(VectorClearW(A), B); }
+
+    inline FGASVectorRegister VectorCross(FGASVectorRegister A, FGASVectorRegister B)
+    {
+        return VectorSubtract(VectorMultiply(VectorSwizzle<1, 2, 0, 3>(A), VectorSwizzle<2, 0, 1, 3>(B)),
+            VectorMultiply(VectorSwizzle<2, 0, 1, 3>(A), VectorSwizzle<1, 2, 0, 3>(B)));
+    }
+
+    // 2. 存储格式的载入/写回
+
+    inline FGASVectorRegister LoadVector3(const FGASVector3& V) { return VectorLoadFloat3(&V.X); }
+    inline void StoreVector3(FGASVector3& Out, FGASVectorRegister V) { VectorStoreFloat3(&Out.X, V); }
+    inline FGASVectorRegister LoadQuat(const FGASQuaternion& Q) { return VectorLoad(&Q.X); }
+    inline void StoreQuat(FGASQuaternion& Out, FGASVectorRegister V) { VectorStore(&Out.X, V); }
+
+    // FGASMatrix4x4 按行存放 (列向量布局)，载入时转置成列
+    inline FGASAffineRegister LoadAffine(const FGASMatrix4x4& M)
+    {
+        FGASAffineRegister R;
+        R.Columns[0] = VectorLoad(M.M[0]);
+        R.Columns[1] = VectorLoad(M.M[1]);
+        R.Columns[2] = VectorLoad(M.M[2]);
+        R.Columns[3] = VectorZero();
+        VectorTranspose4(R.Columns[0], R.Columns[1], R.Columns[2], R.Columns[3]);
+        return R;
+    }
+
+    inline void StoreAffine(FGASMatrix4x4& Out, const FGASAffineRegister& A)
+    {
+        FGASVectorRegister R0 = A.Columns[0], R1 = A.Columns[1], R2 = A.Columns[2], R3 = A.Columns[3];
+        VectorTranspose4(R0, R1, R2, R3);
+        VectorStore(Out.M[0], R0);
+        VectorStore(Out.M[1], R1);
+        VectorStore(Out.M[2], R2);
+        VectorStore(Out.M[3], VectorSet(0.0f, 0.0f, 0.0f, 1.0f));
+    }
+
+    // FGASMatrix3x4 (骨骼/蒙皮矩阵) 同样按行存放，只有 3 行
+    inline FGASAffineRegister LoadAffine(const FGASMatrix3x4& M)
+    {
+        FGASAffineRegister R;
+        R.Columns[0] = VectorLoad(M.M[0]);
+        R.Columns[1] = VectorLoad(M.M[1]);
+        R.Columns[2] = VectorLoad(M.M[2]);
+        R.Columns[3] = VectorZero();
+        VectorTranspose4(R.Columns[0], R.Columns[1], R.Columns[2], R.Columns[3]);
+        return R;
+    }
+
+    inline void StoreAffine(FGASMatrix3x4& Out, const FGASAffineRegister& A)
+    {
+        FGASVectorRegister R0 = A.Columns[0], R1 = A.Columns[1], R2 = A.Columns[2], R3 = A.Columns[3];
+        VectorTranspose4(R0, R1, R2, R3);
+        VectorStore(Out.M[0], R0);
+        VectorStore(Out.M[1], R1);
+        VectorStore(Out.M[2], R2);
+    }
+
+    // 3. 四元数 (布局 XYZW)
+
+    // A * B (与 GASMath::Multiply 一致)
+    inline FGASVectorRegister QuatMultiply(FGASVectorRegister A, FGASVectorRegister B)
+    {
+        const FGASVectorRegister SignX = VectorSet(1.0f, -1.0f, 1.0f, -1.0f);
+        const FGASVectorRegister SignY = VectorSet(1.0f, 1.0f, -1.0f, -1.0f);
+        const FGASVectorRegister SignZ = VectorSet(-1.0f, 1.0f, 1.0f, -1.0f);
+
+        FGASVectorRegister R = VectorMultiply(VectorReplicate<3>(A), B);
+        R = VectorMultiplyAdd(VectorMultiply(VectorReplicate<0>(A), VectorSwizzle<3, 2, 1, 0>(B)), SignX, R);
+        R = VectorMultiplyAdd(VectorMultiply(VectorReplicate<1>(A), VectorSwizzle<2, 3, 0, 1>(B)), SignY, R);
+        R = VectorMultiplyAdd(VectorMultiply(VectorReplicate<2>(A), VectorSwizzle<1, 0, 3, 2>(B)), SignZ, R);
+        return R;
+    }
+
+    // 调用方保证 Q 非零
+    inline FGASVectorRegister QuatNormalize(FGASVectorRegister Q)
+    {
+        return VectorDivide(Q, VectorSqrt(VectorDot4(Q, Q)));
+    }
+
+    // 最短路径 nlerp：点积为负时翻转 B
+    inline FGASVectorRegister QuatNlerp(FGASVectorRegister A, FGASVectorRegister B, float Alpha)
+    {
+        const FGASVectorRegister BAligned = VectorMultiplySign(B, VectorDot4(A, B));
+        return QuatNormalize(VectorMultiplyAdd(A, VectorSplat(1.0f - Alpha), VectorMultiply(BAligned, VectorSplat(Alpha))));
+    }
+
+    // 4. 仿射矩阵
+
+    inline FGASAffineRegister AffineIdentity()
+    {
+        FGASAffineRegister R;
+        R.Columns[0] = VectorSet(1.0f, 0.0f, 0.0f, 0.0f);
+        R.Columns[1] = VectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+        R.Columns[2] = VectorSet(0.0f, 0.0f, 1.0f, 0.0f);
+        R.Columns[3] = VectorZero();
+        return R;
+    }
+
+    // TRS 合成 (同 GASMath::ComposeTransform)，T / S 的 W 分量须为 0
+    inline FGASAffineRegister AffineCompose(FGASVectorRegister T, FGASVectorRegister Q, FGASVectorRegister S)
+    {
+        const FGASVectorRegister Q2 = VectorAdd(Q, Q);
+        FGASAffineRegister R;
+        R.Columns[0] = VectorMultiplyAdd(VectorMultiply(VectorSwizzle<1, 0, 0, 3>(Q), VectorSwizzle<1, 1, 2, 3>(Q2)), VectorSet(-1.0f, 1.0f, 1.0f, 0.0f),
+            VectorMultiplyAdd(VectorMultiply(VectorSwizzle<2, 3, 3, 3>(Q), VectorSwizzle<2, 2, 1, 3>(Q2)), VectorSet(-1.0f, 1.0f, -1.0f, 0.0f), VectorSet(1.0f, 0.0f, 0.0f, 0.0f)));
+        R.Columns[1] = VectorMultiplyAdd(VectorMultiply(VectorSwizzle<0, 0, 1, 3>(Q), VectorSwizzle<1, 0, 2, 3>(Q2)), VectorSet(1.0f, -1.0f, 1.0f, 0.0f),
+            VectorMultiplyAdd(VectorMultiply(VectorSwizzle<3, 2, 3, 3>(Q), VectorSwizzle<2, 2, 0, 3>(Q2)), VectorSet(-1.0f, -1.0f, 1.0f, 0.0f), VectorSet(0.0f, 1.0f, 0.0f, 0.0f)));
+        R.Columns[2] = VectorMultiplyAdd(VectorMultiply(VectorSwizzle<0, 1, 0, 3>(Q), VectorSwizzle<2, 2, 0, 3>(Q2)), VectorSet(1.0f, 1.0f, -1.0f, 0.0f),
+            VectorMultiplyAdd(VectorMultiply(VectorSwizzle<3, 3, 1, 3>(Q), VectorSwizzle<1, 0, 1, 3>(Q2)), VectorSet(1.0f, -1.0f, -1.0f, 0.0f), VectorSet(0.0f, 0.0f, 1.0f, 0.0f)));
+
+        R.Columns[0] = VectorMultiply(R.Columns[0], VectorReplicate<0>(S));
+        R.Columns[1] = VectorMultiply(R.Columns[1], VectorReplicate<1>(S));
+        R.Columns[2] = VectorMultiply(R.Columns[2], VectorReplicate<2>(S));
+        R.Columns[3] = T;
+        return R;
+    }
+
+    inline FGASAffineRegister AffineCompose(const FGASTransform& T)
+    {
+        return AffineCompose(LoadVector3(T.Translation), LoadQuat(T.Rotation), LoadVector3(T.Scale));
+    }
+
+    // A * B
+    inline FGASAffineRegister AffineMultiply(const FGASAffineRegister& A, const FGASAffineRegister& B)
+    {
+        FGASAffineRegister R;
+        for (int c = 0; c < 4; ++c)
+        {
+            const FGASVectorRegister Col = B.Columns[c];
+            FGASVectorRegister Sum = VectorMultiply(A.Columns[0], VectorReplicate<0>(Col));
+            Sum = VectorMultiplyAdd(A.Columns[1], VectorReplicate<1>(Col), Sum);
+            R.Columns[c] = VectorMultiplyAdd(A.Columns[2], VectorReplicate<2>(Col), Sum);
+        }
+        R.Columns[3] = VectorAdd(R.Columns[3], A.Columns[3]);
+        return R;
+    }
+
+    // 仿射求逆：3x3 部分用伴随矩阵 (三个叉积) 求逆，平移取 -inv(L) * T；奇异时返回单位矩阵 (同 GASMath::Inverse)
+    inline FGASAffineRegister AffineInverse(const FGASAffineRegister& M)
+    {
+        FGASVectorRegister R0 = VectorCross(M.Columns[1], M.Columns[2]);
+        FGASVectorRegister R1 = VectorCross(M.Columns[2], M.Columns[0]);
+        FGASVectorRegister R2 = VectorCross(M.Columns[0], M.Columns[1]);
+        const FGASVectorRegister Det = VectorDot3(M.Columns[0], R0);
+        if (std::abs(VectorGetComponent<0>(Det)) < GASMath::SMALL_NUMBER) return AffineIdentity();
+
+        FGASVectorRegister R3 = VectorZero();
+        VectorTranspose4(R0, R1, R2, R3);
+
+        FGASAffineRegister R;
+        const FGASVectorRegister InvDet = VectorDivide(VectorSplat(1.0f), Det);
+        R.Columns[0] = VectorMultiply(R0, InvDet);
+        R.Columns[1] = VectorMultiply(R1, InvDet);
+        R.Columns[2] = VectorMultiply(R2, InvDet);
+
+        const FGASVectorRegister T = M.Columns[3];
+        FGASVectorRegister Sum = VectorMultiply(R.Columns[0], VectorReplicate<0>(T));
+        Sum = VectorMultiplyAdd(R.Columns[1], VectorReplicate<1>(T), Sum);
+        Sum = VectorMultiplyAdd(R.Columns[2], VectorReplicate<2>(T), Sum);
+        R.Columns[3] = VectorSubtract(VectorZero(), Sum);
+        return R;
+    }
+
+    // M * (P, 1)
+    inline FGASVectorRegister AffineTransformPosition(const FGASAffineRegister& M, FGASVectorRegister P)
+    {
+        FGASVectorRegister Sum = VectorMultiplyAdd(M.Columns[0], VectorReplicate<0>(P), M.Columns[3]);
+        Sum = VectorMultiplyAdd(M.Columns[1], VectorReplicate<1>(P), Sum);
+        return VectorMultiplyAdd(M.Columns[2], VectorReplicate<2>(P), Sum);
+    }
+
+    // 提取旋转 (先按列去除缩放)，分支选择与 GASMath::ToQuaternion 相同，结果一致 (仅舍入误差)
+    inline FGASVectorRegister AffineToQuat(const FGASAffineRegister& M)
+    {
+        const FGASVectorRegister Tiny = VectorSplat(GASMath::SMALL_NUMBER);
+        const FGASVectorRegister C0 = VectorDivide(M.Columns[0], VectorMax(VectorSqrt(VectorDot3(M.Columns[0], M.Columns[0])), Tiny));
+        const FGASVectorRegister C1 = VectorDivide(M.Columns[1], VectorMax(VectorSqrt(VectorDot3(M.Columns[1], M.Columns[1])), Tiny));
+        const FGASVectorRegister C2 = VectorDivide(M.Columns[2], VectorMax(VectorSqrt(VectorDot3(M.Columns[2], M.Columns[2])), Tiny));
+
+        // 4 * (x², y², z², w²) = 1 ± m00 ± m11 ± m22
+        FGASVectorRegister Squares = VectorMultiplyAdd(VectorReplicate<0>(C0), VectorSet(1.0f, -1.0f, -1.0f, 1.0f), VectorSplat(1.0f));
+        Squares = VectorMultiplyAdd(VectorReplicate<1>(C1), VectorSet(-1.0f, 1.0f, -1.0f, 1.0f), Squares);
+        Squares = VectorMultiplyAdd(VectorReplicate<2>(C2), VectorSet(-1.0f, -1.0f, 1.0f, 1.0f), Squares);
+
+        // A = (m21, m02, m10)，B = (m12, m20, m01)
+        const FGASVectorRegister A = VectorShuffle<0, 2, 1, 1>(VectorShuffle<2, 2, 0, 0>(C1, C2), C0);
+        const FGASVectorRegister B = VectorShuffle<0, 2, 0, 0>(VectorShuffle<1, 1, 2, 2>(C2, C0), C1);
+
+        alignas(16) float Sq[4], Sum[4], Diff[4];
+        VectorStoreAligned(Sq, Squares);
+        VectorStoreAligned(Sum, VectorAdd(A, B));
+        VectorStoreAligned(Diff, VectorSubtract(A, B));
+
+        const float M00 = VectorGetComponent<0>(C0), M11 = VectorGetComponent<1>(C1), M22 = VectorGetComponent<2>(C2);
+        int32_t Largest;
+        if (M00 + M11 + M22 > 0.0f) Largest = 3;
+        else if (M00 > M11 && M00 > M22) Largest = 0;
+        else if (M11 > M22) Largest = 1;
+        else Largest = 2;
+
+        // 最大分量取正，其余由对称/反对称项除以它得到
+        FGASVectorRegister P;
+        switch (Largest)
+        {
+        case 0: P = VectorSet(Sq[0], Sum[2], Sum[1], Diff[0]); break;
+        case 1: P = VectorSet(Sum[2], Sq[1], Sum[0], Diff[1]); break;
+        case 2: P = VectorSet(Sum[1], Sum[0], Sq[2], Diff[2]); break;
+        default: P = VectorSet(Diff[0], Diff[1], Diff[2], Sq[3]); break;
+        }
+        return QuatNormalize(VectorMultiply(P, VectorSplat(0.5f / std::sqrt(Sq[Largest]))));
+    }
+
+    // 5. 批量接口 (数组连续存放，Out 可与输入相同)
+    // 四元数按 4 个一组转成 SoA 计算，余数逐个处理
+
+    void QuatMultiplyBatch(const FGASQuaternion* A, const FGASQuaternion* B, int32_t Count, FGASQuaternion* Out);
+    void QuatNlerpBatch(const FGASQuaternion* A, const FGASQuaternion* B, float Alpha, int32_t Count, FGASQuaternion* Out);
+    void ComposeTransformBatch(const FGASTransform* Transforms, int32_t Count, FGASMatrix4x4* Out);
+    void AffineMultiplyBatch(const FGASMatrix4x4* A, const FGASMatrix4x4* B, int32_t Count, FGASMatrix4x4* Out);
+    void AffineInverseBatch(const FGASMatrix4x4* Matrices, int32_t Count, FGASMatrix4x4* Out);
+    void ToQuaternionBatch(const FGASMatrix4x4* Matrices, int32_t Count, FGASQuaternion* Out);
+}
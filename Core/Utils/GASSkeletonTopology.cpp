@@ -0,0 +1,212 @@
+﻿#include "GASSkeletonTopology.h"
+#include <algorithm>
+#include "GASLogging.h"
+#include "GASMath.h"
+#include "GASVertexCompression.h"
+
+bool GASSkeletonTopology::BuildDepthOrder(const GASSkeleton* Skeleton, std::vector<int32_t>& OutOldToNew)
+{
+    if (!Skeleton) return false;
+
+    const int32_t NumBones = Skeleton->GetNumBones();
+    std::vector<std::vector<int32_t>> Children(NumBones);
+    std::vector<int32_t> Order;
+    Order.reserve(NumBones);
+
+    for (int32_t b = 0; b < NumBones; ++b)
+    {
+        const int32_t Parent = Skeleton->GetParentIndex(b);
+        if (Parent < 0) Order.push_back(b);
+        else if (Parent < NumBones && Parent != b) Children[Parent].push_back(b);
+        else
+        {
+            GAS_LOG_ERROR("BuildDepthOrder: Bone %d has invalid parent %d", b, Parent);
+            return false;
+        }
+    }
+
+    // 广度优先：Order 本身就是队列
+    for (size_t Head = 0; Head < Order.size(); ++Head)
+    {
+        for (int32_t Child : Children[Order[Head]]) Order.push_back(Child);
+    }
+    if ((int32_t)Order.size() != NumBones)
+    {
+        GAS_LOG_ERROR("BuildDepthOrder: Skeleton hierarchy contains a cycle");
+        return false;
+    }
+
+    OutOldToNew.assign(NumBones, -1);
+    for (int32_t New = 0; New < NumBones; ++New) OutOldToNew[Order[New]] = New;
+    return true;
+}
+
+bool GASSkeletonTopology::SortByDepth(GASSkeleton* Skeleton, std::vector<int32_t>* OutOldToNew)
+{
+    std::vector<int32_t> OldToNew;
+    if (!BuildDepthOrder(Skeleton, OldToNew)) return false;
+
+    const int32_t NumBones = Skeleton->GetNumBones();
+    GASArray<FGASBoneDefinition> Sorted;
+    Sorted.Resize(NumBones);
+    for (int32_t Old = 0; Old < NumBones; ++Old)
+    {
+        FGASBoneDefinition Bone = Skeleton->Bones[Old];
+        if (Bone.ParentIndex >= 0) Bone.ParentIndex = OldToNew[Bone.ParentIndex];
+        Sorted[OldToNew[Old]] = Bone;
+    }
+    Skeleton->Bones = Sorted;
+    Skeleton->RebuildBoneMap();
+
+    UpdateLevels(Skeleton);
+
+    if (OutOldToNew) *OutOldToNew = std::move(OldToNew);
+    return true;
+}
+
+bool GASSkeletonTopology::UpdateLevels(GASSkeleton* Skeleton)
+{
+    if (!Skeleton) return false;
+
+    FGASSkeletonHeader& Header = Skeleton->SkeletonHeader;
+    Header.NumLevels = 0;
+    std::fill(std::begin(Header.LevelOffsets), std::end(Header.LevelOffsets), (uint16_t)0);
+
+    const int32_t NumBones = Skeleton->GetNumBones();
+    if (NumBones == 0 || NumBones > 0xFFFF) return false;
+
+    // 深度须单调不减，且父骨骼位于前面
+    std::vector<int32_t> Depth(NumBones, 0);
+    int32_t NumLevels = 1;
+    for (int32_t b = 0; b < NumBones; ++b)
+    {
+        const int32_t Parent = Skeleton->GetParentIndex(b);
+        if (Parent >= b) return false;
+        Depth[b] = (Parent >= 0) ? Depth[Parent] + 1 : 0;
+        if (b > 0 && Depth[b] < Depth[b - 1]) return false;
+        NumLevels = std::max(NumLevels, Depth[b] + 1);
+    }
+    if (NumLevels > GAS_MAX_SKELETON_LEVELS)
+    {
+        GAS_LOG_WARN("UpdateLevels: %d levels exceed the header limit %d, levels not stored", NumLevels, GAS_MAX_SKELETON_LEVELS);
+        return false;
+    }
+
+    for (int32_t b = NumBones - 1; b >= 0; --b) Header.LevelOffsets[Depth[b]] = (uint16_t)b;
+    Header.LevelOffsets[NumLevels] = (uint16_t)NumBones;
+    Header.NumLevels = (uint16_t)NumLevels;
+    return true;
+}
+
+bool GASSkeletonTopology::ComputeBindPose(const GASSkeleton* Skeleton, std::vector<FGASTransform>& OutLocalPose)
+{
+    if (!Skeleton) return false;
+
+    const int32_t NumBones = Skeleton->GetNumBones();
+    std::vector<FGASMatrix3x4> Global(NumBones);
+    OutLocalPose.resize(NumBones);
+    for (int32_t b = 0; b < NumBones; ++b)
+    {
+        const int32_t Parent = Skeleton->GetParentIndex(b);
+        if (Parent >= b)
+        {
+            GAS_LOG_ERROR("ComputeBindPose: Skeleton is not parent-first (bone %d)", b);
+            return false;
+        }
+
+        // 逆绑定矩阵求逆即全局绑定矩阵
+        Global[b] = GASMath::Inverse(Skeleton->GetInverseBindMatrix(b));
+        OutLocalPose[b] = GASMath::ToTransform(Parent >= 0 ? GASMath::Multiply(GASMath::Inverse(Global[Parent]), Global[b]) : Global[b]);
+    }
+    return true;
+}
+
+bool GASSkeletonTopology::RemapAnimation(GASAnimation* Animation, const std::vector<int32_t>& OldToNew)
+{
+    if (!Animation) return false;
+
+    const int32_t TrackCount = (int32_t)Animation->AnimHeader.TrackCount;
+    if (TrackCount != (int32_t)OldToNew.size())
+    {
+        GAS_LOG_ERROR("RemapAnimation: Track count %d does not match remap size %d", TrackCount, (int32_t)OldToNew.size());
+        return false;
+    }
+
+    GASArray<FGASAnimTrackData> Remapped;
+    Remapped.Resize(Animation->Tracks.Num());
+    const int32_t NumFrames = Animation->GetNumFrames();
+    for (int32_t f = 0; f < NumFrames; ++f)
+    {
+        const int32_t Base = f * TrackCount;
+        for (int32_t Old = 0; Old < TrackCount; ++Old)
+        {
+            Remapped[Base + OldToNew[Old]] = Animation->Tracks[Base + Old];
+        }
+    }
+    Animation->Tracks = Remapped;
+    return true;
+}
+
+bool GASSkeletonTopology::RemapMesh(GASMesh* Mesh, const std::vector<int32_t>& OldToNew)
+{
+    if (!Mesh) return false;
+
+    const uint32_t NumBones = (uint32_t)OldToNew.size();
+    const bool bHasCompact = Mesh->HasCompactVertices();
+    const bool bStripped = bHasCompact && Mesh->Vertices.Num() == 0;
+
+    // 完整顶点已剥离时先解码，重映射后重新编码再剥离
+    if (bStripped)
+    {
+        const int32_t NumVertices = Mesh->GetNumVertices();
+        Mesh->Vertices.Resize(NumVertices);
+        for (int32_t v = 0; v < NumVertices; ++v) GASVertexCompression::DecodeVertex(Mesh, v, Mesh->Vertices[v]);
+        Mesh->BaseHeader.DataSize += (uint32_t)Mesh->Vertices.GetTotalSizeInBytes();
+    }
+
+    for (FGASSkinVertex& Vertex : Mesh->Vertices)
+    {
+        for (int32_t j = 0; j < MAX_BONE_INFLUENCES; ++j)
+        {
+            uint32_t& Bone = Vertex.BoneIndices.Indices[j];
+            if (Bone < NumBones) Bone = (uint32_t)OldToNew[Bone];
+            else if (Vertex.BoneWeights.Weights[j] > 0.0f)
+            {
+                GAS_LOG_ERROR("RemapMesh: Bone index %u out of range (%u bones)", Bone, NumBones);
+                return false;
+            }
+        }
+    }
+
+    if (bHasCompact)
+    {
+        Mesh->BaseHeader.DataSize -= (uint32_t)(sizeof(FGASCompactVertexHeader) + Mesh->CompactPositions.GetTotalSizeInBytes()
+            + Mesh->CompactShading.GetTotalSizeInBytes() + Mesh->CompactSkin.GetTotalSizeInBytes());
+        if (!GASVertexCompression::BuildCompactStreams(Mesh)) return false;
+        if (bStripped) GASVertexCompression::StripFullVertices(Mesh);
+    }
+
+    // Meshlet 骨骼集合保持升序
+    for (const FGASMeshlet& Meshlet : Mesh->Meshlets)
+    {
+        uint16_t* Bones = Mesh->MeshletBones.GetData() + Meshlet.BoneOffset;
+        for (uint32_t i = 0; i < Meshlet.BoneCount; ++i)
+        {
+            if (Bones[i] < NumBones) Bones[i] = (uint16_t)OldToNew[Bones[i]];
+        }
+        std::sort(Bones, Bones + Meshlet.BoneCount);
+    }
+
+    // 骨骼 LOD 表按新顺序排列
+    if (Mesh->BoneLODTable.Num() > 0)
+    {
+        GASArray<uint8_t> Table;
+        Table.Resize((int32_t)NumBones);
+        for (uint32_t Old = 0; Old < NumBones && Old < (uint32_t)Mesh->BoneLODTable.Num(); ++Old)
+        {
+            Table[OldToNew[Old]] = Mesh->BoneLODTable[(int32_t)Old];
+        }
+        Mesh->BoneLODTable = Table;
+    }
+    return true;
+}
@@ -0,0 +1,29 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+#include "../Types/GASAsset.h"
+
+// 骨骼拓扑整理：按深度分层重排骨骼 (父先子后、同层连续)，并把重排映射应用到动画与网格
+// 映射约定：OldToNew[旧骨骼序号] = 新骨骼序号
+class GASSkeletonTopology
+{
+public:
+    // 计算分层顺序 (广度优先：按层输出，同层内按父骨骼顺序、同父按原顺序)
+    static bool BuildDepthOrder(const GASSkeleton* Skeleton, std::vector<int32_t>& OutOldToNew);
+
+    // 按层重排骨骼 (逆绑定矩阵随骨骼定义一起移动) 并写入层偏移，OutOldToNew 可为空
+    static bool SortByDepth(GASSkeleton* Skeleton, std::vector<int32_t>* OutOldToNew = nullptr);
+
+    // 由父子关系计算层偏移写入 SkeletonHeader，骨骼未按层排列或层数超出上限时 NumLevels 置 0 并返回 false
+    static bool UpdateLevels(GASSkeleton* Skeleton);
+
+    // 由逆绑定矩阵求局部绑定姿态 (FGASBoneDefinition::LocalBindPose 不随文件保存)，骨骼须父先子后
+    // 没有蒙皮权重的骨骼逆绑定矩阵为单位阵，其绑定姿态只能近似
+    static bool ComputeBindPose(const GASSkeleton* Skeleton, std::vector<FGASTransform>& OutLocalPose);
+
+    // 重排动画轨道 (每帧按新骨骼顺序)
+    static bool RemapAnimation(GASAnimation* Animation, const std::vector<int32_t>& OldToNew);
+
+    // 重映射网格的骨骼引用：顶点骨骼索引、紧凑蒙皮流、Meshlet 骨骼集合、骨骼 LOD 表
+    static bool RemapMesh(GASMesh* Mesh, const std::vector<int32_t>& OldToNew);
+};
@@ -0,0 +1,339 @@
+﻿#include "GASVertexCompression.h"
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include "GASMath.h"
+#include "GASLogging.h"
+
+// 标量编码
+
+uint16_t GASVertexCompression::FloatToHalf(float Value)
+{
+    uint32_t Bits;
+    std::memcpy(&Bits, &Value, sizeof(Bits));
+
+    const uint32_t Sign = (Bits >> 16) & 0x8000u;
+    const uint32_t Abs = Bits & 0x7fffffffu;
+
+    // NaN / Inf
+    if (Abs >= 0x7f800000u)
+    {
+        return (uint16_t)(Sign | 0x7c00u | ((Abs > 0x7f800000u) ? 0x200u : 0u));
+    }
+
+    int32_t Exponent = (int32_t)(Abs >> 23) - 127 + 15;
+    uint32_t Mantissa = Abs & 0x7fffffu;
+
+    // 溢出 -> Inf
+    if (Exponent >= 31)
+    {
+        return (uint16_t)(Sign | 0x7c00u);
+    }
+
+    // 次正规数 / 下溢
+    if (Exponent <= 0)
+    {
+        if (Exponent < -10) return (uint16_t)Sign;
+
+        Mantissa |= 0x800000u;
+        uint32_t Shift = (uint32_t)(14 - Exponent);
+        uint32_t Half = Mantissa >> Shift;
+        if ((Mantissa >> (Shift - 1)) & 1u) ++Half;
+        return (uint16_t)(Sign | Half);
+    }
+
+    uint32_t Half = ((uint32_t)Exponent << 10) | (Mantissa >> 13);
+    // 舍入 (进位可自然溢出到指数位)
+    if (Mantissa & 0x1000u) ++Half;
+    return (uint16_t)(Sign | Half);
+}
+
+float GASVertexCompression::HalfToFloat(uint16_t Value)
+{
+    const uint32_t Sign = ((uint32_t)Value & 0x8000u) << 16;
+    const uint32_t Exponent = ((uint32_t)Value >> 10) & 0x1fu;
+    const uint32_t Mantissa = (uint32_t)Value & 0x3ffu;
+
+    uint32_t Bits;
+    if (Exponent == 0)
+    {
+        // 零或次正规数
+        float Result = (float)Mantissa * (1.0f / 16777216.0f);
+        return Sign ? -Result : Result;
+    }
+    else if (Exponent == 31)
+    {
+        Bits = Sign | 0x7f800000u | (Mantissa << 13);
+    }
+    else
+    {
+        Bits = Sign | ((Exponent - 15 + 127) << 23) | (Mantissa << 13);
+    }
+
+    float Result;
+    std::memcpy(&Result, &Bits, sizeof(Result));
+    return Result;
+}
+
+static inline float SignNotZero(float V) { return (V >= 0.0f) ? 1.0f : -1.0f; }
+
+static inline int16_t ToSnorm16(float V)
+{
+    V = std::max(-1.0f, std::min(1.0f, V));
+    return (int16_t)std::lround(V * 32767.0f);
+}
+
+void GASVertexCompression::EncodeOctahedral(const FGASVector3& Dir, int16_t OutOct[2])
+{
+    float L1 = std::abs(Dir.X) + std::abs(Dir.Y) + std::abs(Dir.Z);
+    if (L1 < GASMath::SMALL_NUMBER)
+    {
+        OutOct[0] = 0;
+        OutOct[1] = 0;
+        return;
+    }
+
+    float U = Dir.X / L1;
+    float V = Dir.Y / L1;
+    if (Dir.Z < 0.0f)
+    {
+        float FoldU = (1.0f - std::abs(V)) * SignNotZero(U);
+        float FoldV = (1.0f - std::abs(U)) * SignNotZero(V);
+        U = FoldU;
+        V = FoldV;
+    }
+
+    OutOct[0] = ToSnorm16(U);
+    OutOct[1] = ToSnorm16(V);
+}
+
+FGASVector3 GASVertexCompression::DecodeOctahedral(const int16_t InOct[2])
+{
+    float U = std::max(-1.0f, InOct[0] / 32767.0f);
+    float V = std::max(-1.0f, InOct[1] / 32767.0f);
+
+    FGASVector3 Dir(U, V, 1.0f - std::abs(U) - std::abs(V));
+    if (Dir.Z < 0.0f)
+    {
+        Dir.X = (1.0f - std::abs(V)) * SignNotZero(U);
+        Dir.Y = (1.0f - std::abs(U)) * SignNotZero(V);
+    }
+    return GASMath::Normalize(Dir);
+}
+
+void GASVertexCompression::QuantizeWeights(const float* Weights, int32_t Count, uint8_t* OutWeights)
+{
+    float Total = 0.0f;
+    for (int32_t i = 0; i < Count; ++i) Total += std::max(0.0f, Weights[i]);
+
+    if (Total <= 0.0f)
+    {
+        std::memset(OutWeights, 0, Count);
+        return;
+    }
+
+    // 先向下取整，再把剩余的量分配给小数部分最大的影响
+    float Remainders[MAX_BONE_INFLUENCES] = { 0.0f };
+    int32_t Sum = 0;
+    for (int32_t i = 0; i < Count; ++i)
+    {
+        float Scaled = std::max(0.0f, Weights[i]) / Total * 255.0f;
+        int32_t Floor = (int32_t)std::floor(Scaled);
+        OutWeights[i] = (uint8_t)Floor;
+        Remainders[i] = Scaled - (float)Floor;
+        Sum += Floor;
+    }
+
+    for (int32_t Left = 255 - Sum; Left > 0; --Left)
+    {
+        int32_t Best = 0;
+        for (int32_t i = 1; i < Count; ++i)
+        {
+            if (Remainders[i] > Remainders[Best]) Best = i;
+        }
+        OutWeights[Best]++;
+        Remainders[Best] = -1.0f;
+    }
+}
+
+// 蒙皮流编解码：按影响数与索引宽度做编译期特化，内层循环可完全展开
+template<int32_t InfluenceCount, typename IndexType>
+static void EncodeSkinStream(GASMesh* Mesh)
+{
+    const uint16_t Stride = Mesh->CompactHeader.SkinStride;
+    for (int32_t i = 0; i < Mesh->Vertices.Num(); ++i)
+    {
+        const FGASSkinVertex& Vertex = Mesh->Vertices[i];
+        uint8_t* Skin = Mesh->CompactSkin.GetData() + (size_t)i * Stride;
+        uint8_t* WeightBytes = Skin + InfluenceCount * sizeof(IndexType);
+        GASVertexCompression::QuantizeWeights(Vertex.BoneWeights.Weights, InfluenceCount, WeightBytes);
+
+        for (int32_t j = 0; j < InfluenceCount; ++j)
+        {
+            IndexType BoneIndex = (IndexType)((WeightBytes[j] > 0) ? Vertex.BoneIndices.Indices[j] : 0);
+            std::memcpy(Skin + j * sizeof(IndexType), &BoneIndex, sizeof(IndexType));
+        }
+    }
+}
+
+template<int32_t InfluenceCount, typename IndexType>
+static void DecodeSkin(const uint8_t* Skin, FGASSkinVertex& OutVertex)
+{
+    const uint8_t* WeightBytes = Skin + InfluenceCount * sizeof(IndexType);
+    for (int32_t j = 0; j < InfluenceCount; ++j)
+    {
+        IndexType BoneIndex;
+        std::memcpy(&BoneIndex, Skin + j * sizeof(IndexType), sizeof(IndexType));
+        OutVertex.BoneIndices.Indices[j] = BoneIndex;
+        OutVertex.BoneWeights.Weights[j] = WeightBytes[j] * (1.0f / 255.0f);
+    }
+}
+
+// Mesh 级别
+
+bool GASVertexCompression::BuildCompactStreams(GASMesh* Mesh)
+{
+    if (!Mesh || Mesh->Vertices.Num() == 0) return false;
+
+    const int32_t NumVertices = Mesh->Vertices.Num();
+    const int32_t InfluenceCount = Mesh->GetInfluenceCount();
+
+    // 根据实际使用的最大骨骼索引选择 8/16 位索引
+    uint32_t MaxBoneIndex = 0;
+    for (const FGASSkinVertex& Vertex : Mesh->Vertices)
+    {
+        for (int32_t j = 0; j < InfluenceCount; ++j)
+        {
+            if (Vertex.BoneWeights.Weights[j] > 0.0f)
+            {
+                MaxBoneIndex = std::max(MaxBoneIndex, Vertex.BoneIndices.Indices[j]);
+            }
+        }
+    }
+    if (MaxBoneIndex > 0xffffu)
+    {
+        GAS_LOG_ERROR("Compact vertices: bone index %u does not fit in 16 bits (%s)", MaxBoneIndex, Mesh->AssetName.c_str());
+        return false;
+    }
+
+    FGASCompactVertexHeader& Header = Mesh->CompactHeader;
+    Header = FGASCompactVertexHeader();
+    Header.NumVertices = (uint32_t)NumVertices;
+    Header.InfluenceCount = (uint8_t)InfluenceCount;
+    Header.BoneIndexBytes = (MaxBoneIndex <= 0xffu) ? 1 : 2;
+    Header.SkinStride = (uint16_t)((InfluenceCount * (Header.BoneIndexBytes + 1) + 3) & ~3);
+
+    Mesh->CompactPositions.Resize(NumVertices);
+    Mesh->CompactShading.Resize(NumVertices);
+    Mesh->CompactSkin.Resize(NumVertices * Header.SkinStride);
+    std::memset(Mesh->CompactSkin.GetData(), 0, Mesh->CompactSkin.GetTotalSizeInBytes());
+
+    for (int32_t i = 0; i < NumVertices; ++i)
+    {
+        const FGASSkinVertex& Vertex = Mesh->Vertices[i];
+
+        // 位置流
+        Mesh->CompactPositions[i] = Vertex.Position;
+
+        // 着色流
+        FGASCompactShading& Shading = Mesh->CompactShading[i];
+        EncodeOctahedral(GASMath::Normalize(Vertex.Normal), Shading.Normal);
+        EncodeOctahedral(GASMath::Normalize(Vertex.Tangent), Shading.Tangent);
+        Shading.UV[0] = FloatToHalf(Vertex.UV.X);
+        Shading.UV[1] = FloatToHalf(Vertex.UV.Y);
+
+        // 副切线不单独存储，只记录方向
+        FGASVector3 Reconstructed = GASMath::Cross(Vertex.Normal, Vertex.Tangent);
+        Shading.TangentSign = (GASMath::Dot(Reconstructed, Vertex.Bitangent) < 0.0f) ? -1 : 1;
+        Shading.Padding = 0;
+    }
+
+    // 蒙皮流
+    const bool bByteIndices = (Header.BoneIndexBytes == 1);
+    DispatchInfluenceCount(InfluenceCount, [Mesh, bByteIndices](auto Count)
+    {
+        constexpr int32_t N = decltype(Count)::value;
+        if (bByteIndices) EncodeSkinStream<N, uint8_t>(Mesh);
+        else EncodeSkinStream<N, uint16_t>(Mesh);
+    });
+
+    Mesh->MeshHeader.MeshFlags |= static_cast<uint32_t>(EGASMeshFlags::CompactVertices);
+    Mesh->BaseHeader.DataSize += (uint32_t)(sizeof(FGASCompactVertexHeader)
+        + Mesh->CompactPositions.GetTotalSizeInBytes()
+        + Mesh->CompactShading.GetTotalSizeInBytes()
+        + Mesh->CompactSkin.GetTotalSizeInBytes());
+
+    return true;
+}
+
+void GASVertexCompression::DecodeVertex(const GASMesh* Mesh, int32_t VertexIndex, FGASSkinVertex& OutVertex)
+{
+    const FGASCompactVertexHeader& Header = Mesh->CompactHeader;
+    const FGASCompactShading& Shading = Mesh->CompactShading[VertexIndex];
+
+    OutVertex = FGASSkinVertex();
+    OutVertex.VertexID = (float)VertexIndex;
+    OutVertex.Position = Mesh->CompactPositions[VertexIndex];
+    OutVertex.Normal = DecodeOctahedral(Shading.Normal);
+    OutVertex.Tangent = DecodeOctahedral(Shading.Tangent);
+    OutVertex.Bitangent = GASMath::Scale(GASMath::Cross(OutVertex.Normal, OutVertex.Tangent), (float)Shading.TangentSign);
+    OutVertex.UV = FGASVector3(HalfToFloat(Shading.UV[0]), HalfToFloat(Shading.UV[1]), 0.0f);
+
+    const uint8_t* Skin = Mesh->GetCompactSkinData(VertexIndex);
+    const bool bByteIndices = (Header.BoneIndexBytes == 1);
+    DispatchInfluenceCount(Header.InfluenceCount, [Skin, bByteIndices, &OutVertex](auto Count)
+    {
+        constexpr int32_t N = decltype(Count)::value;
+        if (bByteIndices) DecodeSkin<N, uint8_t>(Skin, OutVertex);
+        else DecodeSkin<N, uint16_t>(Skin, OutVertex);
+    });
+}
+
+FGASVertexCompressionError GASVertexCompression::Validate(const GASMesh* Mesh)
+{
+    FGASVertexCompressionError Error;
+    if (!Mesh || !Mesh->HasCompactVertices()) return Error;
+
+    const int32_t NumVertices = std::min(Mesh->Vertices.Num(), (int32_t)Mesh->CompactHeader.NumVertices);
+    for (int32_t i = 0; i < NumVertices; ++i)
+    {
+        const FGASSkinVertex& Original = Mesh->Vertices[i];
+        FGASSkinVertex Decoded;
+        DecodeVertex(Mesh, i, Decoded);
+
+        if (GASMath::LengthSq(Original.Normal) > GASMath::SMALL_NUMBER)
+        {
+            Error.MaxNormalError = std::max(Error.MaxNormalError, 1.0f - GASMath::Dot(GASMath::Normalize(Original.Normal), Decoded.Normal));
+        }
+        if (GASMath::LengthSq(Original.Tangent) > GASMath::SMALL_NUMBER)
+        {
+            Error.MaxTangentError = std::max(Error.MaxTangentError, 1.0f - GASMath::Dot(GASMath::Normalize(Original.Tangent), Decoded.Tangent));
+        }
+        if (GASMath::LengthSq(Original.Bitangent) > GASMath::SMALL_NUMBER && GASMath::Dot(Original.Bitangent, Decoded.Bitangent) < 0.0f)
+        {
+            Error.TangentSignMismatches++;
+        }
+        Error.MaxUVError = std::max(Error.MaxUVError, std::abs(Original.UV.X - Decoded.UV.X));
+        Error.MaxUVError = std::max(Error.MaxUVError, std::abs(Original.UV.Y - Decoded.UV.Y));
+
+        for (int32_t j = 0; j < Mesh->CompactHeader.InfluenceCount && j < MAX_BONE_INFLUENCES; ++j)
+        {
+            float OriginalWeight = Original.BoneWeights.Weights[j];
+            Error.MaxWeightError = std::max(Error.MaxWeightError, std::abs(OriginalWeight - Decoded.BoneWeights.Weights[j]));
+            if (Decoded.BoneWeights.Weights[j] > 0.0f && Original.BoneIndices.Indices[j] != Decoded.BoneIndices.Indices[j])
+            {
+                Error.IndexMismatches++;
+            }
+        }
+    }
+    return Error;
+}
+
+void GASVertexCompression::StripFullVertices(GASMesh* Mesh)
+{
+    if (!Mesh || !Mesh->HasCompactVertices()) return;
+
+    Mesh->BaseHeader.DataSize -= (uint32_t)Mesh->Vertices.GetTotalSizeInBytes();
+    Mesh->Vertices = GASArray<FGASSkinVertex>();
+    Mesh->MeshHeader.NumVertices = 0;
+}
@@ -0,0 +1,47 @@
+﻿#pragma once
+#include <cstdint>
+#include "../Types/GASAsset.h"
+#include "../Types/GASCoreTypes.h"
+
+// 误差统计：用于校验紧凑顶点流与原始顶点的差异
+struct FGASVertexCompressionError
+{
+    float MaxNormalError = 0.0f;   // 法线最大角度误差 (1 - dot)
+    float MaxTangentError = 0.0f;
+    float MaxUVError = 0.0f;
+    float MaxWeightError = 0.0f;
+    int32_t IndexMismatches = 0;   // 骨骼索引不一致的影响数
+    int32_t TangentSignMismatches = 0; // 解码后副切线与原始副切线方向相反的顶点数 (原始副切线为零时不计)
+};
+
+// 负责 FGASSkinVertex 与紧凑 GPU 顶点流之间的编码与解码
+class GASVertexCompression
+{
+public:
+    // 标量编码
+
+    // float <-> half (IEEE 754 binary16，最近舍入)
+    static uint16_t FloatToHalf(float Value);
+    static float HalfToFloat(uint16_t Value);
+
+    // 单位向量八面体编码为 2 个 snorm16
+    static void EncodeOctahedral(const FGASVector3& Dir, int16_t OutOct[2]);
+    static FGASVector3 DecodeOctahedral(const int16_t InOct[2]);
+
+    // 权重量化为 unorm8，总和严格等于 255 (最大余数法)
+    static void QuantizeWeights(const float* Weights, int32_t Count, uint8_t* OutWeights);
+
+    // Mesh 级别
+
+    // 由 Mesh->Vertices 生成紧凑顶点流，并设置 MeshFlags/DataSize
+    static bool BuildCompactStreams(GASMesh* Mesh);
+
+    // CPU 解码单个顶点 (用于校验与回退)，VertexID 写入顶点序号
+    static void DecodeVertex(const GASMesh* Mesh, int32_t VertexIndex, FGASSkinVertex& OutVertex);
+
+    // 对比紧凑流与原始顶点，返回误差统计
+    static FGASVertexCompressionError Validate(const GASMesh* Mesh);
+
+    // 释放完整顶点，仅保留紧凑流 (运行时节省内存)
+    static void StripFullVertices(GASMesh* Mesh);
+};
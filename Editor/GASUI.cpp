@@ -269,6 +269,14 @@ void GASUI::RenderImporterPanel()
                 TypeColor = ImVec4(1.0f, 0.6f, 0.0f, 1.0f); // 橙色
                 TypeLabel = "[ANIM]";
                 break;
+            case EGASAssetType::VertexAnimation:
+                TypeColor = ImVec4(0.9f, 0.4f, 1.0f, 1.0f); // 紫色
+                TypeLabel = "[VAT]";
+                break;
+            case EGASAssetType::Retarget:
+                TypeColor = ImVec4(0.3f, 0.9f, 0.8f, 1.0f); // 青色
+                TypeLabel = "[RTG]";
+                break;
             }
 
             ImGui::TextColored(TypeColor, "%s", TypeLabel.c_str());
@@ -298,6 +306,18 @@ void GASUI::RenderImporterPanel()
                 float FPS = (Asset.Duration > 0.0001f) ? ((float)Asset.FrameCount / Asset.Duration) : 0.0f;
                 ImGui::BulletText("FrameRate:  %.1f fps", FPS);
             }
+            // 顶点动画纹理信息
+            else if (Asset.Type == EGASAssetType::VertexAnimation)
+            {
+                ImGui::BulletText("Vertices:   %d", Asset.VerticeCount);
+                ImGui::BulletText("Frames:     %d", Asset.FrameCount);
+                ImGui::BulletText("Clips:      %d", Asset.MeshCount);
+            }
+            // 重定向表信息
+            else if (Asset.Type == EGASAssetType::Retarget)
+            {
+                ImGui::BulletText("Target Bones: %d", Asset.BoneCount);
+            }
 
             ImGui::PopStyleColor(); // 恢复颜色
             ImGui::Unindent(15.0f);
@@ -511,6 +531,9 @@ void GASUI::RunLoop()
     {
         glfwPollEvents();
 
+        // 帧边界：替换热重载的资产
+        GASAssetManager::Get().ProcessPendingReloads();
+
         // 摄像机控制
         if (ImGui::GetIO().MouseWheel != 0.0f) {
             m_CameraDistance += ImGui::GetIO().MouseWheel * 20.0f;
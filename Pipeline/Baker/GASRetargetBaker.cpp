@@ -0,0 +1,145 @@
+﻿#include "GASRetargetBaker.h"
+#include <algorithm>
+#include <cmath>
+#include "../../Core/Utils/GASMath.h"
+#include "../../Core/Utils/GASLogging.h"
+#include "../../Core/Utils/GASHashManager.h"
+#include "../../Core/Utils/GASSkeletonTopology.h"
+
+// 绑定姿态的全局矩阵：未传入局部绑定姿态时由逆绑定矩阵求得
+static bool ComputeGlobalBindPose(const GASSkeleton* Skeleton, const FGASTransform* LocalBindPose, std::vector<FGASMatrix4x4>& OutGlobal)
+{
+    std::vector<FGASTransform> DerivedPose;
+    if (!LocalBindPose)
+    {
+        if (!GASSkeletonTopology::ComputeBindPose(Skeleton, DerivedPose)) return false;
+        LocalBindPose = DerivedPose.data();
+    }
+
+    const int32_t NumBones = Skeleton->GetNumBones();
+    OutGlobal.resize(NumBones);
+    for (int32_t b = 0; b < NumBones; ++b)
+    {
+        const int32_t Parent = Skeleton->GetParentIndex(b);
+        if (Parent >= b)
+        {
+            GAS_LOG_ERROR("RetargetBaker: Skeleton %s is not parent-first (bone %d)", Skeleton->AssetName.c_str(), b);
+            return false;
+        }
+
+        const FGASMatrix4x4 Local = GASMath::ToMatrix(LocalBindPose[b]);
+        OutGlobal[b] = (Parent >= 0) ? GASMath::Multiply(OutGlobal[Parent], Local) : Local;
+    }
+    return true;
+}
+
+static FGASTransform ToLocalBindPose(const GASSkeleton* Skeleton, const std::vector<FGASMatrix4x4>& Global, int32_t Bone)
+{
+    const int32_t Parent = Skeleton->GetParentIndex(Bone);
+    return GASMath::ToTransform(Parent >= 0 ? GASMath::Multiply(GASMath::Inverse(Global[Parent]), Global[Bone]) : Global[Bone]);
+}
+
+bool GASRetargetBaker::Bake(const GASSkeleton* Source, const GASSkeleton* Target, const FGASRetargetSettings& Settings, GASRetargetMap* OutMap,
+    const FGASTransform* SourceBindPose, const FGASTransform* TargetBindPose)
+{
+    if (!Source || !Target || !OutMap) return false;
+
+    std::vector<FGASMatrix4x4> SourceGlobal, TargetGlobal;
+    if (!ComputeGlobalBindPose(Source, SourceBindPose, SourceGlobal)) return false;
+    if (!ComputeGlobalBindPose(Target, TargetBindPose, TargetGlobal)) return false;
+
+    const int32_t NumBones = Target->GetNumBones();
+    const int32_t NumSourceBones = Source->GetNumBones();
+    std::vector<FGASQuaternion> SourceRotation(NumSourceBones), TargetRotation(NumBones);
+    for (int32_t b = 0; b < NumSourceBones; ++b) SourceRotation[b] = GASMath::ToQuaternion(SourceGlobal[b]);
+    for (int32_t b = 0; b < NumBones; ++b) TargetRotation[b] = GASMath::ToQuaternion(TargetGlobal[b]);
+
+    // 名称映射：别名优先，其余按规范化名称哈希匹配
+    std::vector<int32_t> SourceIndex(NumBones, -1);
+    for (int32_t t = 0; t < NumBones; ++t)
+    {
+        const FGASBoneDefinition& Bone = Target->Bones[t];
+        SourceIndex[t] = Source->FindBoneIndexByHash(Bone.NameHash != 0 ? Bone.NameHash : GASHashBoneName(Bone.Name));
+    }
+    for (const auto& Alias : Settings.BoneAliases)
+    {
+        const int32_t t = Target->FindBoneIndex(Alias.first);
+        const int32_t s = Source->FindBoneIndex(Alias.second);
+        if (t < 0 || s < 0)
+        {
+            GAS_LOG_WARN("RetargetBaker: Alias %s -> %s not found, ignored", Alias.first.c_str(), Alias.second.c_str());
+            continue;
+        }
+        SourceIndex[t] = s;
+    }
+
+    std::vector<bool> bAnimatedTranslation(NumBones, false);
+    if (Settings.AnimatedTranslationBones.empty())
+    {
+        for (int32_t t = 0; t < NumBones; ++t) bAnimatedTranslation[t] = Target->GetParentIndex(t) < 0;
+    }
+    for (const std::string& Name : Settings.AnimatedTranslationBones)
+    {
+        const int32_t t = Target->FindBoneIndex(Name);
+        if (t >= 0) bAnimatedTranslation[t] = true;
+        else GAS_LOG_WARN("RetargetBaker: Bone %s not found in target skeleton", Name.c_str());
+    }
+
+    GASRetargetMap& Map = *OutMap;
+    Map.Bones.Resize(NumBones);
+    uint32_t NumMapped = 0;
+    for (int32_t t = 0; t < NumBones; ++t)
+    {
+        FGASRetargetBone& Out = Map.Bones[t];
+        Out = FGASRetargetBone();
+        Out.BindPose = ToLocalBindPose(Target, TargetGlobal, t);
+
+        const int32_t s = SourceIndex[t];
+        if (s < 0) continue;
+        Out.SourceIndex = s;
+        ++NumMapped;
+
+        // Target = inv(Gt_parent) * Gs_parent * Source * inv(Gs) * Gt，源处于绑定姿态时恰好得到目标绑定姿态
+        const int32_t SourceParent = Source->GetParentIndex(s);
+        const int32_t TargetParent = Target->GetParentIndex(t);
+        const FGASQuaternion SourceParentRotation = SourceParent >= 0 ? SourceRotation[SourceParent] : GASMath::IdentityQuat();
+        const FGASQuaternion TargetParentRotation = TargetParent >= 0 ? TargetRotation[TargetParent] : GASMath::IdentityQuat();
+        Out.PreRotation = GASMath::Normalize(GASMath::Multiply(GASMath::Conjugate(TargetParentRotation), SourceParentRotation));
+        Out.PostRotation = GASMath::Normalize(GASMath::Multiply(GASMath::Conjugate(SourceRotation[s]), TargetRotation[t]));
+
+        if (bAnimatedTranslation[t])
+        {
+            Out.TranslationMode = EGASRetargetTranslation::AnimationScaled;
+            if (Settings.TranslationScale > 0.0f)
+            {
+                Out.TranslationScale = Settings.TranslationScale;
+            }
+            else
+            {
+                const float SourceLength = GASMath::Length(ToLocalBindPose(Source, SourceGlobal, s).Translation);
+                const float TargetLength = GASMath::Length(Out.BindPose.Translation);
+                Out.TranslationScale = SourceLength > 1e-4f ? TargetLength / SourceLength : 1.0f;
+            }
+        }
+    }
+
+    Map.RetargetHeader.SourceSkeletonGUID = Source->GetGUID();
+    Map.RetargetHeader.TargetSkeletonGUID = Target->GetGUID();
+    Map.RetargetHeader.NumBones = (uint32_t)NumBones;
+    Map.RetargetHeader.NumSourceBones = (uint32_t)NumSourceBones;
+    Map.RetargetHeader.NumMappedBones = NumMapped;
+
+    Map.BaseHeader.Magic = GAS_ASSET_MAGIC;
+    Map.BaseHeader.Version = GAS_FILE_VERSION;
+    Map.BaseHeader.AssetType = EGASAssetType::Retarget;
+    Map.BaseHeader.HeaderSize = sizeof(FGASAssetHeader) + sizeof(FGASRetargetHeader);
+    Map.BaseHeader.DataSize = (uint32_t)Map.Bones.GetTotalSizeInBytes();
+    Map.BaseHeader.XXHash64 = CalculateXXHash64(Map.Bones.GetData(), Map.Bones.GetTotalSizeInBytes());
+
+    if (NumMapped < (uint32_t)NumBones)
+    {
+        GAS_LOG_WARN("RetargetBaker: %u of %d target bones have no source bone and keep their bind pose", NumBones - NumMapped, NumBones);
+    }
+    GAS_LOG("RetargetBaker: %s -> %s, %u/%d bones mapped", Source->AssetName.c_str(), Target->AssetName.c_str(), NumMapped, NumBones);
+    return NumMapped > 0;
+}
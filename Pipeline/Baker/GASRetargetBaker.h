@@ -0,0 +1,29 @@
+﻿#pragma once
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../../Core/Types/GASAsset.h"
+
+// 重定向表构建参数
+struct FGASRetargetSettings
+{
+    // 名称不同的骨骼对应关系 (目标骨骼名, 源骨骼名)，其余骨骼按规范化名称自动匹配
+    std::vector<std::pair<std::string, std::string>> BoneAliases;
+
+    // 使用源动画平移 (AnimationScaled) 的目标骨骼名称，为空时只有根骨骼使用
+    std::vector<std::string> AnimatedTranslationBones;
+
+    // AnimationScaled 平移比例，<= 0 时按双方绑定姿态中的骨骼长度自动计算
+    float TranslationScale = 0.0f;
+};
+
+// 离线由源/目标两副骨骼求得重定向表：名称映射只解析一次，绑定姿态差异折算成每根骨骼的修正旋转与平移比例
+class GASRetargetBaker
+{
+public:
+    // 两副骨骼应处于相近的绑定姿态 (如都为 T-Pose)；绑定姿态默认由逆绑定矩阵求得，
+    // 没有蒙皮权重的骨骼其逆绑定矩阵为单位阵，此时应传入局部绑定姿态 (按骨骼顺序，可取 T-Pose 动画的第一帧)
+    static bool Bake(const GASSkeleton* Source, const GASSkeleton* Target, const FGASRetargetSettings& Settings, GASRetargetMap* OutMap,
+        const FGASTransform* SourceBindPose = nullptr, const FGASTransform* TargetBindPose = nullptr);
+};
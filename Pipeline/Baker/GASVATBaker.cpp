@@ -0,0 +1,291 @@
+﻿#include "GASVATBaker.h"
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+#include "../../Core/Utils/GASMath.h"
+#include "../../Core/Utils/GASLogging.h"
+#include "../../Core/Utils/GASHashManager.h"
+#include "../../Core/Utils/GASVertexCompression.h"
+#include "../../Runtime/Rendering/GASSkinning.h"
+#include "../../Runtime/Animation/GASPoseSampler.h"
+
+// 收集某级 LOD 引用的顶点 (按首次出现顺序)，生成重映射后的 Section 与索引
+static void GatherLODVertices(const GASMesh* Mesh, int32_t LODIndex, GASVertexAnimation* VAT)
+{
+    std::vector<int32_t> Remap(Mesh->GetNumVertices(), -1);
+
+    int32_t NumSections = 0;
+    const FGASSubMesh* Sections = Mesh->GetLODSections(LODIndex, NumSections);
+    for (int32_t s = 0; s < NumSections; ++s)
+    {
+        FGASSubMesh Section;
+        Section.MaterialIndex = Sections[s].MaterialIndex;
+        Section.IndexStart = (uint32_t)VAT->Indices.Num();
+        Section.IndexCount = Sections[s].IndexCount;
+        Section.VertexStart = (uint32_t)VAT->SourceVertices.Num();
+
+        for (uint32_t i = 0; i < Sections[s].IndexCount; ++i)
+        {
+            const uint32_t Source = Mesh->GetIndex((int32_t)(Sections[s].IndexStart + i));
+            if (Remap[Source] < 0)
+            {
+                Remap[Source] = VAT->SourceVertices.Num();
+                VAT->SourceVertices.Add(Source);
+            }
+            VAT->Indices.Add((uint32_t)Remap[Source]);
+        }
+
+        // 与前面 Section 共享的顶点不计入本区间
+        Section.VertexCount = (uint32_t)VAT->SourceVertices.Num() - Section.VertexStart;
+        VAT->Sections.Add(Section);
+    }
+}
+
+static uint16_t QuantizePosition(float Value, float Lo, float Extent)
+{
+    if (Extent <= 0.0f) return 0;
+    float Q = (Value - Lo) / Extent * 65535.0f + 0.5f;
+    return (uint16_t)std::min(std::max(Q, 0.0f), 65535.0f);
+}
+
+static int8_t ToSnorm8(int16_t Snorm16)
+{
+    float V = std::round((float)Snorm16 * (127.0f / 32767.0f));
+    return (int8_t)std::min(std::max(V, -127.0f), 127.0f);
+}
+
+bool GASVATBaker::Bake(const GASMesh* Mesh, const GASSkeleton* Skeleton, const std::vector<const GASAnimation*>& Animations,
+    const FGASVATSettings& Settings, GASVertexAnimation* OutVAT)
+{
+    if (!Mesh || !Skeleton || !OutVAT || Animations.empty()) return false;
+    if (Mesh->Vertices.Num() == 0 && !Mesh->HasCompactVertices())
+    {
+        GAS_LOG_ERROR("BakeVAT: Mesh %s has no vertex data", Mesh->AssetName.c_str());
+        return false;
+    }
+
+    const int32_t NumBones = Skeleton->GetNumBones();
+    const int32_t FrameStep = std::max(Settings.FrameStep, 1);
+    if (Mesh->SkeletonGUID != 0 && Skeleton->GetGUID() != 0 && Mesh->SkeletonGUID != Skeleton->GetGUID())
+    {
+        GAS_LOG_ERROR("BakeVAT: Mesh %s is bound to skeleton %llu, not %llu", Mesh->AssetName.c_str(), Mesh->SkeletonGUID, Skeleton->GetGUID());
+        return false;
+    }
+    for (const GASAnimation* Animation : Animations)
+    {
+        if (!Animation || (int32_t)Animation->AnimHeader.TrackCount != NumBones || Animation->GetNumFrames() <= 0)
+        {
+            GAS_LOG_ERROR("BakeVAT: Animation %s does not match skeleton", Animation ? Animation->AssetName.c_str() : "null");
+            return false;
+        }
+        // 叠加动画的帧是相对参考姿态的差值，不能直接蒙皮
+        if (Animation->IsAdditive())
+        {
+            GAS_LOG_ERROR("BakeVAT: Animation %s is additive", Animation->AssetName.c_str());
+            return false;
+        }
+        // 轨道数相同不代表是同一套骨骼；旧文件未记录目标骨骼 (0) 时无法校验
+        const uint64_t TargetSkeleton = Animation->AnimHeader.TargetSkeletonGUID;
+        if (TargetSkeleton != 0 && Skeleton->GetGUID() != 0 && TargetSkeleton != Skeleton->GetGUID())
+        {
+            GAS_LOG_ERROR("BakeVAT: Animation %s targets skeleton %llu, not %llu", Animation->AssetName.c_str(), TargetSkeleton, Skeleton->GetGUID());
+            return false;
+        }
+    }
+
+    GASVertexAnimation& VAT = *OutVAT;
+    VAT.Clips.Empty();
+    VAT.SourceVertices.Empty();
+    VAT.Sections.Empty();
+    VAT.Indices.Empty();
+    VAT.Texels = GASArray<FGASVATTexel>();
+
+    const int32_t LODIndex = (Settings.LODIndex < 0 || Settings.LODIndex >= Mesh->GetNumLODs()) ? Mesh->GetNumLODs() - 1 : Settings.LODIndex;
+    GatherLODVertices(Mesh, LODIndex, &VAT);
+    const int32_t NumVertices = VAT.SourceVertices.Num();
+    if (NumVertices == 0) return false;
+
+    // 取出参与烘焙的顶点 (完整顶点已剥离时从紧凑流解码)
+    std::vector<FGASSkinVertex> Vertices(NumVertices);
+    for (int32_t v = 0; v < NumVertices; ++v)
+    {
+        const int32_t Source = (int32_t)VAT.SourceVertices[v];
+        if (Mesh->Vertices.Num() > 0) Vertices[v] = Mesh->Vertices[Source];
+        else GASVertexCompression::DecodeVertex(Mesh, Source, Vertices[v]);
+    }
+
+    // 片段表：(源帧数 - 1) 按 FrameStep 向上取整分段，采样点均匀分布且包含末帧，循环周期与源动画一致
+    // 步长整除时采样点恰为每隔 FrameStep 的源帧，否则相邻源帧插值
+    uint32_t TotalFrames = 0;
+    std::vector<double> SourceSteps;
+    for (const GASAnimation* Animation : Animations)
+    {
+        const int32_t SourceSegments = Animation->GetNumFrames() - 1;
+        const int32_t Segments = (SourceSegments + FrameStep - 1) / FrameStep;
+
+        FGASVATClip Clip;
+        Clip.AnimationGUID = Animation->GetGUID();
+        Clip.FirstFrame = TotalFrames;
+        Clip.NumFrames = (uint32_t)(Segments + 1);
+        Clip.FrameRate = Segments > 0 ? Animation->GetFrameRate() * (float)Segments / (float)SourceSegments : Animation->GetFrameRate() / (float)FrameStep;
+        Clip.Duration = Animation->GetDuration();
+        VAT.Clips.Add(Clip);
+        TotalFrames += Clip.NumFrames;
+        SourceSteps.push_back(Segments > 0 ? (double)SourceSegments / Segments : 0.0);
+    }
+
+    // 逐帧蒙皮：第一遍求量化范围，第二遍写纹素 (避免缓存全部帧的浮点位置)
+    std::vector<FGASSkinMatrix> SkinMatrices(NumBones);
+    std::vector<FGASTransform> Pose(NumBones);
+    std::vector<FGASVector3> Positions(NumVertices), Normals(NumVertices);
+    FGASSkinningOutput Output;
+    Output.Positions = Positions.data();
+    Output.Normals = Normals.data();
+
+    // 片段 c 的第 f 个采样点 (源帧位置 f * SourceSteps[c])
+    auto SkinFrame = [&](int32_t ClipIndex, uint32_t SampleIndex) -> bool
+    {
+        const GASAnimation* Animation = Animations[ClipIndex];
+        const double SourceFrame = SampleIndex * SourceSteps[ClipIndex];
+        const int32_t Frame0 = std::min((int32_t)(SourceFrame + 1e-6), Animation->GetNumFrames() - 1);
+        const float Alpha = (float)(SourceFrame - Frame0);
+        if (Alpha <= 1e-6f || Frame0 + 1 >= Animation->GetNumFrames())
+        {
+            if (!GASSkinning::ComputeSkinMatrices(Skeleton, Animation, Frame0, SkinMatrices.data())) return false;
+        }
+        else
+        {
+            GASPoseSampler::InterpolatePose(Animation->GetTransform(Frame0, 0), Animation->GetTransform(Frame0 + 1, 0), Alpha, NumBones, Pose.data());
+            if (!GASSkinning::ComputeSkinMatrices(Skeleton, Pose.data(), SkinMatrices.data())) return false;
+        }
+        GASSkinning::SkinLinear(Vertices.data(), NumVertices, Mesh->GetInfluenceCount(), SkinMatrices.data(), Output);
+        return true;
+    };
+
+    FGASAABB Bounds;
+    Bounds.Min = FGASVector3(FLT_MAX, FLT_MAX, FLT_MAX);
+    Bounds.Max = FGASVector3(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (int32_t c = 0; c < (int32_t)Animations.size(); ++c)
+    {
+        FGASAABB& ClipBounds = VAT.Clips[c].Bounds;
+        ClipBounds = Bounds;
+        for (uint32_t f = 0; f < VAT.Clips[c].NumFrames; ++f)
+        {
+            if (!SkinFrame(c, f)) return false;
+            for (const FGASVector3& P : Positions)
+            {
+                ClipBounds.Min = FGASVector3(std::min(ClipBounds.Min.X, P.X), std::min(ClipBounds.Min.Y, P.Y), std::min(ClipBounds.Min.Z, P.Z));
+                ClipBounds.Max = FGASVector3(std::max(ClipBounds.Max.X, P.X), std::max(ClipBounds.Max.Y, P.Y), std::max(ClipBounds.Max.Z, P.Z));
+            }
+        }
+        Bounds.Min = FGASVector3(std::min(Bounds.Min.X, ClipBounds.Min.X), std::min(Bounds.Min.Y, ClipBounds.Min.Y), std::min(Bounds.Min.Z, ClipBounds.Min.Z));
+        Bounds.Max = FGASVector3(std::max(Bounds.Max.X, ClipBounds.Max.X), std::max(Bounds.Max.Y, ClipBounds.Max.Y), std::max(Bounds.Max.Z, ClipBounds.Max.Z));
+    }
+
+    // 纹理尺寸：宽度取能放下一帧的 2 的幂 (不超过上限)，高度按总纹素数计算
+    uint32_t MaxWidth = 1;
+    while (MaxWidth * 2 <= std::max(Settings.MaxTextureWidth, 1u)) MaxWidth *= 2;
+    uint32_t Width = 1;
+    while (Width < (uint32_t)NumVertices && Width < MaxWidth) Width *= 2;
+    const uint64_t UsedTexels = (uint64_t)TotalFrames * NumVertices;
+    const uint32_t Height = (uint32_t)((UsedTexels + Width - 1) / Width);
+    if ((uint64_t)Width * Height > 0x7FFFFFFF)
+    {
+        GAS_LOG_ERROR("BakeVAT: Texture too large (%u frames x %d vertices)", TotalFrames, NumVertices);
+        return false;
+    }
+
+    VAT.VATHeader.SourceMeshGUID = Mesh->GetGUID();
+    VAT.VATHeader.NumVertices = (uint32_t)NumVertices;
+    VAT.VATHeader.NumFrames = TotalFrames;
+    VAT.VATHeader.NumClips = (uint32_t)VAT.Clips.Num();
+    VAT.VATHeader.NumSections = (uint32_t)VAT.Sections.Num();
+    VAT.VATHeader.NumIndices = (uint32_t)VAT.Indices.Num();
+    VAT.VATHeader.LODIndex = (uint32_t)LODIndex;
+    VAT.VATHeader.TextureWidth = Width;
+    VAT.VATHeader.TextureHeight = Height;
+    VAT.VATHeader.PositionBounds = Bounds;
+    VAT.Texels.Resize((int32_t)((uint64_t)Width * Height));
+
+    const float Lo[3] = { Bounds.Min.X, Bounds.Min.Y, Bounds.Min.Z };
+    const float Extent[3] = { Bounds.Max.X - Lo[0], Bounds.Max.Y - Lo[1], Bounds.Max.Z - Lo[2] };
+    for (int32_t c = 0; c < (int32_t)Animations.size(); ++c)
+    {
+        for (uint32_t f = 0; f < VAT.Clips[c].NumFrames; ++f)
+        {
+            if (!SkinFrame(c, f)) return false;
+
+            FGASVATTexel* Row = VAT.Texels.GetData() + (size_t)(VAT.Clips[c].FirstFrame + f) * NumVertices;
+            for (int32_t v = 0; v < NumVertices; ++v)
+            {
+                Row[v].Position[0] = QuantizePosition(Positions[v].X, Lo[0], Extent[0]);
+                Row[v].Position[1] = QuantizePosition(Positions[v].Y, Lo[1], Extent[1]);
+                Row[v].Position[2] = QuantizePosition(Positions[v].Z, Lo[2], Extent[2]);
+
+                int16_t Oct[2];
+                GASVertexCompression::EncodeOctahedral(Normals[v], Oct);
+                Row[v].Normal[0] = ToSnorm8(Oct[0]);
+                Row[v].Normal[1] = ToSnorm8(Oct[1]);
+            }
+        }
+    }
+
+    VAT.BaseHeader.Magic = GAS_ASSET_MAGIC;
+    VAT.BaseHeader.Version = GAS_FILE_VERSION;
+    VAT.BaseHeader.AssetType = EGASAssetType::VertexAnimation;
+    VAT.BaseHeader.HeaderSize = sizeof(FGASAssetHeader) + sizeof(FGASVATHeader);
+    VAT.BaseHeader.DataSize = (uint32_t)(VAT.Clips.GetTotalSizeInBytes() + VAT.SourceVertices.GetTotalSizeInBytes()
+        + VAT.Sections.GetTotalSizeInBytes() + VAT.Indices.GetTotalSizeInBytes() + VAT.Texels.GetTotalSizeInBytes());
+    VAT.BaseHeader.XXHash64 = CalculateXXHash64(VAT.Texels.GetData(), VAT.Texels.GetTotalSizeInBytes());
+
+    GAS_LOG("BakeVAT: %s -> %d vertices x %u frames (%ux%u, %.1f MB)", Mesh->AssetName.c_str(), NumVertices, TotalFrames,
+        Width, Height, VAT.Texels.GetTotalSizeInBytes() / (1024.0 * 1024.0));
+    return true;
+}
+
+void GASVATBaker::DecodeTexel(const GASVertexAnimation* VAT, const FGASVATTexel& Texel, FGASVector3& OutPosition, FGASVector3& OutNormal)
+{
+    const FGASAABB& Bounds = VAT->VATHeader.PositionBounds;
+    const float Scale = 1.0f / 65535.0f;
+    OutPosition = FGASVector3(Bounds.Min.X + Texel.Position[0] * Scale * (Bounds.Max.X - Bounds.Min.X),
+        Bounds.Min.Y + Texel.Position[1] * Scale * (Bounds.Max.Y - Bounds.Min.Y),
+        Bounds.Min.Z + Texel.Position[2] * Scale * (Bounds.Max.Z - Bounds.Min.Z));
+
+    const int16_t Oct[2] = { (int16_t)std::lround(Texel.Normal[0] * (32767.0f / 127.0f)), (int16_t)std::lround(Texel.Normal[1] * (32767.0f / 127.0f)) };
+    OutNormal = GASVertexCompression::DecodeOctahedral(Oct);
+}
+
+bool GASVATBaker::SampleClip(const GASVertexAnimation* VAT, int32_t ClipIndex, float Time, bool bLooping,
+    FGASVector3* OutPositions, FGASVector3* OutNormals)
+{
+    if (!VAT || !VAT->Clips.IsValidIndex(ClipIndex) || !OutPositions) return false;
+
+    const FGASVATClip& Clip = VAT->Clips[ClipIndex];
+    if (Clip.NumFrames == 0) return false;
+
+    // 时间 -> 片段内帧位置
+    const float LastFrame = (float)(Clip.NumFrames - 1);
+    float Frame = Time * Clip.FrameRate;
+    if (bLooping && Clip.NumFrames > 1)
+    {
+        Frame = std::fmod(Frame, LastFrame);
+        if (Frame < 0.0f) Frame += LastFrame;
+    }
+    Frame = std::min(std::max(Frame, 0.0f), LastFrame);
+
+    const uint32_t Frame0 = (uint32_t)Frame;
+    const uint32_t Frame1 = std::min(Frame0 + 1, Clip.NumFrames - 1);
+    const float Alpha = Frame - (float)Frame0;
+
+    const int32_t NumVertices = VAT->GetNumVertices();
+    for (int32_t v = 0; v < NumVertices; ++v)
+    {
+        FGASVector3 P0, N0, P1, N1;
+        DecodeTexel(VAT, VAT->GetTexel(Clip.FirstFrame + Frame0, (uint32_t)v), P0, N0);
+        DecodeTexel(VAT, VAT->GetTexel(Clip.FirstFrame + Frame1, (uint32_t)v), P1, N1);
+
+        OutPositions[v] = GASMath::Add(GASMath::Scale(P0, 1.0f - Alpha), GASMath::Scale(P1, Alpha));
+        if (OutNormals) OutNormals[v] = GASMath::Normalize(GASMath::Add(GASMath::Scale(N0, 1.0f - Alpha), GASMath::Scale(N1, Alpha)));
+    }
+    return true;
+}
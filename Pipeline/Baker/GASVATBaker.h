@@ -0,0 +1,28 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+#include "../../Core/Types/GASAsset.h"
+
+// VAT 烘焙参数
+struct FGASVATSettings
+{
+    int32_t LODIndex = -1;              // 烘焙所用的 Mesh LOD，-1 为最低一级 (远景群体)
+    int32_t FrameStep = 1;              // 每隔几帧取一帧 (不整除时均匀采样并保留末帧)
+    uint32_t MaxTextureWidth = 4096;    // 纹理宽度上限 (2 的幂)
+};
+
+// 离线把 GASMesh + 若干 GASAnimation 蒙皮为顶点动画纹理，并提供 CPU 解码 (用于测试与回退)
+class GASVATBaker
+{
+public:
+    // 所有动画须属于 Mesh 的骨骼且不能是叠加动画；片段按传入顺序依次排列在纹理中
+    static bool Bake(const GASMesh* Mesh, const GASSkeleton* Skeleton, const std::vector<const GASAnimation*>& Animations,
+        const FGASVATSettings& Settings, GASVertexAnimation* OutVAT);
+
+    // 解码单个纹素
+    static void DecodeTexel(const GASVertexAnimation* VAT, const FGASVATTexel& Texel, FGASVector3& OutPosition, FGASVector3& OutNormal);
+
+    // 采样片段在 Time 时刻的所有顶点 (相邻帧线性插值)，输出数组长度为 NumVertices，OutNormals 可为空
+    static bool SampleClip(const GASVertexAnimation* VAT, int32_t ClipIndex, float Time, bool bLooping,
+        FGASVector3* OutPositions, FGASVector3* OutNormals);
+};
@@ -0,0 +1,552 @@
+﻿#include "GASAnimGraph.h"
+#include <algorithm>
+#include <cmath>
+#include "GASPoseSampler.h"
+#include "GASPoseBlending.h"
+#include "../../Core/Utils/GASLogging.h"
+
+// 混合空间一次最多取 4 个样本 (2D 网格的一个单元)
+static const int32_t MAX_BLEND_TAPS = 4;
+
+// 低于该权重的样本不采样
+static const float MIN_TAP_WEIGHT = 1e-4f;
+
+static float Clamp01(float Value)
+{
+    return std::min(std::max(Value, 0.0f), 1.0f);
+}
+
+// 一个轴上的网格位置：单元起点与单元内插值
+static void LocateOnAxis(float Value, float Min, float Max, int32_t NumPoints, int32_t& OutCell, float& OutAlpha)
+{
+    OutCell = 0;
+    OutAlpha = 0.0f;
+    if (NumPoints < 2 || Max <= Min) return;
+
+    const float Grid = Clamp01((Value - Min) / (Max - Min)) * (float)(NumPoints - 1);
+    OutCell = std::min((int32_t)Grid, NumPoints - 2);
+    OutAlpha = Grid - (float)OutCell;
+}
+
+// 混合空间在当前参数下的样本与权重，返回样本数
+static int32_t GetBlendTaps(const FGASAnimGraphInstruction& Instruction, const FGASBlendSample* Samples, const float* Parameters,
+    uint32_t OutClips[MAX_BLEND_TAPS], float OutWeights[MAX_BLEND_TAPS])
+{
+    const FGASBlendSample* First = Samples + Instruction.First;
+    if (Instruction.Op == EGASAnimGraphOp::BlendSpace1D)
+    {
+        const float Value = Parameters[Instruction.Param0];
+        const int32_t Count = (int32_t)Instruction.Count;
+        int32_t Index = 0;
+        while (Index + 1 < Count && First[Index + 1].X <= Value) ++Index;
+        if (Index + 1 >= Count || Value <= First[Index].X)
+        {
+            OutClips[0] = First[Index].Clip;
+            OutWeights[0] = 1.0f;
+            return 1;
+        }
+
+        const float Alpha = (Value - First[Index].X) / (First[Index + 1].X - First[Index].X);
+        OutClips[0] = First[Index].Clip;
+        OutClips[1] = First[Index + 1].Clip;
+        OutWeights[0] = 1.0f - Alpha;
+        OutWeights[1] = Alpha;
+        return 2;
+    }
+
+    // 2D 网格：X 轴范围取第一行首尾，Y 轴范围取第一列首尾
+    const int32_t NumX = Instruction.NumX;
+    const int32_t NumY = Instruction.NumY;
+    int32_t CellX, CellY;
+    float AlphaX, AlphaY;
+    LocateOnAxis(Parameters[Instruction.Param0], First[0].X, First[NumX - 1].X, NumX, CellX, AlphaX);
+    LocateOnAxis(Parameters[Instruction.Param1], First[0].Y, First[(NumY - 1) * NumX].Y, NumY, CellY, AlphaY);
+
+    const int32_t StepX = NumX > 1 ? 1 : 0;
+    const int32_t StepY = NumY > 1 ? NumX : 0;
+    const int32_t Base = CellY * NumX + CellX;
+    OutClips[0] = First[Base].Clip;
+    OutClips[1] = First[Base + StepX].Clip;
+    OutClips[2] = First[Base + StepY].Clip;
+    OutClips[3] = First[Base + StepY + StepX].Clip;
+    OutWeights[0] = (1.0f - AlphaX) * (1.0f - AlphaY);
+    OutWeights[1] = AlphaX * (1.0f - AlphaY);
+    OutWeights[2] = (1.0f - AlphaX) * AlphaY;
+    OutWeights[3] = AlphaX * AlphaY;
+    return 4;
+}
+
+static float AdvancePhase(float Phase, float DeltaTime, float Length, bool bLooping)
+{
+    if (Length <= 0.0f) return bLooping ? 0.0f : 1.0f;
+
+    Phase += DeltaTime / Length;
+    if (!bLooping) return Clamp01(Phase);
+    Phase -= std::floor(Phase);
+    return Phase;
+}
+
+void GASAnimGraph::InitInstance(FGASAnimGraphInstance& Instance) const
+{
+    std::copy(std::begin(DefaultParameters), std::end(DefaultParameters), Instance.Parameters);
+    Instance.CurrentState = 0;
+    Instance.PreviousState = -1;
+    Instance.CurrentPhase = 0.0f;
+    Instance.PreviousPhase = 0.0f;
+    Instance.FadeElapsed = 0.0f;
+    Instance.FadeDuration = 0.0f;
+}
+
+void GASAnimGraph::InitContext(FGASAnimGraphContext& Context) const
+{
+    // 栈槽位 + 1 个混合空间临时槽位
+    Context.NumBones = NumBones;
+    Context.Poses.resize((size_t)(MaxStackDepth + 1) * NumBones);
+}
+
+int32_t GASAnimGraph::FindParameter(const std::string& Name) const
+{
+    for (size_t i = 0; i < ParameterNames.size(); ++i)
+    {
+        if (ParameterNames[i] == Name) return (int32_t)i;
+    }
+    return -1;
+}
+
+float GASAnimGraph::GetStateLength(int32_t State, const FGASAnimGraphInstance& Instance) const
+{
+    float Stack[GAS_ANIM_GRAPH_MAX_STACK];
+    int32_t Depth = 0;
+
+    const FGASAnimGraphState& S = States[State];
+    for (uint32_t i = 0; i < S.NumInstructions; ++i)
+    {
+        const FGASAnimGraphInstruction& Instruction = Instructions[S.FirstInstruction + i];
+        switch (Instruction.Op)
+        {
+        case EGASAnimGraphOp::Clip:
+            Stack[Depth++] = GASPoseSampler::GetLoopLength(Clips[Instruction.First]);
+            break;
+
+        case EGASAnimGraphOp::BlendSpace1D:
+        case EGASAnimGraphOp::BlendSpace2D:
+        {
+            uint32_t TapClips[MAX_BLEND_TAPS];
+            float TapWeights[MAX_BLEND_TAPS];
+            const int32_t NumTaps = GetBlendTaps(Instruction, Samples.data(), Instance.Parameters, TapClips, TapWeights);
+            float Length = 0.0f;
+            for (int32_t t = 0; t < NumTaps; ++t) Length += TapWeights[t] * GASPoseSampler::GetLoopLength(Clips[TapClips[t]]);
+            Stack[Depth++] = Length;
+            break;
+        }
+
+        case EGASAnimGraphOp::Blend:
+        {
+            const float Weight = Clamp01(Instance.Parameters[Instruction.Param0]);
+            const float B = Stack[--Depth];
+            Stack[Depth - 1] += (B - Stack[Depth - 1]) * Weight;
+            break;
+        }
+
+        case EGASAnimGraphOp::Additive:
+            // 叠加层跟随基础姿态的进度
+            --Depth;
+            break;
+        }
+    }
+    return Depth > 0 ? Stack[Depth - 1] : 0.0f;
+}
+
+void GASAnimGraph::Advance(FGASAnimGraphInstance& Instance, float DeltaTime) const
+{
+    if (States.empty()) return;
+
+    for (const FGASAnimGraphTransition& Transition : Transitions)
+    {
+        if (Transition.ToState == Instance.CurrentState) continue;
+        if (Transition.FromState >= 0 && Transition.FromState != Instance.CurrentState) continue;
+
+        bool bPass = false;
+        switch (Transition.Condition)
+        {
+        case EGASAnimGraphCondition::Greater: bPass = Instance.Parameters[Transition.Parameter] > Transition.Threshold; break;
+        case EGASAnimGraphCondition::Less: bPass = Instance.Parameters[Transition.Parameter] < Transition.Threshold; break;
+        case EGASAnimGraphCondition::PhaseAbove: bPass = Instance.CurrentPhase >= Transition.Threshold; break;
+        }
+        if (!bPass) continue;
+
+        const int32_t FromGroup = States[Instance.CurrentState].SyncGroup;
+        const bool bSync = FromGroup >= 0 && States[Transition.ToState].SyncGroup == FromGroup;
+
+        Instance.PreviousState = Transition.FadeDuration > 0.0f ? Instance.CurrentState : (int16_t)-1;
+        Instance.PreviousPhase = Instance.CurrentPhase;
+        Instance.CurrentState = (int16_t)Transition.ToState;
+        Instance.CurrentPhase = bSync ? Instance.PreviousPhase : 0.0f;
+        Instance.FadeElapsed = 0.0f;
+        Instance.FadeDuration = Transition.FadeDuration;
+        break;
+    }
+
+    const FGASAnimGraphState& Current = States[Instance.CurrentState];
+    Instance.CurrentPhase = AdvancePhase(Instance.CurrentPhase, DeltaTime, GetStateLength(Instance.CurrentState, Instance), Current.bLooping);
+
+    if (Instance.PreviousState >= 0)
+    {
+        const FGASAnimGraphState& Previous = States[Instance.PreviousState];
+        if (Previous.SyncGroup >= 0 && Previous.SyncGroup == Current.SyncGroup)
+        {
+            Instance.PreviousPhase = Instance.CurrentPhase;
+        }
+        else
+        {
+            Instance.PreviousPhase = AdvancePhase(Instance.PreviousPhase, DeltaTime, GetStateLength(Instance.PreviousState, Instance), Previous.bLooping);
+        }
+
+        Instance.FadeElapsed += DeltaTime;
+        if (Instance.FadeElapsed >= Instance.FadeDuration) Instance.PreviousState = -1;
+    }
+}
+
+void GASAnimGraph::AdvanceBatch(FGASAnimGraphInstance* Instances, int32_t NumInstances, float DeltaTime) const
+{
+    for (int32_t i = 0; i < NumInstances; ++i) Advance(Instances[i], DeltaTime);
+}
+
+void GASAnimGraph::SampleClip(uint32_t Clip, float Phase, FGASTransform* OutPose) const
+{
+    const GASAnimation* Animation = Clips[Clip];
+    GASPoseSampler::SamplePose(Animation, Phase * GASPoseSampler::GetLoopLength(Animation), false, OutPose);
+}
+
+const FGASTransform* GASAnimGraph::EvaluateState(int32_t State, float Phase, const FGASAnimGraphInstance& Instance, FGASAnimGraphContext& Context) const
+{
+    FGASTransform* Slots = Context.Poses.data();
+    FGASTransform* Temp = Slots + (size_t)MaxStackDepth * NumBones;
+    int32_t Depth = 0;
+
+    const FGASAnimGraphState& S = States[State];
+    for (uint32_t i = 0; i < S.NumInstructions; ++i)
+    {
+        const FGASAnimGraphInstruction& Instruction = Instructions[S.FirstInstruction + i];
+        switch (Instruction.Op)
+        {
+        case EGASAnimGraphOp::Clip:
+            SampleClip(Instruction.First, Phase, Slots + (size_t)Depth++ * NumBones);
+            break;
+
+        case EGASAnimGraphOp::BlendSpace1D:
+        case EGASAnimGraphOp::BlendSpace2D:
+        {
+            uint32_t TapClips[MAX_BLEND_TAPS];
+            float TapWeights[MAX_BLEND_TAPS];
+            const int32_t NumTaps = GetBlendTaps(Instruction, Samples.data(), Instance.Parameters, TapClips, TapWeights);
+
+            // 逐个样本累积：Out = Lerp(Out, Tap, w / 累计权重)
+            FGASTransform* Out = Slots + (size_t)Depth++ * NumBones;
+            float Accumulated = 0.0f;
+            for (int32_t t = 0; t < NumTaps; ++t)
+            {
+                if (TapWeights[t] < MIN_TAP_WEIGHT) continue;
+                if (Accumulated == 0.0f)
+                {
+                    SampleClip(TapClips[t], Phase, Out);
+                    Accumulated = TapWeights[t];
+                    continue;
+                }
+                SampleClip(TapClips[t], Phase, Temp);
+                Accumulated += TapWeights[t];
+                GASPoseBlending::BlendLayer(Out, Temp, TapWeights[t] / Accumulated, nullptr, NumBones, Out);
+            }
+            break;
+        }
+
+        case EGASAnimGraphOp::Blend:
+        {
+            --Depth;
+            FGASTransform* A = Slots + (size_t)(Depth - 1) * NumBones;
+            GASPoseBlending::BlendLayer(A, Slots + (size_t)Depth * NumBones, Clamp01(Instance.Parameters[Instruction.Param0]), nullptr, NumBones, A);
+            break;
+        }
+
+        case EGASAnimGraphOp::Additive:
+        {
+            --Depth;
+            FGASTransform* A = Slots + (size_t)(Depth - 1) * NumBones;
+            GASPoseBlending::ApplyAdditive(A, Slots + (size_t)Depth * NumBones, Clamp01(Instance.Parameters[Instruction.Param0]), nullptr, NumBones, A);
+            break;
+        }
+        }
+    }
+    return Slots;
+}
+
+bool GASAnimGraph::Evaluate(const FGASAnimGraphInstance& Instance, FGASAnimGraphContext& Context, FGASTransform* OutPose) const
+{
+    if (!OutPose || States.empty() || Context.NumBones != NumBones || Context.Poses.size() < (size_t)(MaxStackDepth + 1) * NumBones) return false;
+
+    const FGASTransform* Current = nullptr;
+    if (Instance.PreviousState < 0)
+    {
+        Current = EvaluateState(Instance.CurrentState, Instance.CurrentPhase, Instance, Context);
+        std::copy(Current, Current + NumBones, OutPose);
+        return true;
+    }
+
+    // 交叉淡化：来源状态先写入输出，再与当前状态混合
+    const FGASTransform* Previous = EvaluateState(Instance.PreviousState, Instance.PreviousPhase, Instance, Context);
+    std::copy(Previous, Previous + NumBones, OutPose);
+    Current = EvaluateState(Instance.CurrentState, Instance.CurrentPhase, Instance, Context);
+
+    const float Alpha = Instance.FadeDuration > 0.0f ? Clamp01(Instance.FadeElapsed / Instance.FadeDuration) : 1.0f;
+    GASPoseBlending::BlendLayer(OutPose, Current, Alpha, nullptr, NumBones, OutPose);
+    return true;
+}
+
+int32_t GASAnimGraphBuilder::AddParameter(const std::string& Name, float DefaultValue)
+{
+    const int32_t Index = (int32_t)Graph.ParameterNames.size();
+    if (Index >= GAS_ANIM_GRAPH_MAX_PARAMETERS)
+    {
+        GAS_LOG_ERROR("AnimGraph: Too many parameters (max %d), %s ignored", GAS_ANIM_GRAPH_MAX_PARAMETERS, Name.c_str());
+        bHasError = true;
+        return -1;
+    }
+    Graph.ParameterNames.push_back(Name);
+    Graph.DefaultParameters[Index] = DefaultValue;
+    return Index;
+}
+
+int32_t GASAnimGraphBuilder::AddClip(const GASAnimation* Animation)
+{
+    for (size_t i = 0; i < Graph.Clips.size(); ++i)
+    {
+        if (Graph.Clips[i] == Animation) return (int32_t)i;
+    }
+    Graph.Clips.push_back(Animation);
+    return (int32_t)Graph.Clips.size() - 1;
+}
+
+int32_t GASAnimGraphBuilder::BeginState(bool bLooping, int32_t SyncGroup)
+{
+    if (OpenState >= 0)
+    {
+        GAS_LOG_ERROR("AnimGraph: BeginState called before EndState of state %d", OpenState);
+        bHasError = true;
+    }
+
+    FGASAnimGraphState State;
+    State.FirstInstruction = (uint32_t)Graph.Instructions.size();
+    State.SyncGroup = SyncGroup;
+    State.bLooping = bLooping;
+    Graph.States.push_back(State);
+    OpenState = (int32_t)Graph.States.size() - 1;
+    return OpenState;
+}
+
+void GASAnimGraphBuilder::Emit(const FGASAnimGraphInstruction& Instruction)
+{
+    if (OpenState < 0)
+    {
+        GAS_LOG_ERROR("AnimGraph: Instruction emitted outside of a state");
+        bHasError = true;
+        return;
+    }
+    Graph.Instructions.push_back(Instruction);
+}
+
+void GASAnimGraphBuilder::PushClip(int32_t Clip)
+{
+    FGASAnimGraphInstruction Instruction;
+    Instruction.Op = EGASAnimGraphOp::Clip;
+    Instruction.First = (uint32_t)Clip;
+    Emit(Instruction);
+}
+
+void GASAnimGraphBuilder::PushBlendSpace1D(int32_t Parameter, const std::vector<FGASBlendSample>& InSamples)
+{
+    FGASAnimGraphInstruction Instruction;
+    Instruction.Op = EGASAnimGraphOp::BlendSpace1D;
+    Instruction.Param0 = (uint16_t)Parameter;
+    Instruction.First = (uint32_t)Graph.Samples.size();
+    Instruction.Count = (uint32_t)InSamples.size();
+
+    // 运行时按位置顺序查找
+    const size_t Offset = Graph.Samples.size();
+    Graph.Samples.insert(Graph.Samples.end(), InSamples.begin(), InSamples.end());
+    std::stable_sort(Graph.Samples.begin() + Offset, Graph.Samples.end(), [](const FGASBlendSample& A, const FGASBlendSample& B) { return A.X < B.X; });
+    Emit(Instruction);
+}
+
+void GASAnimGraphBuilder::PushBlendSpace2D(int32_t ParameterX, int32_t ParameterY, int32_t NumX, int32_t NumY, const std::vector<FGASBlendSample>& InSamples)
+{
+    FGASAnimGraphInstruction Instruction;
+    Instruction.Op = EGASAnimGraphOp::BlendSpace2D;
+    Instruction.Param0 = (uint16_t)ParameterX;
+    Instruction.Param1 = (uint16_t)ParameterY;
+    Instruction.NumX = (uint16_t)NumX;
+    Instruction.NumY = (uint16_t)NumY;
+    Instruction.First = (uint32_t)Graph.Samples.size();
+    Instruction.Count = (uint32_t)InSamples.size();
+    Graph.Samples.insert(Graph.Samples.end(), InSamples.begin(), InSamples.end());
+    Emit(Instruction);
+}
+
+void GASAnimGraphBuilder::Blend(int32_t WeightParameter)
+{
+    FGASAnimGraphInstruction Instruction;
+    Instruction.Op = EGASAnimGraphOp::Blend;
+    Instruction.Param0 = (uint16_t)WeightParameter;
+    Emit(Instruction);
+}
+
+void GASAnimGraphBuilder::Additive(int32_t WeightParameter)
+{
+    FGASAnimGraphInstruction Instruction;
+    Instruction.Op = EGASAnimGraphOp::Additive;
+    Instruction.Param0 = (uint16_t)WeightParameter;
+    Emit(Instruction);
+}
+
+void GASAnimGraphBuilder::EndState()
+{
+    if (OpenState < 0) return;
+    FGASAnimGraphState& State = Graph.States[OpenState];
+    State.NumInstructions = (uint32_t)Graph.Instructions.size() - State.FirstInstruction;
+    OpenState = -1;
+}
+
+void GASAnimGraphBuilder::AddTransition(int32_t FromState, int32_t ToState, EGASAnimGraphCondition Condition, int32_t Parameter, float Threshold, float FadeDuration)
+{
+    FGASAnimGraphTransition Transition;
+    Transition.FromState = FromState;
+    Transition.ToState = ToState;
+    Transition.Condition = Condition;
+    Transition.Parameter = (uint16_t)std::max(Parameter, 0);
+    Transition.Threshold = Threshold;
+    Transition.FadeDuration = std::max(FadeDuration, 0.0f);
+    Graph.Transitions.push_back(Transition);
+
+    if (Condition != EGASAnimGraphCondition::PhaseAbove && Parameter < 0)
+    {
+        GAS_LOG_ERROR("AnimGraph: Transition %d -> %d has no parameter", FromState, ToState);
+        bHasError = true;
+    }
+}
+
+bool GASAnimGraphBuilder::Compile(GASAnimGraph& OutGraph) const
+{
+    if (bHasError || OpenState >= 0 || Graph.States.empty() || Graph.Clips.empty())
+    {
+        GAS_LOG_ERROR("AnimGraph: Compile failed (errors during build, unfinished state or empty graph)");
+        return false;
+    }
+
+    const GASAnimation* FirstClip = Graph.Clips[0];
+    for (const GASAnimation* Clip : Graph.Clips)
+    {
+        if (!Clip || Clip->GetNumFrames() == 0 || !FirstClip || Clip->AnimHeader.TrackCount != FirstClip->AnimHeader.TrackCount)
+        {
+            GAS_LOG_ERROR("AnimGraph: Clips must be valid and share the same track count");
+            return false;
+        }
+    }
+
+    const uint32_t NumParameters = (uint32_t)Graph.ParameterNames.size();
+    const uint32_t NumClips = (uint32_t)Graph.Clips.size();
+    const uint32_t NumStates = (uint32_t)Graph.States.size();
+    int32_t MaxDepth = 0;
+    for (uint32_t s = 0; s < NumStates; ++s)
+    {
+        const FGASAnimGraphState& State = Graph.States[s];
+        int32_t Depth = 0;
+        // 栈中各姿态是否为叠加 (差值) 姿态：叠加姿态只能作为 Additive 的第二个操作数，不能混合或作为状态输出
+        bool bStackAdditive[GAS_ANIM_GRAPH_MAX_STACK + 1] = {};
+        for (uint32_t i = 0; i < State.NumInstructions; ++i)
+        {
+            const FGASAnimGraphInstruction& Instruction = Graph.Instructions[State.FirstInstruction + i];
+            bool bValid = true;
+            bool bAdditive = false;
+            switch (Instruction.Op)
+            {
+            case EGASAnimGraphOp::Clip:
+                bValid = Instruction.First < NumClips;
+                bAdditive = bValid && Graph.Clips[Instruction.First]->IsAdditive();
+                ++Depth;
+                break;
+
+            case EGASAnimGraphOp::BlendSpace1D:
+            case EGASAnimGraphOp::BlendSpace2D:
+            {
+                const bool b2D = Instruction.Op == EGASAnimGraphOp::BlendSpace2D;
+                bValid = Instruction.Count > 0 && Instruction.Param0 < NumParameters
+                    && (!b2D || (Instruction.Param1 < NumParameters && Instruction.NumX > 0 && Instruction.NumY > 0 && (uint32_t)Instruction.NumX * Instruction.NumY == Instruction.Count));
+                for (uint32_t k = 0; bValid && k < Instruction.Count; ++k) bValid = Graph.Samples[Instruction.First + k].Clip < NumClips;
+                // 混合空间的样本须同为普通或同为叠加动画
+                bAdditive = bValid && Graph.Clips[Graph.Samples[Instruction.First].Clip]->IsAdditive();
+                for (uint32_t k = 1; bValid && k < Instruction.Count; ++k) bValid = Graph.Clips[Graph.Samples[Instruction.First + k].Clip]->IsAdditive() == bAdditive;
+                ++Depth;
+                break;
+            }
+
+            case EGASAnimGraphOp::Blend:
+            case EGASAnimGraphOp::Additive:
+            {
+                bValid = Depth >= 2 && Instruction.Param0 < NumParameters;
+                if (bValid)
+                {
+                    const bool bBaseAdditive = bStackAdditive[Depth - 2];
+                    const bool bTopAdditive = bStackAdditive[Depth - 1];
+                    if (Instruction.Op == EGASAnimGraphOp::Additive && (bBaseAdditive || !bTopAdditive))
+                    {
+                        GAS_LOG_ERROR("AnimGraph: State %u instruction %u Additive needs an absolute base pose and an additive clip on top", s, i);
+                        bValid = false;
+                    }
+                    else if (Instruction.Op == EGASAnimGraphOp::Blend && (bBaseAdditive || bTopAdditive))
+                    {
+                        GAS_LOG_ERROR("AnimGraph: State %u instruction %u Blend cannot mix additive clips", s, i);
+                        bValid = false;
+                    }
+                }
+                --Depth;
+                break;
+            }
+            }
+
+            MaxDepth = std::max(MaxDepth, Depth);
+            if (!bValid || Depth > GAS_ANIM_GRAPH_MAX_STACK)
+            {
+                GAS_LOG_ERROR("AnimGraph: State %u instruction %u is invalid", s, i);
+                return false;
+            }
+            bStackAdditive[Depth - 1] = bAdditive;
+        }
+        if (Depth != 1)
+        {
+            GAS_LOG_ERROR("AnimGraph: State %u leaves %d poses on the stack (expected 1)", s, Depth);
+            return false;
+        }
+        if (bStackAdditive[0])
+        {
+            GAS_LOG_ERROR("AnimGraph: State %u outputs an additive pose (apply it with Additive on a base pose)", s);
+            return false;
+        }
+    }
+
+    for (const FGASAnimGraphTransition& Transition : Graph.Transitions)
+    {
+        const bool bValidFrom = Transition.FromState < 0 || (uint32_t)Transition.FromState < NumStates;
+        const bool bValidTo = Transition.ToState >= 0 && (uint32_t)Transition.ToState < NumStates;
+        const bool bValidParameter = Transition.Condition == EGASAnimGraphCondition::PhaseAbove || Transition.Parameter < NumParameters;
+        if (!bValidFrom || !bValidTo || !bValidParameter)
+        {
+            GAS_LOG_ERROR("AnimGraph: Invalid transition %d -> %d", Transition.FromState, Transition.ToState);
+            return false;
+        }
+    }
+
+    OutGraph = Graph;
+    OutGraph.NumBones = (int32_t)FirstClip->AnimHeader.TrackCount;
+    OutGraph.MaxStackDepth = MaxDepth;
+    GAS_LOG("AnimGraph: Compiled %u states, %d instructions, %u clips, stack depth %d", NumStates, (int32_t)Graph.Instructions.size(), NumClips, MaxDepth);
+    return true;
+}
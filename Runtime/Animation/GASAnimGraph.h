@@ -0,0 +1,160 @@
+﻿#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../../Core/Types/GASAsset.h"
+
+// 每个实例的参数个数与状态程序的姿态栈深度上限
+static const int32_t GAS_ANIM_GRAPH_MAX_PARAMETERS = 8;
+static const int32_t GAS_ANIM_GRAPH_MAX_STACK = 8;
+
+// 状态程序指令 (姿态栈机)
+enum class EGASAnimGraphOp : uint16_t
+{
+    Clip = 0,           // 压入 Clips[First]
+    BlendSpace1D = 1,   // 压入按 Param0 在 Samples[First, First + Count) 中插值的姿态 (样本按位置升序)
+    BlendSpace2D = 2,   // 压入按 (Param0, Param1) 在 NumX * NumY 网格样本中双线性插值的姿态 (行优先，X 方向连续)
+    Blend = 3,          // 弹出 B、A，压入 Lerp(A, B, Param0) (A、B 均须为普通姿态)
+    Additive = 4,       // 弹出叠加姿态 D、基础姿态 A，压入 A 叠加 D * Param0 (D 须来自叠加动画，A 须为普通姿态)
+};
+
+// 状态切换条件
+enum class EGASAnimGraphCondition : uint16_t
+{
+    Greater = 0,        // Parameter > Threshold
+    Less = 1,           // Parameter < Threshold
+    PhaseAbove = 2,     // 当前状态的归一化进度 >= Threshold (用于非循环状态播放结束后切出)
+};
+
+struct FGASAnimGraphInstruction
+{
+    EGASAnimGraphOp Op = EGASAnimGraphOp::Clip;
+    uint16_t Param0 = 0;
+    uint16_t Param1 = 0;
+    uint16_t NumX = 0;      // BlendSpace2D 网格尺寸
+    uint16_t NumY = 0;
+    uint16_t Padding = 0;
+    uint32_t First = 0;     // Clip 序号或样本起始位置
+    uint32_t Count = 0;     // 样本数
+};
+
+// 混合空间样本
+struct FGASBlendSample
+{
+    float X = 0.0f;
+    float Y = 0.0f;
+    uint32_t Clip = 0;
+};
+
+struct FGASAnimGraphState
+{
+    uint32_t FirstInstruction = 0;
+    uint32_t NumInstructions = 0;
+    int32_t SyncGroup = -1;     // 同组状态之间切换时延续归一化进度 (如走/跑脚步对齐)，-1 不同步
+    bool bLooping = true;
+};
+
+struct FGASAnimGraphTransition
+{
+    int32_t FromState = -1;     // -1 表示任意状态
+    int32_t ToState = 0;
+    EGASAnimGraphCondition Condition = EGASAnimGraphCondition::Greater;
+    uint16_t Parameter = 0;
+    float Threshold = 0.0f;
+    float FadeDuration = 0.2f;  // 交叉淡化时长 (秒)，0 为立即切换
+};
+
+// 实例状态：纯 POD，数千个实例可放在连续数组中，由同一个 GASAnimGraph 驱动
+// 状态内所有片段按同一归一化进度 (Phase) 同步播放
+struct FGASAnimGraphInstance
+{
+    float Parameters[GAS_ANIM_GRAPH_MAX_PARAMETERS];
+    int16_t CurrentState;
+    int16_t PreviousState;      // 交叉淡化的来源状态，-1 表示没有淡化
+    float CurrentPhase;
+    float PreviousPhase;
+    float FadeElapsed;
+    float FadeDuration;
+};
+
+// 求值用的临时姿态，每个线程一份，由 GASAnimGraph::InitContext 一次分配，求值期间不再分配
+struct FGASAnimGraphContext
+{
+    std::vector<FGASTransform> Poses;
+    int32_t NumBones = 0;
+};
+
+// 编译后的动画图：状态机 + 每个状态一段平坦的姿态栈指令，只读，可被任意多实例与线程共享
+// 每帧先 Advance (只更新实例状态，不采样姿态，可用于未到期的更新频率 LOD 实例)，需要姿态时再 Evaluate
+class GASAnimGraph
+{
+public:
+    // 用默认参数初始化实例，进入第 0 个状态
+    void InitInstance(FGASAnimGraphInstance& Instance) const;
+
+    void InitContext(FGASAnimGraphContext& Context) const;
+
+    // 检查状态切换 (每帧至多一次，按添加顺序取第一个满足的) 并推进进度
+    // 淡化过程中再次切换时丢弃原来的来源状态，从当前状态重新淡化
+    void Advance(FGASAnimGraphInstance& Instance, float DeltaTime) const;
+
+    // 批量推进 (实例连续存放)
+    void AdvanceBatch(FGASAnimGraphInstance* Instances, int32_t NumInstances, float DeltaTime) const;
+
+    // 求当前姿态，OutPose 长度为 GetNumBones()
+    bool Evaluate(const FGASAnimGraphInstance& Instance, FGASAnimGraphContext& Context, FGASTransform* OutPose) const;
+
+    int32_t GetNumBones() const { return NumBones; }
+    int32_t GetNumStates() const { return (int32_t)States.size(); }
+    int32_t FindParameter(const std::string& Name) const;
+
+    // 状态在当前参数下的时长 (各片段循环周期按混合权重加权)
+    float GetStateLength(int32_t State, const FGASAnimGraphInstance& Instance) const;
+
+private:
+    friend class GASAnimGraphBuilder;
+
+    const FGASTransform* EvaluateState(int32_t State, float Phase, const FGASAnimGraphInstance& Instance, FGASAnimGraphContext& Context) const;
+    void SampleClip(uint32_t Clip, float Phase, FGASTransform* OutPose) const;
+
+    std::vector<FGASAnimGraphInstruction> Instructions;
+    std::vector<FGASBlendSample> Samples;
+    std::vector<FGASAnimGraphState> States;
+    std::vector<FGASAnimGraphTransition> Transitions;
+    std::vector<const GASAnimation*> Clips;
+
+    std::vector<std::string> ParameterNames;
+    float DefaultParameters[GAS_ANIM_GRAPH_MAX_PARAMETERS] = {};
+
+    int32_t NumBones = 0;
+    int32_t MaxStackDepth = 0;
+};
+
+// 构建动画图：状态内按后缀表达式压入姿态 (Clip/混合空间) 并组合 (Blend/Additive)，每个状态最终恰好留下一个普通姿态
+class GASAnimGraphBuilder
+{
+public:
+    int32_t AddParameter(const std::string& Name, float DefaultValue = 0.0f);
+    int32_t AddClip(const GASAnimation* Animation);
+
+    // 返回状态序号，第 0 个状态为入口状态
+    int32_t BeginState(bool bLooping = true, int32_t SyncGroup = -1);
+    void PushClip(int32_t Clip);
+    void PushBlendSpace1D(int32_t Parameter, const std::vector<FGASBlendSample>& InSamples);
+    void PushBlendSpace2D(int32_t ParameterX, int32_t ParameterY, int32_t NumX, int32_t NumY, const std::vector<FGASBlendSample>& InSamples);
+    void Blend(int32_t WeightParameter);
+    void Additive(int32_t WeightParameter);
+    void EndState();
+
+    void AddTransition(int32_t FromState, int32_t ToState, EGASAnimGraphCondition Condition, int32_t Parameter, float Threshold, float FadeDuration = 0.2f);
+
+    // 校验栈深度、片段轨道数、参数与样本范围，成功后 Builder 可继续复用
+    bool Compile(GASAnimGraph& OutGraph) const;
+
+private:
+    void Emit(const FGASAnimGraphInstruction& Instruction);
+
+    GASAnimGraph Graph;
+    int32_t OpenState = -1;
+    bool bHasError = false;
+};
@@ -0,0 +1,253 @@
+﻿#include "GASIKSolver.h"
+#include <algorithm>
+#include <cmath>
+#include "../../Core/Utils/GASMath.h"
+#include "../../Core/Utils/GASLogging.h"
+
+// FABRIK 每次处理的实例数 (骨骼长度缓存在栈上)
+static const int32_t FABRIK_BLOCK_SIZE = 64;
+
+static const float IK_EPSILON = 1e-6f;
+
+static FGASVector3 MultiplyComponents(const FGASVector3& A, const FGASVector3& B)
+{
+    return FGASVector3(A.X * B.X, A.Y * B.Y, A.Z * B.Z);
+}
+
+// 把 From 方向转到 To 方向的最小旋转
+static FGASQuaternion RotationBetween(const FGASVector3& From, const FGASVector3& To)
+{
+    const FGASVector3 U = GASMath::Normalize(From);
+    const FGASVector3 V = GASMath::Normalize(To);
+    const float W = 1.0f + GASMath::Dot(U, V);
+    if (W < IK_EPSILON)
+    {
+        // 反向：绕任一垂直轴转 180 度
+        FGASVector3 Axis = GASMath::Cross(FGASVector3(1.0f, 0.0f, 0.0f), U);
+        if (GASMath::LengthSq(Axis) < IK_EPSILON) Axis = GASMath::Cross(FGASVector3(0.0f, 1.0f, 0.0f), U);
+        Axis = GASMath::Normalize(Axis);
+        return FGASQuaternion(Axis.X, Axis.Y, Axis.Z, 0.0f);
+    }
+    const FGASVector3 Axis = GASMath::Cross(U, V);
+    return GASMath::Normalize(FGASQuaternion(Axis.X, Axis.Y, Axis.Z, W));
+}
+
+bool GASIKSolver::ComputeModelPose(const GASSkeleton* Skeleton, const FGASTransform* LocalPose, FGASTransform* OutModelPose)
+{
+    if (!Skeleton || !LocalPose || !OutModelPose) return false;
+
+    const int32_t NumBones = Skeleton->GetNumBones();
+    for (int32_t b = 0; b < NumBones; ++b)
+    {
+        const int32_t Parent = Skeleton->GetParentIndex(b);
+        if (Parent >= b)
+        {
+            GAS_LOG_ERROR("ComputeModelPose: Skeleton is not parent-first (bone %d)", b);
+            return false;
+        }
+        if (Parent < 0)
+        {
+            OutModelPose[b] = LocalPose[b];
+            continue;
+        }
+
+        const FGASTransform& P = OutModelPose[Parent];
+        const FGASTransform& L = LocalPose[b];
+        FGASTransform& Out = OutModelPose[b];
+        Out.Translation = GASMath::Add(P.Translation, GASMath::RotateVector(P.Rotation, MultiplyComponents(P.Scale, L.Translation)));
+        Out.Rotation = GASMath::Multiply(P.Rotation, L.Rotation);
+        Out.Scale = MultiplyComponents(P.Scale, L.Scale);
+    }
+    return true;
+}
+
+bool GASIKSolver::FindChain(const GASSkeleton* Skeleton, const std::string& RootBone, const std::string& EndBone, FGASIKChain& OutChain)
+{
+    if (!Skeleton) return false;
+
+    const int32_t Root = Skeleton->FindBoneIndex(RootBone);
+    int32_t Bone = Skeleton->FindBoneIndex(EndBone);
+    if (Root < 0 || Bone < 0)
+    {
+        GAS_LOG_ERROR("FindChain: Bone %s or %s not found in %s", RootBone.c_str(), EndBone.c_str(), Skeleton->AssetName.c_str());
+        return false;
+    }
+
+    int32_t Reversed[GAS_IK_MAX_CHAIN];
+    int32_t Count = 0;
+    while (Bone >= 0 && Count < GAS_IK_MAX_CHAIN)
+    {
+        Reversed[Count++] = Bone;
+        if (Bone == Root) break;
+        Bone = Skeleton->GetParentIndex(Bone);
+    }
+    if (Reversed[Count - 1] != Root || Count < 2)
+    {
+        GAS_LOG_ERROR("FindChain: %s is not an ancestor of %s within %d bones", RootBone.c_str(), EndBone.c_str(), GAS_IK_MAX_CHAIN);
+        return false;
+    }
+
+    OutChain.NumBones = Count;
+    for (int32_t i = 0; i < Count; ++i) OutChain.Bones[i] = Reversed[Count - 1 - i];
+    return true;
+}
+
+void GASIKSolver::SolveTwoBoneBatch(const FGASTwoBoneIKBatch& Batch)
+{
+    const bool bHasPole = Batch.Pole.X != nullptr;
+
+    // 逐实例无分支 (只有选择与钳制)，便于编译器跨实例向量化
+    for (int32_t i = 0; i < Batch.NumInstances; ++i)
+    {
+        const float Ax = Batch.Root.X[i], Ay = Batch.Root.Y[i], Az = Batch.Root.Z[i];
+        const float Bx = Batch.Mid.X[i], By = Batch.Mid.Y[i], Bz = Batch.Mid.Z[i];
+        const float Cx = Batch.End.X[i], Cy = Batch.End.Y[i], Cz = Batch.End.Z[i];
+
+        const float UpperX = Bx - Ax, UpperY = By - Ay, UpperZ = Bz - Az;
+        const float LowerX = Cx - Bx, LowerY = Cy - By, LowerZ = Cz - Bz;
+        const float UpperLength = std::sqrt(UpperX * UpperX + UpperY * UpperY + UpperZ * UpperZ);
+        const float LowerLength = std::sqrt(LowerX * LowerX + LowerY * LowerY + LowerZ * LowerZ);
+
+        // 目标距离钳制在可达范围内，留一点余量保持弯曲平面有定义
+        float Tx = Batch.Target.X[i] - Ax, Ty = Batch.Target.Y[i] - Ay, Tz = Batch.Target.Z[i] - Az;
+        const float TargetLength = std::sqrt(Tx * Tx + Ty * Ty + Tz * Tz);
+        const float InvTarget = 1.0f / std::max(TargetLength, IK_EPSILON);
+        Tx *= InvTarget; Ty *= InvTarget; Tz *= InvTarget;
+        const float Reach = std::min(std::max(TargetLength, std::fabs(UpperLength - LowerLength) + 1e-4f), (UpperLength + LowerLength) * 0.9999f);
+
+        // 弯曲方向：参考点 (或当前中间关节) 去掉沿目标方向的分量
+        float Px = bHasPole ? Batch.Pole.X[i] - Ax : UpperX;
+        float Py = bHasPole ? Batch.Pole.Y[i] - Ay : UpperY;
+        float Pz = bHasPole ? Batch.Pole.Z[i] - Az : UpperZ;
+        const float Along = Px * Tx + Py * Ty + Pz * Tz;
+        Px -= Tx * Along; Py -= Ty * Along; Pz -= Tz * Along;
+        const float InvBend = 1.0f / std::max(std::sqrt(Px * Px + Py * Py + Pz * Pz), IK_EPSILON);
+        Px *= InvBend; Py *= InvBend; Pz *= InvBend;
+
+        // 余弦定理求根关节处夹角
+        const float CosAngle = std::min(std::max((UpperLength * UpperLength + Reach * Reach - LowerLength * LowerLength)
+            / std::max(2.0f * UpperLength * Reach, IK_EPSILON), -1.0f), 1.0f);
+        const float SinAngle = std::sqrt(std::max(1.0f - CosAngle * CosAngle, 0.0f));
+        const float Forward = UpperLength * CosAngle, Side = UpperLength * SinAngle;
+
+        const float W = Batch.Weight ? Batch.Weight[i] : 1.0f;
+        const float NewBx = Ax + Tx * Forward + Px * Side, NewBy = Ay + Ty * Forward + Py * Side, NewBz = Az + Tz * Forward + Pz * Side;
+        const float NewCx = Ax + Tx * Reach, NewCy = Ay + Ty * Reach, NewCz = Az + Tz * Reach;
+        Batch.Mid.X[i] = Bx + (NewBx - Bx) * W;
+        Batch.Mid.Y[i] = By + (NewBy - By) * W;
+        Batch.Mid.Z[i] = Bz + (NewBz - Bz) * W;
+        Batch.End.X[i] = Cx + (NewCx - Cx) * W;
+        Batch.End.Y[i] = Cy + (NewCy - Cy) * W;
+        Batch.End.Z[i] = Cz + (NewCz - Cz) * W;
+    }
+}
+
+// P[Joint] = Anchor + (P[Joint] - Anchor) * Length / |P[Joint] - Anchor|，对 Count 个实例
+static void PlaceJoints(float* X, float* Y, float* Z, const float* AnchorX, const float* AnchorY, const float* AnchorZ, const float* Length, int32_t Count)
+{
+    for (int32_t k = 0; k < Count; ++k)
+    {
+        const float Dx = X[k] - AnchorX[k], Dy = Y[k] - AnchorY[k], Dz = Z[k] - AnchorZ[k];
+        const float Scale = Length[k] / std::max(std::sqrt(Dx * Dx + Dy * Dy + Dz * Dz), IK_EPSILON);
+        X[k] = AnchorX[k] + Dx * Scale;
+        Y[k] = AnchorY[k] + Dy * Scale;
+        Z[k] = AnchorZ[k] + Dz * Scale;
+    }
+}
+
+void GASIKSolver::SolveFabrikBatch(const FGASFabrikBatch& Batch)
+{
+    const int32_t NumJoints = Batch.NumJoints;
+    const int32_t Stride = Batch.NumInstances;
+    if (NumJoints < 2 || NumJoints > GAS_IK_MAX_CHAIN || !Batch.Positions) return;
+
+    float Lengths[GAS_IK_MAX_CHAIN - 1][FABRIK_BLOCK_SIZE];
+    float RootX[FABRIK_BLOCK_SIZE], RootY[FABRIK_BLOCK_SIZE], RootZ[FABRIK_BLOCK_SIZE];
+
+    for (int32_t Base = 0; Base < Batch.NumInstances; Base += FABRIK_BLOCK_SIZE)
+    {
+        const int32_t Count = std::min(FABRIK_BLOCK_SIZE, Batch.NumInstances - Base);
+        auto Axis = [&](int32_t Joint, int32_t Component) { return Batch.Positions + (size_t)(Joint * 3 + Component) * Stride + Base; };
+
+        for (int32_t j = 0; j + 1 < NumJoints; ++j)
+        {
+            const float* X0 = Axis(j, 0); const float* Y0 = Axis(j, 1); const float* Z0 = Axis(j, 2);
+            const float* X1 = Axis(j + 1, 0); const float* Y1 = Axis(j + 1, 1); const float* Z1 = Axis(j + 1, 2);
+            for (int32_t k = 0; k < Count; ++k)
+            {
+                const float Dx = X1[k] - X0[k], Dy = Y1[k] - Y0[k], Dz = Z1[k] - Z0[k];
+                Lengths[j][k] = std::sqrt(Dx * Dx + Dy * Dy + Dz * Dz);
+            }
+        }
+        std::copy(Axis(0, 0), Axis(0, 0) + Count, RootX);
+        std::copy(Axis(0, 1), Axis(0, 1) + Count, RootY);
+        std::copy(Axis(0, 2), Axis(0, 2) + Count, RootZ);
+
+        const int32_t End = NumJoints - 1;
+        for (int32_t Iteration = 0; Iteration < Batch.NumIterations; ++Iteration)
+        {
+            // 由末端向根：末端放到目标，其余关节依次保持骨骼长度
+            std::copy(Batch.Target.X + Base, Batch.Target.X + Base + Count, Axis(End, 0));
+            std::copy(Batch.Target.Y + Base, Batch.Target.Y + Base + Count, Axis(End, 1));
+            std::copy(Batch.Target.Z + Base, Batch.Target.Z + Base + Count, Axis(End, 2));
+            for (int32_t j = End - 1; j >= 0; --j)
+            {
+                PlaceJoints(Axis(j, 0), Axis(j, 1), Axis(j, 2), Axis(j + 1, 0), Axis(j + 1, 1), Axis(j + 1, 2), Lengths[j], Count);
+            }
+
+            // 由根向末端：根放回原位
+            std::copy(RootX, RootX + Count, Axis(0, 0));
+            std::copy(RootY, RootY + Count, Axis(0, 1));
+            std::copy(RootZ, RootZ + Count, Axis(0, 2));
+            for (int32_t j = 1; j <= End; ++j)
+            {
+                PlaceJoints(Axis(j, 0), Axis(j, 1), Axis(j, 2), Axis(j - 1, 0), Axis(j - 1, 1), Axis(j - 1, 2), Lengths[j - 1], Count);
+            }
+        }
+    }
+}
+
+void GASIKSolver::ApplyChain(const GASSkeleton* Skeleton, const FGASIKChain& Chain, const FGASVector3* Solved, bool bKeepEndRotation,
+    FGASTransform* LocalPose, FGASTransform* ModelPose)
+{
+    if (!Skeleton || Chain.NumBones < 2 || !Solved) return;
+
+    const int32_t RootParent = Skeleton->GetParentIndex(Chain.Bones[0]);
+    FGASQuaternion ParentRotation = RootParent >= 0 ? ModelPose[RootParent].Rotation : GASMath::IdentityQuat();
+
+    for (int32_t j = 0; j < Chain.NumBones; ++j)
+    {
+        const int32_t Bone = Chain.Bones[j];
+        FGASTransform& Model = ModelPose[Bone];
+
+        // 父关节已转动后的当前朝向与位置
+        const FGASQuaternion OldRotation = Model.Rotation;
+        FGASQuaternion Rotation = GASMath::Multiply(ParentRotation, LocalPose[Bone].Rotation);
+        if (j > 0)
+        {
+            const FGASTransform& ParentModel = ModelPose[Chain.Bones[j - 1]];
+            Model.Translation = GASMath::Add(ParentModel.Translation, GASMath::RotateVector(ParentRotation, MultiplyComponents(ParentModel.Scale, LocalPose[Bone].Translation)));
+        }
+
+        if (j + 1 < Chain.NumBones)
+        {
+            // 当前指向子关节的方向转到求解后的方向
+            const FGASVector3 ChildOffset = MultiplyComponents(Model.Scale, LocalPose[Chain.Bones[j + 1]].Translation);
+            const FGASVector3 Current = GASMath::RotateVector(Rotation, ChildOffset);
+            const FGASVector3 Desired = GASMath::Subtract(Solved[j + 1], Model.Translation);
+            if (GASMath::LengthSq(Current) > IK_EPSILON && GASMath::LengthSq(Desired) > IK_EPSILON)
+            {
+                Rotation = GASMath::Multiply(RotationBetween(Current, Desired), Rotation);
+            }
+        }
+        else if (bKeepEndRotation)
+        {
+            Rotation = OldRotation;
+        }
+
+        Rotation = GASMath::Normalize(Rotation);
+        LocalPose[Bone].Rotation = GASMath::Normalize(GASMath::Multiply(GASMath::Conjugate(ParentRotation), Rotation));
+        Model.Rotation = Rotation;
+        ParentRotation = Rotation;
+    }
+}
@@ -0,0 +1,67 @@
+﻿#pragma once
+#include <cstdint>
+#include <string>
+#include "../../Core/Types/GASAsset.h"
+
+// IK 链最多关节数
+static const int32_t GAS_IK_MAX_CHAIN = 8;
+
+// IK 链：Bones[0] 为链根，Bones[i + 1] 的父骨骼为 Bones[i]
+struct FGASIKChain
+{
+    int32_t Bones[GAS_IK_MAX_CHAIN] = {};
+    int32_t NumBones = 0;
+};
+
+// SoA 向量数组：第 i 个实例为 (X[i], Y[i], Z[i])
+struct FGASVector3SoA
+{
+    float* X = nullptr;
+    float* Y = nullptr;
+    float* Z = nullptr;
+};
+
+// 两骨骼 IK 批次 (大腿-小腿-脚 / 上臂-前臂-手)，全部为模型空间位置
+struct FGASTwoBoneIKBatch
+{
+    int32_t NumInstances = 0;
+    FGASVector3SoA Root;        // 输入
+    FGASVector3SoA Mid;         // 输入，输出求解后的位置
+    FGASVector3SoA End;         // 输入，输出求解后的位置
+    FGASVector3SoA Target;      // 输入
+    FGASVector3SoA Pole;        // 膝/肘朝向的参考点，Pole.X 为空时沿用当前弯曲方向
+    const float* Weight = nullptr;  // 每实例权重 [0, 1]，为空视为 1
+};
+
+// FABRIK 批次：关节位置按 [(Joint * 3 + Axis) * NumInstances + Instance] 排列 (Axis 0/1/2 = X/Y/Z)，原地求解
+// 迭代次数固定 (无逐实例提前退出)，保证内层循环可跨实例向量化
+struct FGASFabrikBatch
+{
+    int32_t NumInstances = 0;
+    int32_t NumJoints = 0;
+    float* Positions = nullptr;
+    FGASVector3SoA Target;
+    int32_t NumIterations = 8;
+};
+
+// 姿态采样之后的 IK 后处理：
+// 1. ComputeModelPose 求模型空间姿态，按链把关节位置收集成 SoA 批次
+// 2. SolveTwoBoneBatch / SolveFabrikBatch 跨实例求解关节位置 (同一种求解器，无分支的内层循环)
+// 3. ApplyChain 把每个实例求得的位置折算回局部旋转 (骨骼长度不变)
+class GASIKSolver
+{
+public:
+    // 局部姿态 -> 模型空间姿态，骨骼须父先子后
+    static bool ComputeModelPose(const GASSkeleton* Skeleton, const FGASTransform* LocalPose, FGASTransform* OutModelPose);
+
+    // 沿父骨骼由 EndBone 向上找到 RootBone 构成链
+    static bool FindChain(const GASSkeleton* Skeleton, const std::string& RootBone, const std::string& EndBone, FGASIKChain& OutChain);
+
+    static void SolveTwoBoneBatch(const FGASTwoBoneIKBatch& Batch);
+    static void SolveFabrikBatch(const FGASFabrikBatch& Batch);
+
+    // 由求解后的关节位置 (链顺序，Solved[0] 为链根) 逐关节求最小转角，写回局部旋转并更新链上的模型空间姿态
+    // bKeepEndRotation 时末端保持原模型空间朝向 (如脚掌不随腿转动)；链外子骨骼的模型空间姿态需重新计算
+    static void ApplyChain(const GASSkeleton* Skeleton, const FGASIKChain& Chain, const FGASVector3* Solved, bool bKeepEndRotation,
+        FGASTransform* LocalPose, FGASTransform* ModelPose);
+};
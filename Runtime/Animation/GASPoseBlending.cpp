@@ -0,0 +1,108 @@
+﻿#include "GASPoseBlending.h"
+#include <algorithm>
+#include <cmath>
+#include "../../Core/Utils/GASMath.h"
+#include "../../Core/Utils/GASSimdMath.h"
+#include "../../Core/Utils/GASLogging.h"
+
+// 权重低于该值的骨骼直接取基础姿态
+static const float BLEND_WEIGHT_EPSILON = 1e-4f;
+
+static FGASQuaternion BlendRotation(const FGASQuaternion& A, const FGASQuaternion& B, float Alpha)
+{
+    FGASQuaternion Out;
+    GASSimd::StoreQuat(Out, GASSimd::QuatNlerp(GASSimd::LoadQuat(A), GASSimd::LoadQuat(B), Alpha));
+    return Out;
+}
+
+static FGASQuaternion AddRotation(const FGASQuaternion& Base, const FGASQuaternion& Delta, float Alpha)
+{
+    const FGASVectorRegister Scaled = GASSimd::QuatNlerp(GASSimd::VectorSet(0.0f, 0.0f, 0.0f, 1.0f), GASSimd::LoadQuat(Delta), Alpha);
+    FGASQuaternion Out;
+    GASSimd::StoreQuat(Out, GASSimd::QuatNormalize(GASSimd::QuatMultiply(GASSimd::LoadQuat(Base), Scaled)));
+    return Out;
+}
+
+static inline FGASVector3 LerpVector(const FGASVector3& A, const FGASVector3& B, float Alpha)
+{
+    return FGASVector3(A.X + (B.X - A.X) * Alpha, A.Y + (B.Y - A.Y) * Alpha, A.Z + (B.Z - A.Z) * Alpha);
+}
+
+bool GASPoseBlending::BuildBoneMask(const GASSkeleton* Skeleton, const std::vector<std::pair<std::string, float>>& Branches, std::vector<float>& OutMask)
+{
+    if (!Skeleton) return false;
+
+    const int32_t NumBones = Skeleton->GetNumBones();
+    std::vector<float> BranchWeight(NumBones, -1.0f);
+    for (const auto& Branch : Branches)
+    {
+        const int32_t Bone = Skeleton->FindBoneIndex(Branch.first);
+        if (Bone < 0)
+        {
+            GAS_LOG_WARN("BuildBoneMask: Bone %s not found in %s", Branch.first.c_str(), Skeleton->AssetName.c_str());
+            continue;
+        }
+        BranchWeight[Bone] = std::min(std::max(Branch.second, 0.0f), 1.0f);
+    }
+
+    // 父先子后，一次前向遍历即可把分支权重传给整棵子树
+    OutMask.assign(NumBones, 0.0f);
+    for (int32_t b = 0; b < NumBones; ++b)
+    {
+        const int32_t Parent = Skeleton->GetParentIndex(b);
+        if (Parent >= b)
+        {
+            GAS_LOG_ERROR("BuildBoneMask: Skeleton %s is not parent-first (bone %d)", Skeleton->AssetName.c_str(), b);
+            return false;
+        }
+        if (BranchWeight[b] >= 0.0f) OutMask[b] = BranchWeight[b];
+        else if (Parent >= 0) OutMask[b] = OutMask[Parent];
+    }
+    return true;
+}
+
+void GASPoseBlending::BlendLayer(const FGASTransform* Base, const FGASTransform* Layer, float Weight, const float* BoneMask, int32_t NumBones, FGASTransform* OutPose)
+{
+    for (int32_t b = 0; b < NumBones; ++b)
+    {
+        const float Alpha = BoneMask ? Weight * BoneMask[b] : Weight;
+        if (Alpha <= BLEND_WEIGHT_EPSILON)
+        {
+            OutPose[b] = Base[b];
+            continue;
+        }
+        if (Alpha >= 1.0f - BLEND_WEIGHT_EPSILON)
+        {
+            OutPose[b] = Layer[b];
+            continue;
+        }
+
+        const FGASTransform& From = Base[b];
+        const FGASTransform& To = Layer[b];
+        FGASTransform& Out = OutPose[b];
+        Out.Translation = LerpVector(From.Translation, To.Translation, Alpha);
+        Out.Scale = LerpVector(From.Scale, To.Scale, Alpha);
+        Out.Rotation = BlendRotation(From.Rotation, To.Rotation, Alpha);
+    }
+}
+
+void GASPoseBlending::ApplyAdditive(const FGASTransform* Base, const FGASTransform* Additive, float Weight, const float* BoneMask, int32_t NumBones, FGASTransform* OutPose)
+{
+    for (int32_t b = 0; b < NumBones; ++b)
+    {
+        const float Alpha = BoneMask ? Weight * BoneMask[b] : Weight;
+        if (Alpha <= BLEND_WEIGHT_EPSILON)
+        {
+            OutPose[b] = Base[b];
+            continue;
+        }
+
+        const FGASTransform& From = Base[b];
+        const FGASTransform& Delta = Additive[b];
+        FGASTransform& Out = OutPose[b];
+        Out.Translation = GASMath::Add(From.Translation, GASMath::Scale(Delta.Translation, Alpha));
+        const FGASVector3 DeltaScale = LerpVector(FGASVector3(1.0f, 1.0f, 1.0f), Delta.Scale, Alpha);
+        Out.Scale = FGASVector3(From.Scale.X * DeltaScale.X, From.Scale.Y * DeltaScale.Y, From.Scale.Z * DeltaScale.Z);
+        Out.Rotation = AddRotation(From.Rotation, Delta.Rotation, Alpha);
+    }
+}
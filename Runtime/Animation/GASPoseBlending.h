@@ -0,0 +1,24 @@
+﻿#pragma once
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../../Core/Types/GASAsset.h"
+
+// 姿态分层混合：覆盖层按骨骼遮罩混合，叠加层 (GASAdditiveBuilder 生成的差值) 按权重叠加
+// 姿态为按骨骼顺序排列的局部变换数组；BoneMask 为逐骨骼权重 [0, 1]，为空时视为全身 1
+// 旋转走 GASSimd (四元数 nlerp / 乘法)，平移与缩放为标量
+class GASPoseBlending
+{
+public:
+    // 由分支构建骨骼遮罩：每个 (骨骼名, 权重) 作用于该骨骼及其整棵子树，子树内再出现的分支覆盖父分支
+    // 未被任何分支覆盖的骨骼为 0；骨骼须父先子后
+    static bool BuildBoneMask(const GASSkeleton* Skeleton, const std::vector<std::pair<std::string, float>>& Branches, std::vector<float>& OutMask);
+
+    // 覆盖混合：Out = Lerp(Base, Layer, Weight * Mask)，Out 可与 Base 相同
+    static void BlendLayer(const FGASTransform* Base, const FGASTransform* Layer, float Weight, const float* BoneMask, int32_t NumBones, FGASTransform* OutPose);
+
+    // 叠加：平移 += w * dT，旋转 = Base * Nlerp(Identity, dR, w)，缩放 *= Lerp(1, dS, w)，w = Weight * Mask
+    // Out 可与 Base 相同
+    static void ApplyAdditive(const FGASTransform* Base, const FGASTransform* Additive, float Weight, const float* BoneMask, int32_t NumBones, FGASTransform* OutPose);
+};
@@ -0,0 +1,60 @@
+﻿#include "GASPoseSampler.h"
+#include <algorithm>
+#include <cmath>
+#include "../../Core/Utils/GASMath.h"
+
+float GASPoseSampler::GetLoopLength(const GASAnimation* Animation)
+{
+    if (!Animation || Animation->GetNumFrames() < 2 || Animation->AnimHeader.FrameRate <= 0.0f) return 0.0f;
+    return (float)(Animation->GetNumFrames() - 1) / Animation->AnimHeader.FrameRate;
+}
+
+bool GASPoseSampler::TimeToFrame(const GASAnimation* Animation, float Time, bool bLooping, FGASFramePosition& OutPosition)
+{
+    if (!Animation || Animation->GetNumFrames() == 0) return false;
+
+    const float LastFrame = (float)(Animation->GetNumFrames() - 1);
+    float Frame = Time * Animation->AnimHeader.FrameRate;
+    if (bLooping && LastFrame > 0.0f)
+    {
+        Frame = std::fmod(Frame, LastFrame);
+        if (Frame < 0.0f) Frame += LastFrame;
+    }
+    Frame = std::min(std::max(Frame, 0.0f), LastFrame);
+
+    OutPosition.Frame0 = (int32_t)Frame;
+    OutPosition.Frame1 = std::min(OutPosition.Frame0 + 1, Animation->GetNumFrames() - 1);
+    OutPosition.Alpha = Frame - (float)OutPosition.Frame0;
+    return true;
+}
+
+bool GASPoseSampler::SamplePose(const GASAnimation* Animation, float Time, bool bLooping, FGASTransform* OutPose)
+{
+    FGASFramePosition Position;
+    if (!OutPose || !TimeToFrame(Animation, Time, bLooping, Position)) return false;
+
+    // 一帧的所有轨道连续存放
+    const int32_t NumTracks = (int32_t)Animation->AnimHeader.TrackCount;
+    const FGASTransform* Pose0 = Animation->GetTransform(Position.Frame0, 0);
+    if (Position.Alpha <= 0.0f || Position.Frame1 == Position.Frame0)
+    {
+        std::copy(Pose0, Pose0 + NumTracks, OutPose);
+        return true;
+    }
+    InterpolatePose(Pose0, Animation->GetTransform(Position.Frame1, 0), Position.Alpha, NumTracks, OutPose);
+    return true;
+}
+
+void GASPoseSampler::InterpolatePose(const FGASTransform* A, const FGASTransform* B, float Alpha, int32_t NumBones, FGASTransform* OutPose)
+{
+    const float InvAlpha = 1.0f - Alpha;
+    for (int32_t b = 0; b < NumBones; ++b)
+    {
+        const FGASTransform& From = A[b];
+        const FGASTransform& To = B[b];
+        FGASTransform& Out = OutPose[b];
+        Out.Translation = GASMath::Add(GASMath::Scale(From.Translation, InvAlpha), GASMath::Scale(To.Translation, Alpha));
+        Out.Scale = GASMath::Add(GASMath::Scale(From.Scale, InvAlpha), GASMath::Scale(To.Scale, Alpha));
+        Out.Rotation = GASMath::Slerp(From.Rotation, To.Rotation, Alpha);
+    }
+}
@@ -0,0 +1,29 @@
+﻿#pragma once
+#include <cstdint>
+#include "../../Core/Types/GASAsset.h"
+
+// 时间在动画中的位置：Frame0 与 Frame1 之间按 Alpha 插值
+struct FGASFramePosition
+{
+    int32_t Frame0 = 0;
+    int32_t Frame1 = 0;
+    float Alpha = 0.0f;
+};
+
+// 动画采样：时间 -> 帧位置 -> 局部姿态
+// 循环周期为 (FrameCount - 1) / FrameRate，与 VAT 片段采样一致
+class GASPoseSampler
+{
+public:
+    // 循环周期 (秒)，单帧动画为 0
+    static float GetLoopLength(const GASAnimation* Animation);
+
+    // 时间 -> 帧位置 (非循环时钳制到首尾帧)
+    static bool TimeToFrame(const GASAnimation* Animation, float Time, bool bLooping, FGASFramePosition& OutPosition);
+
+    // 采样 Time 时刻的局部姿态，OutPose 长度为轨道数
+    static bool SamplePose(const GASAnimation* Animation, float Time, bool bLooping, FGASTransform* OutPose);
+
+    // 两个姿态逐骨骼插值 (平移/缩放线性，旋转球面)，Out 可与 A 或 B 相同
+    static void InterpolatePose(const FGASTransform* A, const FGASTransform* B, float Alpha, int32_t NumBones, FGASTransform* OutPose);
+};
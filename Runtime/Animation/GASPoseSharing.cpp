@@ -0,0 +1,146 @@
+﻿#include "GASPoseSharing.h"
+#include <algorithm>
+#include <cmath>
+#include "GASPoseSampler.h"
+#include "../../Core/Utils/GASLogging.h"
+
+size_t GASPoseSharing::FPoseKeyHash::operator()(const FPoseKey& Key) const
+{
+    uint64_t Hash = (uint64_t)(uintptr_t)Key.Animation * 0x9E3779B97F4A7C15ULL;
+    Hash ^= (uint64_t)(uintptr_t)Key.Skeleton + 0x7F4A7C159E3779B9ULL + (Hash << 6) + (Hash >> 2);
+    Hash ^= (uint64_t)Key.Bucket * 0xC2B2AE3D27D4EB4FULL;
+    return (size_t)(Hash ^ (Hash >> 29));
+}
+
+GASPoseSharing::GASPoseSharing(const FGASPoseSharingSettings& InSettings)
+    : Settings(InSettings)
+{
+    if (Settings.TimeTolerance <= 0.0f)
+    {
+        GAS_LOG_WARN("GASPoseSharing: TimeTolerance must be positive, using 1/60 s");
+        Settings.TimeTolerance = 1.0f / 60.0f;
+    }
+}
+
+void GASPoseSharing::BeginFrame()
+{
+    ++FrameIndex;
+
+    for (auto It = PoseMap.begin(); It != PoseMap.end();)
+    {
+        const FGASSharedPose& Pose = Poses[It->second];
+        if (Pose.LastUsedFrame + Settings.MaxIdleFrames < FrameIndex)
+        {
+            FreeSlots.push_back(It->second);
+            It = PoseMap.erase(It);
+        }
+        else
+        {
+            ++It;
+        }
+    }
+
+    Stats = FGASPoseSharingStats();
+    Stats.NumCachedPoses = (uint32_t)PoseMap.size();
+}
+
+const FGASSharedPose* GASPoseSharing::Acquire(const GASSkeleton* Skeleton, const GASAnimation* Animation, float Time, bool bLooping)
+{
+    if (!Skeleton || !Animation) return nullptr;
+    ++Stats.NumRequests;
+
+    // 时间 -> 桶：循环动画先折回一个周期，末尾的桶与 0 号桶是同一姿态
+    const float LoopLength = GASPoseSampler::GetLoopLength(Animation);
+    float LocalTime = Time;
+    if (bLooping && LoopLength > 0.0f)
+    {
+        LocalTime = std::fmod(LocalTime, LoopLength);
+        if (LocalTime < 0.0f) LocalTime += LoopLength;
+    }
+    else
+    {
+        LocalTime = std::min(std::max(LocalTime, 0.0f), LoopLength);
+    }
+
+    int64_t Bucket = (int64_t)std::floor(LocalTime / Settings.TimeTolerance + 0.5f);
+    float BucketTime = (float)Bucket * Settings.TimeTolerance;
+    if (bLooping && LoopLength > 0.0f && BucketTime >= LoopLength)
+    {
+        Bucket = 0;
+        BucketTime = 0.0f;
+    }
+    BucketTime = std::min(BucketTime, LoopLength);
+
+    const FPoseKey Key{ Skeleton, Animation, Bucket };
+    auto It = PoseMap.find(Key);
+    if (It != PoseMap.end())
+    {
+        FGASSharedPose& Pose = Poses[It->second];
+        if (Pose.LastUsedFrame != FrameIndex)
+        {
+            Pose.LastUsedFrame = FrameIndex;
+            ++Stats.NumUniquePoses;
+        }
+        return &Pose;
+    }
+
+    int32_t Slot;
+    if (!FreeSlots.empty())
+    {
+        Slot = FreeSlots.back();
+        FreeSlots.pop_back();
+    }
+    else
+    {
+        Slot = (int32_t)Poses.size();
+        Poses.emplace_back();
+    }
+
+    FGASSharedPose& Pose = Poses[Slot];
+    Pose.Skeleton = Skeleton;
+    Pose.Animation = Animation;
+    Pose.Bucket = Bucket;
+    Pose.Time = BucketTime;
+    Pose.LastUsedFrame = FrameIndex;
+    if (!Evaluate(Pose))
+    {
+        FreeSlots.push_back(Slot);
+        return nullptr;
+    }
+
+    PoseMap.emplace(Key, Slot);
+    ++Stats.NumUniquePoses;
+    ++Stats.NumEvaluations;
+    Stats.NumCachedPoses = (uint32_t)PoseMap.size();
+    return &Pose;
+}
+
+bool GASPoseSharing::Evaluate(FGASSharedPose& Pose)
+{
+    const int32_t NumBones = Pose.Skeleton->GetNumBones();
+    if ((int32_t)Pose.Animation->AnimHeader.TrackCount != NumBones)
+    {
+        GAS_LOG_ERROR("GASPoseSharing: Animation %s has %u tracks, skeleton %s has %d bones", Pose.Animation->AssetName.c_str(),
+            Pose.Animation->AnimHeader.TrackCount, Pose.Skeleton->AssetName.c_str(), NumBones);
+        return false;
+    }
+
+    Pose.LocalPose.resize(NumBones);
+    Pose.Palette.resize(NumBones);
+    return GASPoseSampler::SamplePose(Pose.Animation, Pose.Time, false, Pose.LocalPose.data())
+        && GASSkinning::ComputeSkinMatrices(Pose.Skeleton, Pose.LocalPose.data(), Pose.Palette.data());
+}
+
+void GASPoseSharing::Clear()
+{
+    Poses.clear();
+    FreeSlots.clear();
+    PoseMap.clear();
+    Stats.NumCachedPoses = 0;
+}
+
+void GASPoseSharing::LogStats() const
+{
+    GAS_LOG("PoseSharing: %u requests -> %u unique poses (x%.1f shared), %u evaluated, %u cached",
+        Stats.NumRequests, Stats.NumUniquePoses, Stats.GetSharingRatio(), Stats.NumEvaluations, Stats.NumCachedPoses);
+}
@@ -0,0 +1,95 @@
+﻿#pragma once
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+#include "../../Core/Types/GASAsset.h"
+#include "../Rendering/GASSkinning.h"
+
+// 姿态共享参数
+struct FGASPoseSharingSettings
+{
+    // 时间容差 (秒)：播放时间量化到该宽度的桶，同一 (骨骼, 动画, 桶) 只求值一次，实际采样误差不超过容差的一半
+    float TimeTolerance = 1.0f / 60.0f;
+
+    // 连续多少帧未被引用的共享姿态会被回收 (姿态只取决于动画与时间，跨帧仍可复用)
+    uint32_t MaxIdleFrames = 2;
+};
+
+// 姿态共享统计 (每帧 BeginFrame 时清零，NumCachedPoses 除外)
+struct FGASPoseSharingStats
+{
+    uint32_t NumRequests = 0;       // 本帧实例请求数
+    uint32_t NumUniquePoses = 0;    // 本帧被引用的不同姿态数
+    uint32_t NumEvaluations = 0;    // 本帧新求值的姿态数 (其余来自之前帧的缓存)
+    uint32_t NumCachedPoses = 0;    // 当前缓存的姿态数
+
+    // 平均每个姿态被多少实例共享
+    float GetSharingRatio() const { return NumUniquePoses > 0 ? (float)NumRequests / (float)NumUniquePoses : 0.0f; }
+};
+
+// 一个共享姿态：局部姿态与蒙皮矩阵调色板
+struct FGASSharedPose
+{
+    const GASSkeleton* Skeleton = nullptr;
+    const GASAnimation* Animation = nullptr;
+    int64_t Bucket = 0;
+    float Time = 0.0f;                      // 实际采样时间
+    std::vector<FGASTransform> LocalPose;
+    std::vector<FGASSkinMatrix> Palette;
+    uint64_t LastUsedFrame = 0;
+};
+
+// 群体姿态共享：大量实例以相近时间播放同一动画时，按 (骨骼, 动画, 时间桶) 只求值一次，实例引用共享调色板
+// 动画开销从 O(实例数) 降为 O(不同姿态数)
+// Acquire 不是线程安全的 (应在派发实例任务前集中调用)；返回的姿态在下一次 BeginFrame 前有效且只读
+class GASPoseSharing
+{
+public:
+    explicit GASPoseSharing(const FGASPoseSharingSettings& InSettings = FGASPoseSharingSettings());
+
+    // 每帧开始时调用：统计清零并回收闲置姿态
+    void BeginFrame();
+
+    // 获取共享姿态 (不存在时求值)，失败返回 nullptr
+    const FGASSharedPose* Acquire(const GASSkeleton* Skeleton, const GASAnimation* Animation, float Time, bool bLooping);
+
+    // 丢弃全部缓存 (资产卸载或热重载后调用)
+    void Clear();
+
+    const FGASPoseSharingSettings& GetSettings() const { return Settings; }
+    const FGASPoseSharingStats& GetStats() const { return Stats; }
+
+    // 输出本帧统计
+    void LogStats() const;
+
+private:
+    struct FPoseKey
+    {
+        const GASSkeleton* Skeleton;
+        const GASAnimation* Animation;
+        int64_t Bucket;
+
+        bool operator==(const FPoseKey& Other) const
+        {
+            return Skeleton == Other.Skeleton && Animation == Other.Animation && Bucket == Other.Bucket;
+        }
+    };
+
+    struct FPoseKeyHash
+    {
+        size_t operator()(const FPoseKey& Key) const;
+    };
+
+    bool Evaluate(FGASSharedPose& Pose);
+
+private:
+    FGASPoseSharingSettings Settings;
+    FGASPoseSharingStats Stats;
+    uint64_t FrameIndex = 0;
+
+    // 姿态池 (deque 扩容时已返回的指针保持有效)：回收的槽位进入空闲列表，复用其内存
+    std::deque<FGASSharedPose> Poses;
+    std::vector<int32_t> FreeSlots;
+    std::unordered_map<FPoseKey, int32_t, FPoseKeyHash> PoseMap;
+};
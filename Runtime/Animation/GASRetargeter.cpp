@@ -0,0 +1,49 @@
+﻿#include "GASRetargeter.h"
+#include "../../Core/Utils/GASMath.h"
+#include "../../Core/Utils/GASLogging.h"
+
+bool GASRetargeter::RetargetPose(const GASRetargetMap* Map, const FGASTransform* SourcePose, FGASTransform* OutPose)
+{
+    if (!Map || !SourcePose || !OutPose) return false;
+
+    const int32_t NumBones = Map->GetNumBones();
+    const FGASRetargetBone* Bones = Map->Bones.GetData();
+    for (int32_t t = 0; t < NumBones; ++t)
+    {
+        const FGASRetargetBone& Bone = Bones[t];
+        FGASTransform& Out = OutPose[t];
+        if (Bone.SourceIndex < 0)
+        {
+            Out = Bone.BindPose;
+            continue;
+        }
+
+        const FGASTransform& Source = SourcePose[Bone.SourceIndex];
+        Out.Rotation = GASMath::Multiply(GASMath::Multiply(Bone.PreRotation, Source.Rotation), Bone.PostRotation);
+        Out.Translation = (Bone.TranslationMode == EGASRetargetTranslation::AnimationScaled)
+            ? GASMath::Scale(GASMath::RotateVector(Bone.PreRotation, Source.Translation), Bone.TranslationScale)
+            : Bone.BindPose.Translation;
+        Out.Scale = Bone.BindPose.Scale;
+    }
+    return true;
+}
+
+bool GASRetargeter::RetargetFrame(const GASRetargetMap* Map, const GASAnimation* Animation, int32_t Frame, FGASTransform* OutPose)
+{
+    if (!Map || !Animation || Frame < 0 || Frame >= Animation->GetNumFrames()) return false;
+
+    const uint64_t SourceGUID = Map->GetSourceSkeletonGUID();
+    if (SourceGUID != 0 && Animation->AnimHeader.TargetSkeletonGUID != 0 && Animation->AnimHeader.TargetSkeletonGUID != SourceGUID)
+    {
+        GAS_LOG_ERROR("RetargetFrame: Animation %s does not belong to source skeleton %llu", Animation->AssetName.c_str(), SourceGUID);
+        return false;
+    }
+    if ((int32_t)Animation->AnimHeader.TrackCount != Map->GetNumSourceBones())
+    {
+        GAS_LOG_ERROR("RetargetFrame: Track count %u does not match source bone count %d", Animation->AnimHeader.TrackCount, Map->GetNumSourceBones());
+        return false;
+    }
+
+    // 一帧的所有轨道连续存放
+    return RetargetPose(Map, Animation->GetTransform(Frame, 0), OutPose);
+}
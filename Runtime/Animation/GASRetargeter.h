@@ -0,0 +1,15 @@
+﻿#pragma once
+#include <cstdint>
+#include "../../Core/Types/GASAsset.h"
+
+// 运行时重定向：把源骨骼上采样得到的局部姿态按 GASRetargetMap 转换为目标骨骼的局部姿态
+// 按目标骨骼顺序一次线性遍历，不做名称查找与内存分配
+class GASRetargeter
+{
+public:
+    // SourcePose 长度为源骨骼数，OutPose 长度为目标骨骼数，两者不能重叠
+    static bool RetargetPose(const GASRetargetMap* Map, const FGASTransform* SourcePose, FGASTransform* OutPose);
+
+    // 直接重定向动画的某一帧 (动画须属于重定向表的源骨骼)
+    static bool RetargetFrame(const GASRetargetMap* Map, const GASAnimation* Animation, int32_t Frame, FGASTransform* OutPose);
+};
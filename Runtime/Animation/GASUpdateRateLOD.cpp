@@ -0,0 +1,154 @@
+﻿#include "GASUpdateRateLOD.h"
+#include <algorithm>
+#include <cmath>
+#include "../../Core/Utils/GASLogging.h"
+
+GASUpdateRateLOD::GASUpdateRateLOD(const FGASUpdateRateSettings& InSettings)
+    : Settings(InSettings)
+{
+}
+
+uint32_t GASUpdateRateLOD::IntervalLevel(uint32_t Interval)
+{
+    return Interval >= 8 ? 3 : (Interval >= 4 ? 2 : (Interval >= 2 ? 1 : 0));
+}
+
+int32_t GASUpdateRateLOD::AddInstance(int32_t NumBones)
+{
+    int32_t Id;
+    if (!FreeInstances.empty())
+    {
+        Id = FreeInstances.back();
+        FreeInstances.pop_back();
+    }
+    else
+    {
+        Id = (int32_t)Instances.size();
+        Instances.emplace_back();
+    }
+
+    FInstance& Instance = Instances[Id];
+    Instance.bActive = true;
+    Instance.Interval = 1;
+    Instance.Phase = 0;
+    Instance.NumBones = NumBones;
+    Instance.NumEvaluations = 0;
+    Instance.Current = 0;
+    Instance.Palettes[0].resize(NumBones);
+    Instance.Palettes[1].resize(NumBones);
+    return Id;
+}
+
+void GASUpdateRateLOD::RemoveInstance(int32_t Instance)
+{
+    if (Instance < 0 || Instance >= (int32_t)Instances.size() || !Instances[Instance].bActive) return;
+    Instances[Instance].bActive = false;
+    FreeInstances.push_back(Instance);
+}
+
+float GASUpdateRateLOD::ComputeScreenSize(float Radius, float Distance, float VerticalFOV)
+{
+    const float HalfHeight = std::max(Distance, 1e-3f) * std::tan(VerticalFOV * 0.5f);
+    return HalfHeight > 0.0f ? Radius / HalfHeight : 1.0f;
+}
+
+uint32_t GASUpdateRateLOD::SelectIntervalByScreenSize(float ScreenSize, bool bVisible) const
+{
+    if (!bVisible) return Settings.OffscreenInterval;
+
+    uint32_t Interval = 1;
+    for (int i = 0; i < 3 && ScreenSize < Settings.ScreenSizeThresholds[i]; ++i) Interval <<= 1;
+    return Interval;
+}
+
+uint32_t GASUpdateRateLOD::SelectIntervalByDistance(float Distance, bool bVisible) const
+{
+    if (!bVisible) return Settings.OffscreenInterval;
+
+    uint32_t Interval = 1;
+    for (int i = 0; i < 3 && Distance > Settings.DistanceThresholds[i]; ++i) Interval <<= 1;
+    return Interval;
+}
+
+void GASUpdateRateLOD::SetInterval(int32_t Instance, uint32_t Interval)
+{
+    assert(Instance >= 0 && Instance < (int32_t)Instances.size() && Instances[Instance].bActive);
+
+    const uint32_t Level = IntervalLevel(Interval);
+    const uint32_t Rounded = 1u << Level;
+    FInstance& State = Instances[Instance];
+    if (State.Interval == Rounded) return;
+
+    State.Interval = Rounded;
+    State.Phase = NextPhase[Level]++ & (Rounded - 1);
+}
+
+uint32_t GASUpdateRateLOD::GetInterval(int32_t Instance) const
+{
+    assert(Instance >= 0 && Instance < (int32_t)Instances.size());
+    return Instances[Instance].Interval;
+}
+
+void GASUpdateRateLOD::BeginFrame(std::vector<int32_t>& OutDueInstances)
+{
+    ++FrameIndex;
+    OutDueInstances.clear();
+    Stats = FGASUpdateRateStats();
+
+    for (int32_t i = 0; i < (int32_t)Instances.size(); ++i)
+    {
+        const FInstance& Instance = Instances[i];
+        if (!Instance.bActive) continue;
+
+        ++Stats.NumInstances;
+        ++Stats.NumByInterval[IntervalLevel(Instance.Interval)];
+
+        // 尚未求值的实例立即求值，其余按相位错开
+        const bool bDue = Instance.NumEvaluations == 0 || ((FrameIndex + Instance.Phase) & (Instance.Interval - 1)) == 0;
+        if (bDue) OutDueInstances.push_back(i);
+    }
+    Stats.NumEvaluated = (uint32_t)OutDueInstances.size();
+}
+
+FGASSkinMatrix* GASUpdateRateLOD::GetWritePalette(int32_t Instance)
+{
+    assert(Instance >= 0 && Instance < (int32_t)Instances.size() && Instances[Instance].bActive);
+
+    FInstance& State = Instances[Instance];
+    if (State.NumEvaluations > 0 && State.LastEvalFrame != FrameIndex)
+    {
+        State.Current ^= 1;
+    }
+    State.NumEvaluations = std::min(State.NumEvaluations + 1, 2);
+    State.LastEvalFrame = FrameIndex;
+    return State.Palettes[State.Current].data();
+}
+
+bool GASUpdateRateLOD::ResolvePalette(int32_t Instance, FGASSkinMatrix* OutPalette) const
+{
+    assert(Instance >= 0 && Instance < (int32_t)Instances.size());
+
+    const FInstance& State = Instances[Instance];
+    if (!State.bActive || State.NumEvaluations == 0) return false;
+
+    const FGASSkinMatrix* Latest = State.Palettes[State.Current].data();
+
+    // 求值当帧 Alpha = 1 / Interval，到下次求值前一帧达到 1
+    const float Alpha = std::min(1.0f, (float)(FrameIndex - State.LastEvalFrame + 1) / (float)State.Interval);
+    if (!Settings.bInterpolate || State.NumEvaluations < 2 || Alpha >= 1.0f)
+    {
+        std::copy(Latest, Latest + State.NumBones, OutPalette);
+        return true;
+    }
+
+    const FGASSkinMatrix* Previous = State.Palettes[State.Current ^ 1].data();
+    const float InvAlpha = 1.0f - Alpha;
+    for (int32_t b = 0; b < State.NumBones; ++b)
+    {
+        const float* A = &Previous[b].M[0][0];
+        const float* B = &Latest[b].M[0][0];
+        float* Out = &OutPalette[b].M[0][0];
+        for (int i = 0; i < 12; ++i) Out[i] = A[i] * InvAlpha + B[i] * Alpha;
+    }
+    return true;
+}
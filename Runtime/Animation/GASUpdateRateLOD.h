@@ -0,0 +1,93 @@
+﻿#pragma once
+#include <cstdint>
+#include <vector>
+#include "../Rendering/GASSkinning.h"
+
+// 更新间隔只取 1/2/4/8 帧
+static const uint32_t GAS_MAX_UPDATE_INTERVAL = 8;
+
+// 更新频率 LOD 参数
+struct FGASUpdateRateSettings
+{
+    // 屏幕占比 (包围球投影直径 / 屏幕高度) 依次低于阈值时降为每 2/4/8 帧更新
+    float ScreenSizeThresholds[3] = { 0.15f, 0.06f, 0.02f };
+
+    // 按距离选择时的阈值 (米)，依次超过时降为每 2/4/8 帧更新
+    float DistanceThresholds[3] = { 15.0f, 40.0f, 100.0f };
+
+    // 不可见实例的更新间隔
+    uint32_t OffscreenInterval = GAS_MAX_UPDATE_INTERVAL;
+
+    // 两次求值之间是否插值调色板 (关闭时直接使用最近一次结果)
+    bool bInterpolate = true;
+};
+
+// 每帧统计
+struct FGASUpdateRateStats
+{
+    uint32_t NumInstances = 0;
+    uint32_t NumEvaluated = 0;                  // 本帧需要求值的实例数
+    uint32_t NumByInterval[4] = { 0, 0, 0, 0 }; // 间隔 1/2/4/8 的实例数
+};
+
+// 动画更新频率 LOD：远处/不可见实例每 2/4/8 帧求值一次，按相位错开使每帧负载均匀，
+// 渲染时在最近两次求值的调色板之间插值 (落后最多一个间隔)
+// 用法：BeginFrame 得到本帧到期实例 -> 为每个实例求值并写入 GetWritePalette -> ResolvePalette 取渲染用调色板
+class GASUpdateRateLOD
+{
+public:
+    explicit GASUpdateRateLOD(const FGASUpdateRateSettings& InSettings = FGASUpdateRateSettings());
+
+    // 添加实例，返回实例 ID (移除后的 ID 会被复用)；新实例在下一帧立即求值
+    int32_t AddInstance(int32_t NumBones);
+    void RemoveInstance(int32_t Instance);
+
+    // 包围球半径 Radius 在距离 Distance、垂直视场角 VerticalFOV (弧度) 下的屏幕占比
+    static float ComputeScreenSize(float Radius, float Distance, float VerticalFOV);
+
+    // 由屏幕占比 / 距离选择更新间隔
+    uint32_t SelectIntervalByScreenSize(float ScreenSize, bool bVisible) const;
+    uint32_t SelectIntervalByDistance(float Distance, bool bVisible) const;
+
+    // 设置实例的更新间隔 (向下取到 1/2/4/8)，间隔变化时重新分配相位以保持各帧负载均衡
+    void SetInterval(int32_t Instance, uint32_t Interval);
+    uint32_t GetInterval(int32_t Instance) const;
+
+    // 开始新的一帧，输出本帧需要求值的实例
+    void BeginFrame(std::vector<int32_t>& OutDueInstances);
+
+    // 取得本帧写入的调色板 (上一次结果自动保留为插值起点)，每个到期实例调用一次
+    FGASSkinMatrix* GetWritePalette(int32_t Instance);
+
+    // 渲染用调色板：在最近两次求值之间按经过的帧数插值，尚未求值时返回 false
+    bool ResolvePalette(int32_t Instance, FGASSkinMatrix* OutPalette) const;
+
+    uint64_t GetFrameIndex() const { return FrameIndex; }
+    const FGASUpdateRateStats& GetStats() const { return Stats; }
+
+private:
+    struct FInstance
+    {
+        bool bActive = false;
+        uint32_t Interval = 1;
+        uint32_t Phase = 0;
+        int32_t NumBones = 0;
+        int32_t NumEvaluations = 0;     // 0 表示尚未求值，1 表示只有一份调色板
+        uint64_t LastEvalFrame = 0;
+        int32_t Current = 0;            // Palettes[Current] 为最近一次结果
+        std::vector<FGASSkinMatrix> Palettes[2];
+    };
+
+    static uint32_t IntervalLevel(uint32_t Interval);
+
+private:
+    FGASUpdateRateSettings Settings;
+    FGASUpdateRateStats Stats;
+    uint64_t FrameIndex = 0;
+
+    std::vector<FInstance> Instances;
+    std::vector<int32_t> FreeInstances;
+
+    // 每种间隔下一个分配的相位 (轮转)
+    uint32_t NextPhase[4] = { 0, 0, 0, 0 };
+};
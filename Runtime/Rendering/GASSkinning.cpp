@@ -0,0 +1,273 @@
+﻿#include "GASSkinning.h"
+#include <vector>
+#include <cmath>
+#include "../../Core/Utils/GASMath.h"
+#include "../../Core/Utils/GASSimdMath.h"
+#include "../../Core/Utils/GASLogging.h"
+#include "../Scheduling/GASParallelFor.h"
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define GAS_SKINNING_SSE 1
+#include <emmintrin.h>
+#else
+#define GAS_SKINNING_SSE 0
+#endif
+
+// 每个并行批次的最少顶点数
+static const int32_t SKINNING_BATCH_SIZE = 2048;
+
+static FGASVector3 SafeNormalize(const FGASVector3& V)
+{
+    float LenSq = GASMath::LengthSq(V);
+    return LenSq > GASMath::SMALL_NUMBER ? GASMath::Scale(V, 1.0f / std::sqrt(LenSq)) : V;
+}
+
+// 权重总和为 0 的顶点原样输出
+static void WriteBindPose(const FGASSkinVertex& Vertex, int32_t Index, const FGASSkinningOutput& Output)
+{
+    Output.Positions[Index] = Vertex.Position;
+    if (Output.Normals) Output.Normals[Index] = Vertex.Normal;
+    if (Output.Tangents) Output.Tangents[Index] = Vertex.Tangent;
+}
+
+template <int32_t N>
+static bool HasWeights(const FGASSkinVertex& Vertex)
+{
+    float Sum = 0.0f;
+    for (int32_t j = 0; j < N; ++j) Sum += Vertex.BoneWeights.Weights[j];
+    return Sum > 0.0f;
+}
+
+// 线性混合：先按权重累加矩阵的 3 行，再做一次变换
+template <int32_t N>
+static void SkinLinearRange(const FGASSkinVertex* Vertices, int32_t Begin, int32_t End, const FGASSkinMatrix* Skin, const FGASSkinningOutput& Output)
+{
+    for (int32_t v = Begin; v < End; ++v)
+    {
+        const FGASSkinVertex& Vertex = Vertices[v];
+        if (!HasWeights<N>(Vertex))
+        {
+            WriteBindPose(Vertex, v, Output);
+            continue;
+        }
+
+#if GAS_SKINNING_SSE
+        const FGASSkinMatrix& First = Skin[Vertex.BoneIndices.Indices[0]];
+        __m128 W = _mm_set1_ps(Vertex.BoneWeights.Weights[0]);
+        __m128 C0 = _mm_mul_ps(_mm_loadu_ps(First.M[0]), W);
+        __m128 C1 = _mm_mul_ps(_mm_loadu_ps(First.M[1]), W);
+        __m128 C2 = _mm_mul_ps(_mm_loadu_ps(First.M[2]), W);
+        for (int32_t j = 1; j < N; ++j)
+        {
+            // 权重为 0 的槽位按 0 累加，无需分支
+            const FGASSkinMatrix& M = Skin[Vertex.BoneIndices.Indices[j]];
+            W = _mm_set1_ps(Vertex.BoneWeights.Weights[j]);
+            C0 = _mm_add_ps(C0, _mm_mul_ps(_mm_loadu_ps(M.M[0]), W));
+            C1 = _mm_add_ps(C1, _mm_mul_ps(_mm_loadu_ps(M.M[1]), W));
+            C2 = _mm_add_ps(C2, _mm_mul_ps(_mm_loadu_ps(M.M[2]), W));
+        }
+
+        // 累加的 3 行转置为 4 列，C3 为平移
+        __m128 C3 = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS(C0, C1, C2, C3);
+
+        alignas(16) float Result[4];
+        auto TransformDirection = [&](const FGASVector3& D) -> __m128
+        {
+            return _mm_add_ps(_mm_add_ps(_mm_mul_ps(C0, _mm_set1_ps(D.X)), _mm_mul_ps(C1, _mm_set1_ps(D.Y))), _mm_mul_ps(C2, _mm_set1_ps(D.Z)));
+        };
+
+        _mm_store_ps(Result, _mm_add_ps(TransformDirection(Vertex.Position), C3));
+        Output.Positions[v] = FGASVector3(Result[0], Result[1], Result[2]);
+        if (Output.Normals)
+        {
+            _mm_store_ps(Result, TransformDirection(Vertex.Normal));
+            Output.Normals[v] = SafeNormalize(FGASVector3(Result[0], Result[1], Result[2]));
+        }
+        if (Output.Tangents)
+        {
+            _mm_store_ps(Result, TransformDirection(Vertex.Tangent));
+            Output.Tangents[v] = SafeNormalize(FGASVector3(Result[0], Result[1], Result[2]));
+        }
+#else
+        float R[3][4] = {};
+        for (int32_t j = 0; j < N; ++j)
+        {
+            const FGASSkinMatrix& M = Skin[Vertex.BoneIndices.Indices[j]];
+            const float W = Vertex.BoneWeights.Weights[j];
+            for (int r = 0; r < 3; ++r)
+            {
+                R[r][0] += M.M[r][0] * W;
+                R[r][1] += M.M[r][1] * W;
+                R[r][2] += M.M[r][2] * W;
+                R[r][3] += M.M[r][3] * W;
+            }
+        }
+        auto TransformDirection = [&R](const FGASVector3& D)
+        {
+            return FGASVector3(R[0][0] * D.X + R[0][1] * D.Y + R[0][2] * D.Z,
+                R[1][0] * D.X + R[1][1] * D.Y + R[1][2] * D.Z,
+                R[2][0] * D.X + R[2][1] * D.Y + R[2][2] * D.Z);
+        };
+
+        Output.Positions[v] = GASMath::Add(TransformDirection(Vertex.Position), FGASVector3(R[0][3], R[1][3], R[2][3]));
+        if (Output.Normals) Output.Normals[v] = SafeNormalize(TransformDirection(Vertex.Normal));
+        if (Output.Tangents) Output.Tangents[v] = SafeNormalize(TransformDirection(Vertex.Tangent));
+#endif
+    }
+}
+
+// 对偶四元数混合：以第一个影响为基准翻转反向半球，归一化后刚体变换
+template <int32_t N>
+static void SkinDualQuatRange(const FGASSkinVertex* Vertices, int32_t Begin, int32_t End, const FGASDualQuat* DualQuats, const FGASSkinningOutput& Output)
+{
+    for (int32_t v = Begin; v < End; ++v)
+    {
+        const FGASSkinVertex& Vertex = Vertices[v];
+        if (!HasWeights<N>(Vertex))
+        {
+            WriteBindPose(Vertex, v, Output);
+            continue;
+        }
+
+        const FGASQuaternion& Pivot = DualQuats[Vertex.BoneIndices.Indices[0]].Real;
+        float R[4] = { 0, 0, 0, 0 };
+        float D[4] = { 0, 0, 0, 0 };
+        for (int32_t j = 0; j < N; ++j)
+        {
+            const FGASDualQuat& Q = DualQuats[Vertex.BoneIndices.Indices[j]];
+            float W = Vertex.BoneWeights.Weights[j];
+            if (Pivot.X * Q.Real.X + Pivot.Y * Q.Real.Y + Pivot.Z * Q.Real.Z + Pivot.W * Q.Real.W < 0.0f) W = -W;
+
+            R[0] += Q.Real.X * W; R[1] += Q.Real.Y * W; R[2] += Q.Real.Z * W; R[3] += Q.Real.W * W;
+            D[0] += Q.Dual.X * W; D[1] += Q.Dual.Y * W; D[2] += Q.Dual.Z * W; D[3] += Q.Dual.W * W;
+        }
+
+        const float LenSq = R[0] * R[0] + R[1] * R[1] + R[2] * R[2] + R[3] * R[3];
+        if (LenSq < GASMath::SMALL_NUMBER)
+        {
+            WriteBindPose(Vertex, v, Output);
+            continue;
+        }
+        const float InvLen = 1.0f / std::sqrt(LenSq);
+
+        FGASQuaternion Real;
+        Real.X = R[0] * InvLen; Real.Y = R[1] * InvLen; Real.Z = R[2] * InvLen; Real.W = R[3] * InvLen;
+        const FGASVector3 RealV(Real.X, Real.Y, Real.Z);
+        const FGASVector3 DualV(D[0] * InvLen, D[1] * InvLen, D[2] * InvLen);
+        const float DualW = D[3] * InvLen;
+
+        // T = 2 * (Dual * conj(Real)).xyz
+        const FGASVector3 Translation = GASMath::Scale(GASMath::Add(GASMath::Subtract(GASMath::Scale(DualV, Real.W), GASMath::Scale(RealV, DualW)), GASMath::Cross(RealV, DualV)), 2.0f);
+
+        Output.Positions[v] = GASMath::Add(GASMath::RotateVector(Real, Vertex.Position), Translation);
+        if (Output.Normals) Output.Normals[v] = SafeNormalize(GASMath::RotateVector(Real, Vertex.Normal));
+        if (Output.Tangents) Output.Tangents[v] = SafeNormalize(GASMath::RotateVector(Real, Vertex.Tangent));
+    }
+}
+
+bool GASSkinning::ComputeSkinMatrices(const GASSkeleton* Skeleton, const FGASTransform* LocalPose, FGASSkinMatrix* OutSkinMatrices)
+{
+    if (!Skeleton || !LocalPose || !OutSkinMatrices) return false;
+
+    const int32_t NumBones = Skeleton->GetNumBones();
+    std::vector<FGASAffineRegister> Global(NumBones);
+    for (int32_t b = 0; b < NumBones; ++b)
+    {
+        const int32_t Parent = Skeleton->GetParentIndex(b);
+        if (Parent >= b)
+        {
+            GAS_LOG_ERROR("ComputeSkinMatrices: Skeleton is not parent-first (bone %d)", b);
+            return false;
+        }
+
+        const FGASAffineRegister Local = GASSimd::AffineCompose(LocalPose[b]);
+        Global[b] = (Parent >= 0) ? GASSimd::AffineMultiply(Global[Parent], Local) : Local;
+
+        const FGASAffineRegister InverseBind = GASSimd::LoadAffine(Skeleton->GetInverseBindMatrix(b));
+        GASSimd::StoreAffine(OutSkinMatrices[b], GASSimd::AffineMultiply(Global[b], InverseBind));
+    }
+    return true;
+}
+
+bool GASSkinning::ComputeSkinMatrices(const GASSkeleton* Skeleton, const GASAnimation* Animation, int32_t Frame, FGASSkinMatrix* OutSkinMatrices)
+{
+    if (!Skeleton || !Animation || Frame < 0 || Frame >= Animation->GetNumFrames()) return false;
+    if ((int32_t)Animation->AnimHeader.TrackCount != Skeleton->GetNumBones())
+    {
+        GAS_LOG_ERROR("ComputeSkinMatrices: Track count %u does not match bone count %d", Animation->AnimHeader.TrackCount, Skeleton->GetNumBones());
+        return false;
+    }
+
+    // 一帧的所有轨道连续存放
+    const FGASTransform* LocalPose = Animation->GetTransform(Frame, 0);
+    return ComputeSkinMatrices(Skeleton, LocalPose, OutSkinMatrices);
+}
+
+void GASSkinning::ToDualQuats(const FGASSkinMatrix* SkinMatrices, int32_t NumBones, FGASDualQuat* OutDualQuats)
+{
+    for (int32_t b = 0; b < NumBones; ++b)
+    {
+        const FGASAffineRegister M = GASSimd::LoadAffine(SkinMatrices[b]);
+        const FGASVectorRegister Real = GASSimd::AffineToQuat(M);
+
+        // 平移列的 W 为 0，即纯四元数 (T, 0)
+        const FGASVectorRegister Dual = GASSimd::VectorMultiply(GASSimd::QuatMultiply(M.Columns[3], Real), GASSimd::VectorSplat(0.5f));
+        GASSimd::StoreQuat(OutDualQuats[b].Real, Real);
+        GASSimd::StoreQuat(OutDualQuats[b].Dual, Dual);
+    }
+}
+
+void GASSkinning::SkinLinear(const FGASSkinVertex* Vertices, int32_t NumVertices, int32_t InfluenceCount,
+    const FGASSkinMatrix* SkinMatrices, const FGASSkinningOutput& Output, bool bParallel)
+{
+    if (!Vertices || !SkinMatrices || !Output.Positions || NumVertices <= 0) return;
+    if (!IsValidInfluenceCount(InfluenceCount)) InfluenceCount = MAX_BONE_INFLUENCES;
+
+    DispatchInfluenceCount(InfluenceCount, [&](auto Count)
+    {
+        constexpr int32_t N = decltype(Count)::value;
+        GASParallelFor(NumVertices, bParallel ? SKINNING_BATCH_SIZE : NumVertices, [&](int32_t Begin, int32_t End)
+        {
+            SkinLinearRange<N>(Vertices, Begin, End, SkinMatrices, Output);
+        });
+    });
+}
+
+void GASSkinning::SkinDualQuat(const FGASSkinVertex* Vertices, int32_t NumVertices, int32_t InfluenceCount,
+    const FGASDualQuat* DualQuats, const FGASSkinningOutput& Output, bool bParallel)
+{
+    if (!Vertices || !DualQuats || !Output.Positions || NumVertices <= 0) return;
+    if (!IsValidInfluenceCount(InfluenceCount)) InfluenceCount = MAX_BONE_INFLUENCES;
+
+    DispatchInfluenceCount(InfluenceCount, [&](auto Count)
+    {
+        constexpr int32_t N = decltype(Count)::value;
+        GASParallelFor(NumVertices, bParallel ? SKINNING_BATCH_SIZE : NumVertices, [&](int32_t Begin, int32_t End)
+        {
+            SkinDualQuatRange<N>(Vertices, Begin, End, DualQuats, Output);
+        });
+    });
+}
+
+bool GASSkinning::SkinMeshLinear(const GASMesh* Mesh, const FGASSkinMatrix* SkinMatrices, const FGASSkinningOutput& Output, bool bParallel)
+{
+    if (!Mesh || Mesh->Vertices.Num() == 0)
+    {
+        GAS_LOG_WARN("SkinMeshLinear: Mesh has no full vertices");
+        return false;
+    }
+    SkinLinear(Mesh->Vertices.GetData(), Mesh->Vertices.Num(), Mesh->GetInfluenceCount(), SkinMatrices, Output, bParallel);
+    return true;
+}
+
+bool GASSkinning::SkinMeshDualQuat(const GASMesh* Mesh, const FGASDualQuat* DualQuats, const FGASSkinningOutput& Output, bool bParallel)
+{
+    if (!Mesh || Mesh->Vertices.Num() == 0)
+    {
+        GAS_LOG_WARN("SkinMeshDualQuat: Mesh has no full vertices");
+        return false;
+    }
+    SkinDualQuat(Mesh->Vertices.GetData(), Mesh->Vertices.Num(), Mesh->GetInfluenceCount(), DualQuats, Output, bParallel);
+    return true;
+}
@@ -0,0 +1,48 @@
+﻿#pragma once
+#include <cstdint>
+#include "../../Core/Types/GASAsset.h"
+
+// 蒙皮矩阵 (Global * InverseBind)：列向量布局的 3x4，按行存放，M[r][3] 为平移 (调色板每骨骼 48 字节)
+typedef FGASMatrix3x4 FGASSkinMatrix;
+
+// 对偶四元数：Real 为旋转，Dual = 0.5 * (T, 0) * Real
+struct FGASDualQuat
+{
+    FGASQuaternion Real;
+    FGASQuaternion Dual;
+};
+
+// 蒙皮输出流 (与输入顶点一一对应)，Normals / Tangents 为空时跳过
+struct FGASSkinningOutput
+{
+    FGASVector3* Positions = nullptr;
+    FGASVector3* Normals = nullptr;
+    FGASVector3* Tangents = nullptr;
+};
+
+// CPU 参考蒙皮：用于无 GPU 环境的对比测试、服务器端受击盒计算与回退渲染
+// 权重总和为 0 的顶点 (刚性部件) 输出绑定姿势；内核不检查骨骼索引越界，由导入阶段保证
+class GASSkinning
+{
+public:
+    // 由局部姿势 (每骨骼一个) 计算蒙皮矩阵，骨骼须父先子后
+    static bool ComputeSkinMatrices(const GASSkeleton* Skeleton, const FGASTransform* LocalPose, FGASSkinMatrix* OutSkinMatrices);
+
+    // 由动画的某一帧计算蒙皮矩阵
+    static bool ComputeSkinMatrices(const GASSkeleton* Skeleton, const GASAnimation* Animation, int32_t Frame, FGASSkinMatrix* OutSkinMatrices);
+
+    // 蒙皮矩阵 -> 对偶四元数 (只保留旋转与平移，缩放被丢弃)
+    static void ToDualQuats(const FGASSkinMatrix* SkinMatrices, int32_t NumBones, FGASDualQuat* OutDualQuats);
+
+    // 线性混合蒙皮 (SSE，按影响数 1/2/4/8 特化)，法线与切线按混合矩阵变换后归一化
+    static void SkinLinear(const FGASSkinVertex* Vertices, int32_t NumVertices, int32_t InfluenceCount,
+        const FGASSkinMatrix* SkinMatrices, const FGASSkinningOutput& Output, bool bParallel = true);
+
+    // 对偶四元数蒙皮 (按影响数特化)，混合前按第一个影响对齐半球
+    static void SkinDualQuat(const FGASSkinVertex* Vertices, int32_t NumVertices, int32_t InfluenceCount,
+        const FGASDualQuat* DualQuats, const FGASSkinningOutput& Output, bool bParallel = true);
+
+    // Mesh 便捷接口：使用完整顶点与 Mesh 的 InfluenceCount，完整顶点已剥离时返回 false
+    static bool SkinMeshLinear(const GASMesh* Mesh, const FGASSkinMatrix* SkinMatrices, const FGASSkinningOutput& Output, bool bParallel = true);
+    static bool SkinMeshDualQuat(const GASMesh* Mesh, const FGASDualQuat* DualQuats, const FGASSkinningOutput& Output, bool bParallel = true);
+};
@@ -0,0 +1,90 @@
+﻿#include "GASParallelFor.h"
+
+void FGASParallelJob::ExecuteBatch(int32_t Batch)
+{
+    const int32_t Begin = Batch * BatchSize;
+    Invoke(Context, Begin, std::min(Begin + BatchSize, Num));
+    Remaining.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+GASWorkerPool& GASWorkerPool::Get()
+{
+    static GASWorkerPool Instance;
+    return Instance;
+}
+
+GASWorkerPool::GASWorkerPool()
+{
+    const int32_t NumWorkers = (int32_t)std::max(1u, std::thread::hardware_concurrency()) - 1;
+    Workers.reserve(NumWorkers);
+    for (int32_t i = 0; i < NumWorkers; ++i)
+    {
+        Workers.emplace_back([this]() { WorkerLoop(); });
+    }
+}
+
+GASWorkerPool::~GASWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> Lock(QueueMutex);
+        bStopping = true;
+    }
+    QueueCondition.notify_all();
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+}
+
+void GASWorkerPool::Run(FGASParallelJob& Job)
+{
+    Job.NextBatch.store(0, std::memory_order_relaxed);
+    Job.Remaining.store(Job.NumBatches, std::memory_order_relaxed);
+
+    if (!Workers.empty())
+    {
+        {
+            std::lock_guard<std::mutex> Lock(QueueMutex);
+            Queue.push_back(&Job);
+        }
+        QueueCondition.notify_all();
+    }
+
+    int32_t Batch = 0;
+    while (Job.ClaimBatch(Batch)) Job.ExecuteBatch(Batch);
+
+    // 批次已全部领走：移出队列后工作线程不会再访问 Job，只需等待其他线程手上的批次
+    if (!Workers.empty())
+    {
+        std::lock_guard<std::mutex> Lock(QueueMutex);
+        auto It = std::find(Queue.begin(), Queue.end(), &Job);
+        if (It != Queue.end()) Queue.erase(It);
+    }
+    while (Job.Remaining.load(std::memory_order_acquire) > 0)
+    {
+        std::this_thread::yield();
+    }
+}
+
+void GASWorkerPool::WorkerLoop()
+{
+    for (;;)
+    {
+        FGASParallelJob* Job = nullptr;
+        int32_t Batch = 0;
+        {
+            std::unique_lock<std::mutex> Lock(QueueMutex);
+            QueueCondition.wait(Lock, [this]() { return bStopping || !Queue.empty(); });
+            if (bStopping) return;
+
+            // 持锁领取批次，保证调用方移出队列之后不会再有线程领取
+            Job = Queue.front();
+            if (!Job->ClaimBatch(Batch))
+            {
+                Queue.pop_front();
+                continue;
+            }
+        }
+        Job->ExecuteBatch(Batch);
+    }
+}
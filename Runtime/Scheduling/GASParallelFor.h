@@ -0,0 +1,80 @@
+﻿#pragma once
+#include <cstdint>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+// 并行任务：[0, NumBatches) 个批次由调用线程与工作线程抢占执行，对象位于调用方栈上
+struct FGASParallelJob
+{
+    void (*Invoke)(const void* Context, int32_t Begin, int32_t End) = nullptr;
+    const void* Context = nullptr;
+    int32_t Num = 0;
+    int32_t BatchSize = 0;
+    int32_t NumBatches = 0;
+
+    std::atomic<int32_t> NextBatch{ 0 };
+    std::atomic<int32_t> Remaining{ 0 };
+
+    // 领取一个批次，没有剩余批次时返回 false
+    bool ClaimBatch(int32_t& OutBatch) { OutBatch = NextBatch.fetch_add(1, std::memory_order_relaxed); return OutBatch < NumBatches; }
+
+    // 执行已领取的批次，之后不再访问本对象 (调用方可能随即返回)
+    void ExecuteBatch(int32_t Batch);
+};
+
+// 常驻工作线程池 (硬件线程数 - 1)，首次使用时启动，进程退出时回收
+// 调用线程把任务挂到队列后自己也领取批次，只等待已被其他线程领走的批次，嵌套调用不会死锁也不会额外创建线程
+class GASWorkerPool
+{
+public:
+    static GASWorkerPool& Get();
+
+    int32_t GetNumWorkers() const { return (int32_t)Workers.size(); }
+
+    // 执行任务并等待全部批次完成
+    void Run(FGASParallelJob& Job);
+
+private:
+    GASWorkerPool();
+    ~GASWorkerPool();
+    GASWorkerPool(const GASWorkerPool&) = delete;
+    GASWorkerPool& operator=(const GASWorkerPool&) = delete;
+
+    void WorkerLoop();
+
+    std::vector<std::thread> Workers;
+    std::mutex QueueMutex;
+    std::condition_variable QueueCondition;
+    std::deque<FGASParallelJob*> Queue;
+    bool bStopping = false;
+};
+
+// 把 [0, Num) 切成连续区间并行执行 Func(Begin, End)
+// 区间不少于 MinBatchSize，调用线程也处理区间；数量不足两个批次时直接在调用线程执行
+template <typename FuncType>
+void GASParallelFor(int32_t Num, int32_t MinBatchSize, const FuncType& Func)
+{
+    if (Num <= 0) return;
+
+    GASWorkerPool& Pool = GASWorkerPool::Get();
+    const int32_t MaxBatches = Pool.GetNumWorkers() + 1;
+    const int32_t NumBatches = std::min(MaxBatches, std::max(1, Num / std::max(MinBatchSize, 1)));
+    if (NumBatches <= 1)
+    {
+        Func(0, Num);
+        return;
+    }
+
+    FGASParallelJob Job;
+    Job.Invoke = [](const void* Context, int32_t Begin, int32_t End) { (*static_cast<const FuncType*>(Context))(Begin, End); };
+    Job.Context = &Func;
+    Job.Num = Num;
+    Job.BatchSize = (Num + NumBatches - 1) / NumBatches;
+    Job.NumBatches = (Num + Job.BatchSize - 1) / Job.BatchSize;
+    Pool.Run(Job);
+}
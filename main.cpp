@@ -15,6 +15,8 @@ int main()
     EnsureDirectoriesExist();
     //数据库初始化
     GASAssetManager::Get().GetGASMetadataStorage().Initialize(GAS_CONFIG::DATABASE_PATH);
+    //热重载：监视二进制缓存目录
+    GASAssetManager::Get().EnableHotReload();
     if (!GASUI::Initialize())
     {
         GAS_LOG_ERROR("Failed to initialize Editor UI.");